@@ -0,0 +1,66 @@
+# 쉐이더 소스 embedding
+#
+# resources/shaders 의 GLSL 소스들을 빌드 시 constexpr 문자 배열 테이블로 변환하여
+# 실행 파일에 포함시킴. (런타임에는 ShaderSources::load() 로 이름으로 조회)
+#
+# 이 파일은 두 가지 방식으로 사용됨.
+#   1. CMakeLists.txt 에서 include 하면 embed_shaders() 함수를 정의
+#   2. 빌드 시 cmake -P 로 실행되면 SHADER_FILES 를 읽어서 OUTPUT_FILE 헤더 생성
+
+if(CMAKE_SCRIPT_MODE_FILE)
+  set(content "// 빌드 시 cmake/embed_shaders.cmake 로 생성되는 파일이므로 직접 수정하지 말 것\n\n")
+  string(APPEND content "#ifndef EMBEDDED_SHADER_DATA_HPP\n#define EMBEDDED_SHADER_DATA_HPP\n\n#include <cstddef>\n\n")
+  string(APPEND content "namespace EmbeddedShaderData\n{\n")
+
+  set(entries "")
+  set(index 0)
+  string(REPLACE "|" ";" SHADER_FILES "${SHADER_FILES}")
+  foreach(shader_file IN LISTS SHADER_FILES)
+    get_filename_component(shader_name ${shader_file} NAME)
+
+    # 바이트 단위 16진수 문자열로 읽어서 "0x.." 원소 목록으로 변환 (빈 파일도 배열이 되도록 끝에 0 을 추가)
+    file(READ ${shader_file} hex_content HEX)
+    string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," hex_content "${hex_content}")
+    string(REGEX REPLACE "(0x[0-9a-f][0-9a-f],0x[0-9a-f][0-9a-f],0x[0-9a-f][0-9a-f],0x[0-9a-f][0-9a-f],0x[0-9a-f][0-9a-f],0x[0-9a-f][0-9a-f],0x[0-9a-f][0-9a-f],0x[0-9a-f][0-9a-f],0x[0-9a-f][0-9a-f],0x[0-9a-f][0-9a-f],0x[0-9a-f][0-9a-f],0x[0-9a-f][0-9a-f],0x[0-9a-f][0-9a-f],0x[0-9a-f][0-9a-f],0x[0-9a-f][0-9a-f],0x[0-9a-f][0-9a-f],)" "\\1\n    " hex_content "${hex_content}")
+
+    string(APPEND content "  constexpr unsigned char SOURCE_${index}[] = {\n    ${hex_content}0x00};\n\n")
+    string(APPEND entries "      {\"${shader_name}\", SOURCE_${index}, sizeof(SOURCE_${index}) - 1},\n")
+    math(EXPR index "${index} + 1")
+  endforeach()
+
+  string(APPEND content "  struct Entry\n  {\n    const char *name;\n    const unsigned char *data;\n    std::size_t size;\n  };\n\n")
+  string(APPEND content "  constexpr Entry ENTRIES[] = {\n${entries}  };\n\n")
+  string(APPEND content "  constexpr std::size_t ENTRY_COUNT = ${index};\n}\n\n#endif /* EMBEDDED_SHADER_DATA_HPP */\n")
+
+  file(WRITE ${OUTPUT_FILE} "${content}")
+  return()
+endif()
+
+# 빌드 시 cmake -P 로 실행할 이 파일의 경로
+set(EMBED_SHADERS_SCRIPT ${CMAKE_CURRENT_LIST_FILE})
+
+# target 이 shader_directory 의 쉐이더 소스들을 embedding 한 헤더(embedded_shader_data.hpp)를 include 할 수 있도록 설정
+function(embed_shaders target shader_directory)
+  file(GLOB shader_files
+    ${shader_directory}/*.vs
+    ${shader_directory}/*.fs
+  )
+
+  set(output_directory ${CMAKE_BINARY_DIR}/generated)
+  set(output_file ${output_directory}/embedded_shader_data.hpp)
+
+  # 리스트 구분자 ';' 는 명령줄에서 인자를 나누므로 '|' 로 바꿔서 전달
+  string(REPLACE ";" "|" shader_files_argument "${shader_files}")
+
+  add_custom_command(
+    OUTPUT ${output_file}
+    COMMAND ${CMAKE_COMMAND} -E make_directory ${output_directory}
+    COMMAND ${CMAKE_COMMAND} "-DSHADER_FILES=${shader_files_argument}" -DOUTPUT_FILE=${output_file} -P ${EMBED_SHADERS_SCRIPT}
+    DEPENDS ${shader_files} ${EMBED_SHADERS_SCRIPT}
+    COMMENT "Embedding shader sources"
+    VERBATIM
+  )
+
+  target_sources(${target} PRIVATE ${output_file})
+  target_include_directories(${target} PRIVATE ${output_directory})
+endfunction()
@@ -0,0 +1,85 @@
+#ifndef ANIMATION_CLIP_HPP
+#define ANIMATION_CLIP_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <vector>
+#include <string>
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include "animation/skeleton.hpp"
+#include "animation/pose_blending.hpp"
+
+struct aiAnimation;
+
+/**
+ * AnimationSampler 구조체
+ *
+ * AnimationClip 을 매 프레임 샘플링할 때 재사용하는 상태
+ *
+ * -> from, to 에는 각 joint 의 현재 시간을 감싸는 두 키프레임 값이, weights 에는 그 사이의 보간 비율이 기록되며,
+ * PoseBlending::interpolate() 로 모든 joint 를 한꺼번에 보간함.
+ * -> cursor 들은 channel 별로 마지막으로 사용한 키프레임 위치로, 시간이 앞으로 흐르는 동안에는 다음 키프레임을 처음부터 찾지 않음.
+ */
+struct AnimationSampler
+{
+  JointPose from;
+  JointPose to;
+  JointBlendWeights weights;
+
+  std::vector<size_t> translationCursors;
+  std::vector<size_t> rotationCursors;
+  std::vector<size_t> scaleCursors;
+};
+
+/**
+ * AnimationClip 클래스
+ *
+ * aiAnimation 하나의 joint 별 키프레임들을 초 단위 시간으로 변환하여 저장하는 클래스
+ */
+class AnimationClip
+{
+public:
+  // aiAnimation 의 channel 들을 이름이 같은 skeleton joint 에 연결 (joint 를 찾지 못한 channel 은 무시)
+  AnimationClip(const aiAnimation *animation, const Skeleton &skeleton);
+
+  /**
+   * sampler 를 이 clip 을 샘플링할 수 있도록 초기화
+   *
+   * clip 에 channel 이 없는 joint 는 샘플링 중에 값이 기록되지 않으므로, from 과 to 를 bind pose 로 채워두고 보간 비율을 0 으로 둠.
+   */
+  void resetSampler(const Skeleton &skeleton, AnimationSampler &sampler) const;
+
+  // time(초)을 감싸는 키프레임 쌍과 보간 비율을 sampler 에 기록
+  void sample(float time, AnimationSampler &sampler) const;
+
+  const std::string &getName() const;
+
+  // clip 의 길이 (초)
+  float getDuration() const;
+
+private:
+  // joint 하나의 translation, rotation, scale 키프레임 (성분마다 키프레임 시간이 다를 수 있음)
+  struct JointChannel
+  {
+    int joint;
+
+    std::vector<float> translationTimes;
+    std::vector<glm::vec3> translations;
+
+    std::vector<float> rotationTimes;
+    std::vector<glm::quat> rotations;
+
+    std::vector<float> scaleTimes;
+    std::vector<glm::vec3> scales;
+  };
+
+  std::string name;
+  float duration;
+  std::vector<JointChannel> channels;
+};
+
+#endif /* ANIMATION_CLIP_HPP */
@@ -0,0 +1,90 @@
+#ifndef ANIMATOR_HPP
+#define ANIMATOR_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <vector>
+#include <glm/glm.hpp>
+#include "animation/skeleton.hpp"
+#include "animation/animation_clip.hpp"
+#include "animation/pose_blending.hpp"
+
+/**
+ * Animator 클래스
+ *
+ * Skeleton 에 AnimationClip 을 재생하여 매 프레임 bone palette(bone 별 skinning 행렬)를 계산하는 클래스
+ *
+ * 매 프레임 다음 순서로 처리됨.
+ *
+ * 1. 재생중인 clip 을 샘플링하여 joint 별 키프레임 쌍을 찾고, PoseBlending::interpolate() 로 모든 joint 를 SIMD 보간
+ * 2. 다른 clip 으로 전환하는 중이면 이전 clip 의 포즈와 PoseBlending::blend() 로 cross-fade
+ * 3. 부모 joint 부터 local transform 을 곱해서 joint 별 model space transform 계산
+ * 4. bone 마다 joint 의 model space transform 에 inverse bind matrix 를 곱해서 bone palette 생성
+ *
+ * 모든 중간 배열은 생성 시점에 할당해두므로, update() 중에는 heap 할당이 발생하지 않음.
+ */
+class Animator
+{
+public:
+  // skeleton 과 clips 는 Animator 보다 오래 유지되어야 함 (Model 이 소유)
+  Animator(const Skeleton &skeleton, const std::vector<AnimationClip> &clips);
+
+  /**
+   * clipIndex 번째 clip 을 처음부터 재생
+   *
+   * @param fadeDuration 이전 clip 의 포즈에서 새 clip 의 포즈로 섞어가며 전환할 시간 (초, 0 이면 즉시 전환)
+   */
+  void play(size_t clipIndex, float fadeDuration);
+
+  /**
+   * 재생 시간을 deltaTime(초)만큼 진행하고 bone palette 갱신 (clip 이 없으면 bind pose 로 계산됨)
+   *
+   * @return 이번 갱신에서 처리한 joint 개수 (cross-fade 중이면 두 clip 의 joint 를 모두 집계)
+   */
+  size_t update(float deltaTime);
+
+  // bone 인덱스 순서의 skinning 행렬 배열 (mesh space 정점을 model space 로 변환)
+  const std::vector<glm::mat4> &getBonePalette() const;
+
+  /**
+   * bone 인덱스 순서의 노멀 행렬 배열 (skinning 행렬의 역전치 행렬)
+   *
+   * -> std140 의 mat3 배열과 같은 배치로 UBO 에 그대로 업로드할 수 있도록 열(column)마다 vec4 를 차지하는 mat3x4 로 저장함.
+   */
+  const std::vector<glm::mat3x4> &getBoneNormalPalette() const;
+
+  size_t getClipCount() const;
+  size_t getCurrentClip() const;
+
+private:
+  const Skeleton &skeleton;
+  const std::vector<AnimationClip> &clips;
+
+  // 재생중인 clip 과 cross-fade 중인 이전 clip 의 샘플링 상태 및 재생 시간
+  struct Layer
+  {
+    size_t clip = 0;
+    float time = 0.0f;
+    AnimationSampler sampler;
+    JointPose pose;
+  };
+  Layer current;
+  Layer previous;
+
+  float fadeDuration = 0.0f;
+  float fadeTime = 0.0f;
+  bool fading = false;
+
+  JointPose pose;
+  std::vector<glm::mat4> jointTransforms;
+  std::vector<glm::mat4> bonePalette;
+  std::vector<glm::mat3x4> boneNormalPalette;
+
+  // layer 의 재생 시간을 진행하고 clip 을 샘플링하여 layer.pose 에 보간된 포즈를 기록
+  void sampleLayer(Layer &layer, float deltaTime);
+};
+
+#endif /* ANIMATOR_HPP */
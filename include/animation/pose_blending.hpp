@@ -0,0 +1,54 @@
+#ifndef POSE_BLENDING_HPP
+#define POSE_BLENDING_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <vector>
+#include <glm/glm.hpp>
+#include "animation/skeleton.hpp"
+
+/**
+ * JointBlendWeights 구조체
+ *
+ * 두 포즈를 joint 마다 다른 비율로 보간할 때 사용할 joint 별 보간 비율 (SoA)
+ *
+ * -> 키프레임 보간 시 translation, rotation, scale channel 은 키프레임 시간이 서로 다를 수 있으므로 성분별로 비율을 따로 저장함.
+ */
+struct JointBlendWeights
+{
+  std::vector<float> translation;
+  std::vector<float> rotation;
+  std::vector<float> scale;
+
+  // JointPose::paddedSize() 크기로 할당하고 모든 비율을 0 으로 초기화
+  void resize(size_t paddedSize);
+};
+
+/**
+ * PoseBlending 네임스페이스
+ *
+ * SoA 로 저장된 JointPose 들을 보간 및 블렌딩하고, 블렌딩된 포즈로 joint 들의 model space transform 을 계산하는 함수들
+ *
+ * 보간 및 블렌딩은 SSE2 를 지원하면 joint 4개씩 SIMD 로 처리하며,
+ * translation, scale 은 선형 보간하고 rotation 은 quaternion 선형 보간 후 정규화(nlerp)함.
+ */
+namespace PoseBlending
+{
+  // from 과 to 를 joint 별 비율(weights)로 보간하여 out 에 기록 (키프레임 보간에 사용)
+  void interpolate(const JointPose &from, const JointPose &to, const JointBlendWeights &weights, JointPose &out);
+
+  // from 과 to 를 모든 joint 에 같은 비율(weight)로 블렌딩하여 out 에 기록 (애니메이션 간 cross-fade 에 사용)
+  void blend(const JointPose &from, const JointPose &to, float weight, JointPose &out);
+
+  /**
+   * 포즈의 local transform 들을 부모 joint 부터 차례로 곱하여 joint 별 model space transform 계산
+   *
+   * parents 는 부모 joint 가 항상 자식 joint 보다 앞에 오는 순서여야 함. (Skeleton 참고)
+   */
+  void computeModelTransforms(const std::vector<int> &parents, const JointPose &pose, std::vector<glm::mat4> &transforms);
+} // namespace PoseBlending
+
+#endif /* POSE_BLENDING_HPP */
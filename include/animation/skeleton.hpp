@@ -0,0 +1,106 @@
+#ifndef SKELETON_HPP
+#define SKELETON_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include "scene/scene_graph.hpp"
+
+/**
+ * JointPose 구조체
+ *
+ * skeleton 의 모든 joint 의 부모 기준 local transform 을 translation, rotation(quaternion), scale 로 분해하여
+ * 성분별 배열(SoA)로 저장하는 구조체
+ *
+ * -> 포즈 보간 및 블렌딩은 모든 joint 에 같은 연산을 반복하므로, 성분별로 연속된 배열에 두면 joint 4개씩 SIMD 로 처리할 수 있음.
+ * -> 배열 크기는 4의 배수로 올려서 할당하고 남는 lane 은 항등 변환으로 채워두므로, SIMD 루프에서 나머지 joint 를 따로 처리할 필요가 없음.
+ */
+struct JointPose
+{
+  std::vector<float> translationX;
+  std::vector<float> translationY;
+  std::vector<float> translationZ;
+  std::vector<float> rotationX;
+  std::vector<float> rotationY;
+  std::vector<float> rotationZ;
+  std::vector<float> rotationW;
+  std::vector<float> scaleX;
+  std::vector<float> scaleY;
+  std::vector<float> scaleZ;
+
+  // jointCount 개의 joint 를 저장할 수 있도록 배열을 4의 배수 크기로 할당하고 모든 joint 를 항등 변환으로 초기화
+  void resize(size_t jointCount);
+
+  void set(size_t joint, const glm::vec3 &translation, const glm::quat &rotation, const glm::vec3 &scale);
+
+  // joint 의 local transform 을 행렬로 조립 (translation * rotation * scale)
+  glm::mat4 getMatrix(size_t joint) const;
+
+  size_t size() const;
+
+  // SIMD 처리 단위(4)로 올림된 배열 크기
+  size_t paddedSize() const;
+
+private:
+  size_t jointCount = 0;
+};
+
+/**
+ * Skeleton 클래스
+ *
+ * skinning 에 사용되는 joint 계층 구조와 bone 목록을 저장하는 클래스
+ *
+ * joint 는 Model 의 scene graph 노드와 1:1 로 대응하며 (joint i == scene graph 노드 i),
+ * 노드들이 전위 순회 순서로 저장되어 있으므로 부모 joint 는 항상 자식 joint 보다 앞에 위치함.
+ *
+ * bone 은 aiMesh 의 정점들이 참조하는 joint 들로, 정점의 bone ID 는 joint 인덱스가 아니라 bone 인덱스를 가리킴.
+ * -> joint 는 scene graph 의 모든 노드를 포함하므로 개수가 많지만, bone palette 에는 실제로 정점이 참조하는 bone 만 업로드함.
+ */
+class Skeleton
+{
+public:
+  // scene graph 의 노드 계층 구조와 각 노드의 local transform 으로 joint 계층 구조 및 bind pose 생성
+  void build(const SceneGraph &sceneGraph);
+
+  /**
+   * joint 를 bone 으로 등록하고 bone 인덱스를 반환 (이미 등록된 bone 이면 기존 인덱스 반환)
+   *
+   * @param offsetMatrix mesh space 정점을 bone 의 local space 로 변환하는 행렬 (inverse bind matrix)
+   * @return bone 인덱스 (joint 를 찾지 못하면 -1)
+   */
+  int addBone(const std::string &name, const glm::mat4 &offsetMatrix);
+
+  // 이름으로 bone 인덱스 검색 (찾지 못하면 -1 반환, 로드 이후에는 여러 스레드에서 동시에 호출 가능)
+  int findBone(const std::string &name) const;
+
+  // 이름으로 joint 인덱스 검색 (찾지 못하면 -1 반환)
+  int findJoint(const std::string &name) const;
+
+  size_t getJointCount() const;
+  size_t getBoneCount() const;
+
+  const std::vector<int> &getParents() const;
+  const JointPose &getBindPose() const;
+
+  // bone 별 joint 인덱스 및 inverse bind matrix
+  const std::vector<int> &getBoneJoints() const;
+  const std::vector<glm::mat4> &getBoneOffsets() const;
+
+private:
+  std::vector<int> parents;
+  JointPose bindPose;
+  std::unordered_map<std::string, int> jointIndices;
+
+  std::vector<int> boneJoints;
+  std::vector<glm::mat4> boneOffsets;
+  std::unordered_map<std::string, int> boneIndices;
+};
+
+#endif /* SKELETON_HPP */
@@ -7,14 +7,22 @@
 */
 
 #include <memory>
+#include <chrono>
 #include "shader/shader.hpp"
+#include "shader/program_binary_cache.hpp"
+#include "shader/pbr_shader_variants.hpp"
+#include "shader/shader_watcher.hpp"
 #include "common/controller.hpp"
+#include "common/render_stats.hpp"
+#include "common/frame_uniforms.hpp"
 #include "features/material_feature.hpp"
 #include "features/camera_feature.hpp"
 #include "features/light_feature.hpp"
 #include "features/offscreen_rendering_feature.hpp"
 #include "features/ibl_feature.hpp"
 #include "features/model_feature.hpp"
+#include "features/instancing_feature.hpp"
+#include "features/streaming_feature.hpp"
 
 /**
  * App 클래스
@@ -37,16 +45,43 @@ public:
   Controller<LightParameter> &getLightController();
   Controller<IBLParameter> &getIBLController();
   Controller<ModelParameter> &getModelController();
+  Controller<InstancingParameter> &getInstancingController();
+  Controller<StreamingParameter> &getStreamingController();
+
+  // 정규화된 커서 좌표 (윈도우 좌측 상단 기준 [0, 1]) 에서 선택된 Model 을 picking
+  void pickModel(float x, float y);
+
+  // 현재 프레임의 프로파일링 통계 getter
+  const RenderStats &getRenderStats() const;
 
 private:
   void initializeShaders();
   void initializeFeatures();
   void initializeControllers();
 
-  // Shaders
-  std::shared_ptr<Shader> pbrShader;
+  // 변경된 쉐이더 소스를 사용하는 쉐이더들의 reload 를 제출하고, 링크가 끝난 쉐이더들을 교체
+  void reloadShaders();
+
+  /*
+    App 생성이 시작된 시각
+
+    -> 멤버들은 선언 순서대로 생성되므로 가장 먼저 선언하여, 쉐이더 제출 및 Feature 생성자의 초기화 작업까지 시작 시간에 포함시킴.
+  */
+  std::chrono::steady_clock::time_point constructionStart;
+
+  /*
+    Shaders
+
+    -> Feature 들보다 먼저 선언하여, Feature 생성자에서 HDR 이미지 디코딩 및 모델 import 를 하는 동안
+    쉐이더 프로그램들이 드라이버에서 컴파일되도록 함.
+  */
+  PbrShaderVariants pbrShaders;
   std::shared_ptr<Shader> backgroundShader;
 
+  // 쉐이더 소스 디렉토리 변경 감시 및 매 프레임 조회한 변경된 파일 이름들 (매 프레임 재할당하지 않도록 멤버로 유지)
+  ShaderWatcher shaderWatcher;
+  std::vector<std::string> changedShaderFiles;
+
   // Features
   MaterialFeature materialFeature;
   CameraFeature cameraFeature;
@@ -54,6 +89,8 @@ private:
   OffscreenRenderingFeature offscreenRenderingFeature;
   IBLFeature iblFeature;
   ModelFeature modelFeature;
+  InstancingFeature instancingFeature;
+  StreamingFeature streamingFeature;
 
   // Controllers
   Controller<MaterialParameter> materialController;
@@ -61,6 +98,21 @@ private:
   Controller<LightParameter> lightController;
   Controller<IBLParameter> iblController;
   Controller<ModelParameter> modelController;
+  Controller<InstancingParameter> instancingController;
+  Controller<StreamingParameter> streamingController;
+
+  // 프로파일링 통계
+  RenderStats renderStats;
+
+  // App 생성부터 initialize() 완료까지 걸린 시간 (ms) 및 그 동안 쉐이더 프로그램을 캐시에서 읽거나 컴파일한 통계
+  float startupTimeMs;
+  ProgramBinaryCacheStats startupProgramStats;
+
+  // initialize() 완료까지 텍스쳐, 버퍼, VAO 래퍼 클래스들이 호출한 GL 함수 횟수
+  size_t startupGLCallCount;
+
+  // pbr 및 skybox 쉐이더가 공유하는 카메라, 광원, IBL uniform block
+  FrameUniforms frameUniforms;
 };
 
 #endif // APP_HPP
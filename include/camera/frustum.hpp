@@ -0,0 +1,91 @@
+#ifndef FRUSTUM_HPP
+#define FRUSTUM_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include "mesh/bounding_volume.hpp"
+
+/**
+ * BoundingSphereBatch 구조체
+ *
+ * 여러 개의 world space bounding sphere 를 SIMD 로 한꺼번에 검사할 수 있도록
+ * 성분별 배열(SoA, Structure of Arrays)로 저장하는 구조체
+ */
+struct BoundingSphereBatch
+{
+  std::vector<float> centerX;
+  std::vector<float> centerY;
+  std::vector<float> centerZ;
+  std::vector<float> radius;
+
+  void resize(size_t count)
+  {
+    centerX.resize(count);
+    centerY.resize(count);
+    centerZ.resize(count);
+    radius.resize(count);
+  }
+
+  void set(size_t index, const BoundingSphere &sphere)
+  {
+    centerX[index] = sphere.center.x;
+    centerY[index] = sphere.center.y;
+    centerZ[index] = sphere.center.z;
+    radius[index] = sphere.radius;
+  }
+
+  size_t size() const
+  {
+    return radius.size();
+  }
+};
+
+/**
+ * Frustum 클래스
+ *
+ * view-projection 행렬로부터 추출한 6개의 절두체 평면(left, right, bottom, top, near, far)을 저장하고,
+ * bounding volume 이 절두체 바깥에 있는지 검사하는 클래스
+ *
+ * 각 평면은 (normal.xyz, distance) 형태의 vec4 로 저장되며, normal 은 절두체 안쪽을 향하도록 정규화됨.
+ */
+class Frustum
+{
+public:
+  static constexpr int NUM_PLANES = 6;
+
+  Frustum();
+
+  // view-projection 행렬의 행(row)들을 조합하여 world space 기준 절두체 평면 추출 (Gribb & Hartmann 방식)
+  explicit Frustum(const glm::mat4 &viewProjection);
+
+  // world space AABB 가 절두체와 겹치거나 내부에 있으면 true 반환
+  bool intersects(const BoundingBox &box) const;
+
+  // world space bounding sphere 가 절두체와 겹치거나 내부에 있으면 true 반환
+  bool intersects(const BoundingSphere &sphere) const;
+
+  /**
+   * 여러 개의 bounding sphere 를 한꺼번에 검사하여 각 sphere 의 가시성(0 또는 1)을 visible 배열에 기록
+   *
+   * SSE 를 지원하는 환경에서는 sphere 4개를 하나의 레지스터에 담아 각 평면과의 거리를 동시에 계산하고,
+   * 그렇지 않은 환경에서는 scalar 코드로 동일한 검사를 수행함.
+   */
+  void cullSpheres(const BoundingSphereBatch &spheres, std::vector<std::uint8_t> &visible) const;
+
+  // spheres 의 [begin, end) 구간만 검사하여 visible[begin, end) 에 기록 (여러 스레드가 서로 다른 구간을 나눠서 검사할 때 사용)
+  void cullSpheres(const BoundingSphereBatch &spheres, size_t begin, size_t end, std::uint8_t *visible) const;
+
+  const std::array<glm::vec4, NUM_PLANES> &getPlanes() const;
+
+private:
+  std::array<glm::vec4, NUM_PLANES> planes;
+};
+
+#endif /* FRUSTUM_HPP */
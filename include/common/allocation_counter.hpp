@@ -0,0 +1,24 @@
+#ifndef ALLOCATION_COUNTER_HPP
+#define ALLOCATION_COUNTER_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <cstddef>
+
+/**
+ * AllocationCounter 네임스페이스
+ *
+ * 전역 operator new 를 교체하여 프로세스 시작 이후 발생한 heap 할당 횟수를 집계함.
+ * 렌더링 루프 전후의 횟수 차이로 매 프레임 발생하는 heap 할당을 확인하는 데 사용함.
+ * (ImGui 처럼 malloc() 을 직접 호출하는 라이브러리의 할당은 집계되지 않음)
+ */
+namespace AllocationCounter
+{
+  // 지금까지 operator new 가 호출된 횟수
+  size_t getCount();
+} // namespace AllocationCounter
+
+#endif /* ALLOCATION_COUNTER_HPP */
@@ -0,0 +1,83 @@
+#ifndef FRAME_UNIFORMS_HPP
+#define FRAME_UNIFORMS_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <vector>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include "shader/shader.hpp"
+#include "gl_objects/uniform_buffer_object.hpp"
+#include "constants/light_constants.hpp"
+
+/*
+  각 uniform block 의 std140 메모리 레이아웃과 같은 구조체들
+
+  -> std140 에서 vec3 및 vec3 배열 원소는 16 bytes 단위로 정렬되므로 vec4 로 선언하고 w 성분은 사용하지 않음.
+  -> bool 은 4 bytes 정수로 저장됨.
+*/
+struct CameraUniformBlock
+{
+  glm::mat4 projection = glm::mat4(1.0f);
+  glm::mat4 view = glm::mat4(1.0f);
+  glm::vec4 position = glm::vec4(0.0f); // (x, y, z, 사용 안함)
+};
+
+// 켜진 광원들이 배열 앞쪽에 모여 있으며, 쉐이더 변형은 LIGHT_COUNT 개만 읽음
+struct LightsUniformBlock
+{
+  glm::vec4 positions[LightConstants::NUM_LIGHTS] = {};
+  glm::vec4 colors[LightConstants::NUM_LIGHTS] = {}; // intensity 가 곱해진 색상
+};
+
+// IBL 적용 여부는 쉐이더 변형(IBL_ENABLED)으로 결정되므로 intensity 만 전달
+struct IblUniformBlock
+{
+  float intensity = 0.0f;
+  float padding[3] = {};
+};
+
+static_assert(sizeof(CameraUniformBlock) == 144, "CameraUniformBlock must match the std140 layout");
+static_assert(sizeof(LightsUniformBlock) == 32 * LightConstants::NUM_LIGHTS, "LightsUniformBlock must match the std140 layout");
+static_assert(sizeof(IblUniformBlock) == 16, "IblUniformBlock must match the std140 layout");
+
+/**
+ * FrameUniforms 클래스
+ *
+ * 여러 쉐이더가 공통으로 사용하는 카메라, 광원, IBL 데이터를 uniform block 으로 관리하는 클래스.
+ *
+ * 세 block 을 하나의 UBO 에 GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT 단위로 나눠 담고, 각 영역을 고정된 binding point 에 한번만 연결해 둠.
+ * -> 각 Feature 는 process() 또는 파라미터 setter 에서 CPU 측 block 만 갱신하고,
+ * App 이 그리기 전에 upload() 로 버퍼 전체를 한번의 glBufferSubData() 로 업로드함.
+ * -> uniform 을 전송하기 위해 쉐이더 프로그램을 바꿀 필요가 없으며, 같은 데이터를 쉐이더마다 따로 전송하지 않음.
+ */
+class FrameUniforms
+{
+public:
+  // UBO 를 생성하고 각 block 영역을 binding point 에 연결 (OpenGL 컨텍스트 생성 이후 호출)
+  void initialize();
+
+  // 쉐이더의 uniform block 들을 binding point 에 연결 (쉐이더에 없는 block 은 무시됨)
+  void attachShader(const Shader &shader) const;
+
+  // CPU 측 block 들을 UBO 에 업로드
+  void upload();
+
+  CameraUniformBlock camera;
+  LightsUniformBlock lights;
+  IblUniformBlock ibl;
+
+private:
+  UniformBufferObject ubo;
+
+  // 각 block 의 UBO 내 offset (bytes) 및 업로드할 데이터를 모아두는 배열
+  GLintptr cameraOffset = 0;
+  GLintptr lightsOffset = 0;
+  GLintptr iblOffset = 0;
+  std::vector<std::uint8_t> staging;
+};
+
+#endif /* FRAME_UNIFORMS_HPP */
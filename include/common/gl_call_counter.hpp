@@ -0,0 +1,27 @@
+#ifndef GL_CALL_COUNTER_HPP
+#define GL_CALL_COUNTER_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <cstddef>
+
+/**
+ * GLCallCounter 네임스페이스
+ *
+ * 텍스쳐, 버퍼, VAO 래퍼 클래스들이 객체를 생성, 설정, 바인딩하면서 호출한 GL 함수 횟수를 집계함.
+ * 시작 시점 및 렌더링 루프 전후의 횟수 차이로 DSA 경로와 bind / unbind 경로의 호출 횟수를 비교하는 데 사용함.
+ * (draw call, 쉐이더 uniform 설정, FBO 처럼 두 경로의 차이가 없거나 래퍼 클래스를 거치지 않는 GL 호출은 집계되지 않음)
+ */
+namespace GLCallCounter
+{
+  // 래퍼 클래스에서 GL 함수를 count 회 호출했음을 기록 (GL 호출은 main 스레드에서만 발생하므로 동기화하지 않음)
+  void add(size_t count);
+
+  // 지금까지 기록된 GL 함수 호출 횟수
+  size_t getCount();
+} // namespace GLCallCounter
+
+#endif /* GL_CALL_COUNTER_HPP */
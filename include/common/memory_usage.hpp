@@ -0,0 +1,26 @@
+#ifndef MEMORY_USAGE_HPP
+#define MEMORY_USAGE_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <cstddef>
+
+/**
+ * MemoryUsage 네임스페이스
+ *
+ * 현재 프로세스의 물리 메모리 사용량(RSS, Resident Set Size)을 조회하는 함수들.
+ * Linux 에서는 /proc/self/status 를 읽어서 계산하며, 지원하지 않는 플랫폼에서는 0 을 반환함.
+ */
+namespace MemoryUsage
+{
+  // 현재 RSS (bytes)
+  size_t getCurrentRss();
+
+  // 프로세스 시작 이후 최대 RSS (bytes)
+  size_t getPeakRss();
+} // namespace MemoryUsage
+
+#endif /* MEMORY_USAGE_HPP */
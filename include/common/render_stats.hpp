@@ -0,0 +1,168 @@
+#ifndef RENDER_STATS_HPP
+#define RENDER_STATS_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <array>
+#include <vector>
+#include <cstddef>
+#include <constants/model_constants.hpp>
+#include <shader/shader_variant_cache.hpp>
+
+/**
+ * RenderStats 구조체
+ *
+ * 각 Feature 클래스들이 렌더링 루프에서 집계하는 프로파일링 통계.
+ * App 클래스가 소유하며, 매 프레임 시작 시 reset() 으로 초기화됨.
+ */
+struct RenderStats
+{
+  // LOD 별로 그려진 mesh 및 삼각형 개수
+  std::array<unsigned int, ModelConstants::NUM_LODS> lodMeshCounts;
+  std::array<unsigned int, ModelConstants::NUM_LODS> lodTriangleCounts;
+
+  // frustum culling 을 통과하여 draw call 이 제출된 mesh 및 culling 된 mesh 개수
+  unsigned int submittedMeshCount;
+  unsigned int culledMeshCount;
+
+  // meshlet culling 으로 검사한 meshlet 개수, 그 중 culling 된 meshlet 및 삼각형 개수와 검사에 걸린 CPU 시간 (ms)
+  unsigned int meshletCount;
+  unsigned int culledMeshletCount;
+  unsigned int meshletCulledTriangleCount;
+  float meshletCullTimeMs;
+
+  // 그려진 Model 의 scene graph 노드 개수 및 이번 프레임에 world transform 이 갱신된 노드 개수
+  unsigned int sceneNodeCount;
+  unsigned int updatedSceneNodeCount;
+
+  // 텍스쳐 캐시에 상주하는 텍스쳐 개수 및 추정 GPU 메모리 크기 (bytes)
+  unsigned int cachedTextureCount;
+  size_t cachedTextureBytes;
+
+  // StreamingFeature 가 백그라운드에서 chunk 파일을 변환하는 중인지 여부
+  bool streamingConverting;
+
+  // StreamingFeature 의 chunk 개수, 상주 / 읽기 중 / 그려진 chunk 개수
+  unsigned int streamingChunkCount;
+  unsigned int streamingResidentChunkCount;
+  unsigned int streamingLoadingChunkCount;
+  unsigned int streamingDrawnChunkCount;
+
+  // 상주 및 읽기 중인 chunk 의 총 크기, 메모리 예산 및 이번 프레임에 업로드한 크기 (bytes)
+  size_t streamingResidentBytes;
+  size_t streamingMemoryBudget;
+  size_t streamingUploadedBytes;
+
+  // 애니메이션 갱신으로 처리한 joint 개수와 이에 걸린 CPU 시간 (ms), skinning 되어 그려진 정점 개수
+  unsigned int animatedJointCount;
+  float animationTimeMs;
+  unsigned int skinnedVertexCount;
+
+  // 선택된 Model 의 BVH 노드 개수, 생성에 걸린 CPU 시간 (ms) 및 모델 로드 후 측정한 광선 처리량 (Mrays/s)
+  unsigned int bvhNodeCount;
+  float bvhBuildTimeMs;
+  float bvhClosestHitMrays;
+  float bvhAnyHitMrays;
+
+  // 마지막 mouse picking 으로 선택된 Mesh 인덱스 (교차하지 않았으면 -1) 및 검사에 걸린 CPU 시간 (ms)
+  int pickedMeshIndex;
+  float pickTimeMs;
+
+  // scene 오브젝트 개수, RenderQueue 에 제출된 명령 개수, 정렬된 순서로 그리면서 발생한 상태 변경 횟수 및 정렬에 걸린 CPU 시간 (ms)
+  unsigned int sceneObjectCount;
+  unsigned int renderQueueCommandCount;
+  unsigned int programBindCount;
+  unsigned int materialBindCount;
+  unsigned int textureBindCount;
+  float renderQueueSortTimeMs;
+
+  // App 초기화에 걸린 시간 및 그 동안 캐시된 바이너리로 생성하거나 소스로부터 컴파일한 쉐이더 프로그램 개수와 소요 시간 (ms)
+  float startupTimeMs;
+  unsigned int startupProgramLoadedCount;
+  unsigned int startupProgramCompiledCount;
+  float startupProgramLoadTimeMs;
+  float startupProgramCompileTimeMs;
+  float startupProgramLinkWaitTimeMs; // 컴파일 시간 중 링크 결과를 기다린 시간
+  float startupProgramOverlapTimeMs;  // 제출 후 링크 결과를 조회하기까지 다른 초기화 작업과 겹쳐서 진행된 시간
+
+  // 생성된 pbr 쉐이더 변형별 가장 최근에 측정된 GPU 처리 시간 (reset() 은 capacity 를 유지하므로 변형이 늘어날 때만 재할당)
+  std::vector<ShaderVariantStats> shaderVariants;
+
+  // 렌더링 루프(App::process()) 에서 발생한 heap 할당 횟수
+  unsigned int heapAllocationCount;
+
+  // 텍스쳐, 버퍼, VAO 래퍼 클래스들이 렌더링 루프 및 App 초기화 동안 호출한 GL 함수 횟수와 DSA 경로 사용 여부
+  unsigned int glCallCount;
+  unsigned int startupGLCallCount;
+  bool directStateAccess;
+
+  // 실제로 호출된 draw call 개수 (multi draw indirect 는 여러 mesh 를 그려도 1 회로 집계)
+  unsigned int drawCallCount;
+
+  // InstancingFeature 가 그린 인스턴스 개수, 이를 위해 호출한 draw call 개수 및 CPU 제출 시간과 GPU 처리 시간 (ms)
+  unsigned int instanceCount;
+  unsigned int instancingDrawCallCount;
+  float instancingCpuTimeMs;
+  float instancingGpuTimeMs;
+
+  void reset()
+  {
+    lodMeshCounts.fill(0);
+    lodTriangleCounts.fill(0);
+    submittedMeshCount = 0;
+    culledMeshCount = 0;
+    meshletCount = 0;
+    culledMeshletCount = 0;
+    meshletCulledTriangleCount = 0;
+    meshletCullTimeMs = 0.0f;
+    sceneNodeCount = 0;
+    updatedSceneNodeCount = 0;
+    cachedTextureCount = 0;
+    cachedTextureBytes = 0;
+    streamingConverting = false;
+    streamingChunkCount = 0;
+    streamingResidentChunkCount = 0;
+    streamingLoadingChunkCount = 0;
+    streamingDrawnChunkCount = 0;
+    streamingResidentBytes = 0;
+    streamingMemoryBudget = 0;
+    streamingUploadedBytes = 0;
+    animatedJointCount = 0;
+    animationTimeMs = 0.0f;
+    skinnedVertexCount = 0;
+    bvhNodeCount = 0;
+    bvhBuildTimeMs = 0.0f;
+    bvhClosestHitMrays = 0.0f;
+    bvhAnyHitMrays = 0.0f;
+    pickedMeshIndex = -1;
+    pickTimeMs = 0.0f;
+    sceneObjectCount = 0;
+    renderQueueCommandCount = 0;
+    programBindCount = 0;
+    materialBindCount = 0;
+    textureBindCount = 0;
+    renderQueueSortTimeMs = 0.0f;
+    startupTimeMs = 0.0f;
+    startupProgramLoadedCount = 0;
+    startupProgramCompiledCount = 0;
+    startupProgramLoadTimeMs = 0.0f;
+    startupProgramCompileTimeMs = 0.0f;
+    startupProgramLinkWaitTimeMs = 0.0f;
+    startupProgramOverlapTimeMs = 0.0f;
+    shaderVariants.clear();
+    heapAllocationCount = 0;
+    glCallCount = 0;
+    startupGLCallCount = 0;
+    directStateAccess = false;
+    drawCallCount = 0;
+    instanceCount = 0;
+    instancingDrawCallCount = 0;
+    instancingCpuTimeMs = 0.0f;
+    instancingGpuTimeMs = 0.0f;
+  }
+};
+
+#endif /* RENDER_STATS_HPP */
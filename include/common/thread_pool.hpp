@@ -0,0 +1,88 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+/**
+ * ThreadPool 클래스
+ *
+ * 생성 시 미리 만들어둔 worker 스레드들에 작업을 나눠서 실행하는 스레드 풀.
+ *
+ * parallelFor() 는 [0, count) 구간을 grainSize 크기의 작은 구간들로 나누고,
+ * worker 스레드들과 호출한 스레드가 atomic counter 로 구간을 하나씩 가져가며 실행함.
+ * -> 작업 함수를 std::function 으로 감싸지 않고 함수 포인터 + context 포인터로 전달하므로,
+ * 매 프레임 호출해도 heap 할당이 발생하지 않음.
+ */
+class ThreadPool
+{
+public:
+  // workerCount 개의 worker 스레드 생성 (0 이면 모든 작업을 호출한 스레드에서 실행)
+  explicit ThreadPool(size_t workerCount = getDefaultWorkerCount());
+
+  // 모든 worker 스레드 종료
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  /**
+   * [0, count) 구간을 grainSize 단위로 나눠 function(begin, end) 을 병렬로 실행하고, 모든 구간이 끝나면 반환
+   *
+   * 한번에 하나의 스레드에서만 호출해야 하며, function 은 서로 다른 구간에 대해 동시에 호출되어도 안전해야 함.
+   */
+  template <typename Function>
+  void parallelFor(size_t count, size_t grainSize, Function &&function)
+  {
+    using FunctionType = std::remove_reference_t<Function>;
+    run(count, grainSize, [](void *context, size_t begin, size_t end)
+        { (*static_cast<FunctionType *>(context))(begin, end); },
+        const_cast<void *>(static_cast<const void *>(&function)));
+  }
+
+  size_t getWorkerCount() const;
+
+  // 호출한 스레드를 제외한 하드웨어 스레드 개수
+  static size_t getDefaultWorkerCount();
+
+private:
+  using RangeFunction = void (*)(void *context, size_t begin, size_t end);
+
+  void run(size_t count, size_t grainSize, RangeFunction function, void *context);
+
+  // worker 스레드의 대기 및 실행 루프
+  void workerLoop();
+
+  // 남은 구간이 없을 때까지 구간을 하나씩 가져와서 실행
+  void processRanges();
+
+  std::vector<std::thread> workers;
+
+  std::mutex mutex;
+  std::condition_variable workAvailable;
+  std::condition_variable workFinished;
+
+  // 새 작업이 시작될 때마다 증가하여 worker 들이 새 작업을 인식하도록 함
+  size_t generation = 0;
+  size_t activeWorkers = 0;
+  bool stopping = false;
+
+  // 현재 실행 중인 작업
+  RangeFunction rangeFunction = nullptr;
+  void *rangeContext = nullptr;
+  size_t rangeCount = 0;
+  size_t rangeGrainSize = 1;
+  std::atomic<size_t> nextIndex{0};
+};
+
+#endif /* THREAD_POOL_HPP */
@@ -0,0 +1,47 @@
+#ifndef ANIMATION_CONSTANTS_HPP
+#define ANIMATION_CONSTANTS_HPP
+
+#include <cstddef>
+#include <glm/glm.hpp>
+
+/**
+ * Animation 관련 심볼릭 상수 정의
+ *
+ * 일반적으로 권장되는 심볼릭 상수 정의 방식은 아래와 같음.
+ *
+ * 1. 헤더 파일 안에 한 곳에 모아서
+ * 2. 네임스페이스로 논리적 그룹을 묶어서
+ * 3. constexpr 로 선언
+ *
+ * https://github.com/jooo0922/cpp-study/blob/main/TBCppStudy/Chapter2_9/MY_CONSTANTS.h 참고
+ */
+namespace AnimationConstants
+{
+  /*
+    bone palette 에 저장할 수 있는 최대 bone 개수 (pbr.vs 의 MAX_BONES 와 같아야 함)
+
+    -> skinning 행렬(mat4) 128 개와 노멀 행렬(std140 mat3) 128 개는 14 KB 로, OpenGL 이 보장하는 최소 uniform block 크기(16 KB) 안에 들어감.
+    -> 정점의 bone ID 는 unsigned byte 로 압축되므로 256 을 넘을 수 없음.
+  */
+  constexpr size_t MAX_BONES = 128;
+
+  // bone palette UBO 를 연결할 uniform block binding point
+  constexpr unsigned int BONE_PALETTE_BINDING = 0;
+
+  // 키프레임 시간 단위(tick)가 지정되지 않은 애니메이션에 적용할 초당 tick 수 (Assimp 의 기본값을 따름)
+  constexpr float DEFAULT_TICKS_PER_SECOND = 25.0f;
+
+  // 다른 애니메이션으로 전환할 때 이전 포즈와 섞는 cross-fade 시간 (초)
+  constexpr float CROSS_FADE_DURATION = 0.3f;
+
+  constexpr bool ANIMATE_DEFAULT = true;
+  constexpr const char ANIMATE_UI_LABEL[] = "animate";
+
+  constexpr float SPEED_DEFAULT = 1.0f;
+  constexpr float SPEED_MIN = 0.0f;
+  constexpr float SPEED_MAX = 4.0f;
+  constexpr float SPEED_UI_SPEED = 0.01f;
+  constexpr const char SPEED_UI_LABEL[] = "animation speed";
+}
+
+#endif /* ANIMATION_CONSTANTS_HPP */
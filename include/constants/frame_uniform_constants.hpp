@@ -0,0 +1,32 @@
+#ifndef FRAME_UNIFORM_CONSTANTS_HPP
+#define FRAME_UNIFORM_CONSTANTS_HPP
+
+/**
+ * 프레임마다 갱신되는 uniform block 관련 심볼릭 상수 정의
+ *
+ * 일반적으로 권장되는 심볼릭 상수 정의 방식은 아래와 같음.
+ *
+ * 1. 헤더 파일 안에 한 곳에 모아서
+ * 2. 네임스페이스로 논리적 그룹을 묶어서
+ * 3. constexpr 로 선언
+ *
+ * https://github.com/jooo0922/cpp-study/blob/main/TBCppStudy/Chapter2_9/MY_CONSTANTS.h 참고
+ */
+namespace FrameUniformConstants
+{
+  /*
+    각 uniform block 을 연결할 binding point (AnimationConstants::BONE_PALETTE_BINDING 과 겹치지 않아야 함)
+
+    -> GLSL 330 에서는 layout(binding = N) 을 지정할 수 없으므로, 쉐이더의 block 이름으로 조회하여 연결함.
+  */
+  constexpr unsigned int CAMERA_BINDING = 1;
+  constexpr unsigned int LIGHTS_BINDING = 2;
+  constexpr unsigned int IBL_BINDING = 3;
+
+  // 쉐이더에 선언된 uniform block 이름 (pbr.vs, pbr.fs, background.vs 참고)
+  constexpr const char CAMERA_BLOCK_NAME[] = "Camera";
+  constexpr const char LIGHTS_BLOCK_NAME[] = "Lights";
+  constexpr const char IBL_BLOCK_NAME[] = "IBL";
+}
+
+#endif /* FRAME_UNIFORM_CONSTANTS_HPP */
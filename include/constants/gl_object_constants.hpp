@@ -0,0 +1,26 @@
+#ifndef GL_OBJECT_CONSTANTS_HPP
+#define GL_OBJECT_CONSTANTS_HPP
+
+/**
+ * GL 객체 래퍼 클래스 관련 심볼릭 상수 정의
+ *
+ * 일반적으로 권장되는 심볼릭 상수 정의 방식은 아래와 같음.
+ *
+ * 1. 헤더 파일 안에 한 곳에 모아서
+ * 2. 네임스페이스로 논리적 그룹을 묶어서
+ * 3. constexpr 로 선언
+ *
+ * https://github.com/jooo0922/cpp-study/blob/main/TBCppStudy/Chapter2_9/MY_CONSTANTS.h 참고
+ */
+namespace GLObjectConstants
+{
+  /*
+    GL 4.5 (또는 ARB_direct_state_access) 를 지원할 때 Direct State Access 경로 사용 여부
+
+    -> false 로 바꾸면 지원하는 드라이버에서도 기존 bind / unbind 경로로 동작하므로,
+    두 경로의 GL 호출 횟수를 같은 환경에서 비교할 수 있음. (통계 UI 의 GL calls 항목 참고)
+  */
+  constexpr bool DIRECT_STATE_ACCESS_ENABLED = true;
+}
+
+#endif /* GL_OBJECT_CONSTANTS_HPP */
@@ -0,0 +1,60 @@
+#ifndef INSTANCING_CONSTANTS_HPP
+#define INSTANCING_CONSTANTS_HPP
+
+#include <array>
+#include <glm/glm.hpp>
+
+/**
+ * Instancing 관련 심볼릭 상수 정의
+ *
+ * 일반적으로 권장되는 심볼릭 상수 정의 방식은 아래와 같음.
+ *
+ * 1. 헤더 파일 안에 한 곳에 모아서
+ * 2. 네임스페이스로 논리적 그룹을 묶어서
+ * 3. constexpr 로 선언
+ *
+ * https://github.com/jooo0922/cpp-study/blob/main/TBCppStudy/Chapter2_9/MY_CONSTANTS.h 참고
+ */
+namespace InstancingConstants
+{
+  constexpr bool ENABLED_DEFAULT = false;
+  constexpr const char ENABLED_UI_LABEL[] = "show sphere grid";
+
+  constexpr bool USE_INSTANCING_DEFAULT = true;
+  constexpr const char USE_INSTANCING_UI_LABEL[] = "hardware instancing";
+
+  constexpr int NUM_GRID_SIZES = 4;
+
+  struct GridSize
+  {
+    const char *label;
+    int size; // 한 변에 배치할 구체 개수
+  };
+
+  constexpr std::array<GridSize, NUM_GRID_SIZES> GRID_SIZES = {{
+      {"7 x 7", 7},
+      {"32 x 32", 32},
+      {"100 x 100", 100},
+      {"200 x 200", 200},
+  }};
+
+  constexpr int GRID_SIZE_INDEX_DEFAULT = 0;
+  constexpr const char GRID_SIZE_SELECTOR_UI_LABEL[] = "grid size";
+
+  // 구체 grid 가 배치되는 xy 평면 상의 한 변의 길이 및 z 위치 (grid 크기와 무관하게 같은 영역을 채우도록 구체 크기를 조절함)
+  constexpr float GRID_EXTENT = 20.0f;
+  constexpr float GRID_DEPTH = -10.0f;
+
+  // grid 한 칸의 크기 대비 구체 반지름 비율
+  constexpr float SPHERE_RADIUS_RATIO = 0.4f;
+
+  // grid 의 각 행은 metallic, 각 열은 roughness 가 [ROUGHNESS_MIN, 1] 범위에서 증가하도록 배치됨
+  constexpr float ROUGHNESS_MIN = 0.05f;
+  constexpr float AMBIENT_OCCLUSION = 1.0f;
+  constexpr glm::vec3 ALBEDO = glm::vec3(0.5f, 0.0f, 0.0f);
+
+  // GPU timer query 를 몇 프레임에 걸쳐 돌려가며 사용할지 (결과를 기다리느라 렌더링 루프가 멈추지 않도록 함)
+  constexpr int NUM_TIMER_QUERIES = 3;
+}
+
+#endif /* INSTANCING_CONSTANTS_HPP */
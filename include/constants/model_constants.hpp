@@ -53,6 +53,64 @@ namespace ModelConstants
 
   constexpr int MODEL_INDEX_DEFAULT = 0;
   constexpr const char MODEL_SELECTOR_UI_LABEL[] = "select Models";
+
+  // 모델 로드 시 각 Mesh 마다 생성할 LOD 개수 (LOD 0 은 원본 mesh)
+  constexpr int NUM_LODS = 4;
+
+  // 원본 mesh 대비 각 LOD 의 목표 삼각형 개수 비율
+  constexpr std::array<float, NUM_LODS> LOD_TRIANGLE_RATIOS = {1.0f, 0.5f, 0.25f, 0.125f};
+
+  // 이전 LOD 대비 삼각형 개수가 이 비율 이상으로 남으면 (= 단순화가 거의 안되면) 더 이상 LOD 를 생성하지 않음
+  constexpr float LOD_MIN_REDUCTION_RATIO = 0.9f;
+
+  // bounding sphere 의 화면상 지름(pixel)이 이 값보다 작아지면 해당 LOD 로 전환 (LOD 0 은 항상 사용 가능하므로 값이 무시됨)
+  constexpr std::array<float, NUM_LODS> LOD_SCREEN_SIZES = {0.0f, 480.0f, 240.0f, 120.0f};
+
+  // 여러 Model 의 Mesh 들이 공유하는 GeometryArena 의 초기 정점 및 인덱스 용량 (부족하면 2배씩 확장됨)
+  constexpr size_t GEOMETRY_ARENA_INITIAL_VERTEX_COUNT = 1 << 18;
+  constexpr size_t GEOMETRY_ARENA_INITIAL_INDEX_COUNT = 1 << 20;
+
+  // LOD 전환 경계 부근에서 LOD 가 매 프레임 바뀌며 popping 이 발생하지 않도록 적용할 hysteresis 비율
+  constexpr float LOD_HYSTERESIS = 0.1f;
+}
+
+namespace MeshletConstants
+{
+  // meshlet 하나에 포함될 최대 정점 및 삼각형 개수 (mesh shader 에서 일반적으로 권장되는 64 / 124 를 따름)
+  constexpr size_t MAX_VERTICES = 64;
+  constexpr size_t MAX_TRIANGLES = 124;
+
+  // 스레드 풀의 작업 하나가 검사할 meshlet 개수
+  constexpr size_t CULL_BATCH_SIZE = 256;
+}
+
+namespace BvhConstants
+{
+  // SAH 분할 위치를 찾을 때 노드의 centroid 범위를 축마다 나눌 bin 개수
+  constexpr int NUM_BINS = 16;
+
+  // SAH 비용 계산 시 노드 AABB 검사 비용 대비 삼각형 교차 검사 비용의 비율
+  constexpr float TRAVERSAL_COST = 1.0f;
+  constexpr float INTERSECTION_COST = 1.0f;
+
+  /*
+    이 깊이부터는 SAH 대신 삼각형 개수를 절반으로 나누는 median 분할을 사용
+
+    -> SAH 분할이 한쪽으로 치우쳐서 트리가 깊어져도 순회 stack(TRAVERSAL_STACK_SIZE)을 넘지 않도록 깊이를 제한함.
+  */
+  constexpr int MAX_SAH_DEPTH = 32;
+  constexpr int TRAVERSAL_STACK_SIZE = 64;
+
+  /*
+    모델 로드 직후 BVH 의 광선 처리량(Mrays/s)을 측정할지 여부
+
+    -> 모델마다 closest-hit 및 any-hit 광선을 BENCHMARK_RAY_COUNT 개씩 쏘므로 시작 시간이 늘어남. BVH 성능을 비교할 때만 켬.
+  */
+  constexpr bool BENCHMARK_ENABLED = false;
+
+  // 모델 로드 후 Mrays/s 를 측정할 때 쏘는 광선 개수 및 광선 생성 seed
+  constexpr size_t BENCHMARK_RAY_COUNT = 1 << 18;
+  constexpr unsigned int BENCHMARK_SEED = 1234;
 }
 
 #endif /* MODEL_CONSTANTS_HPP */
@@ -25,6 +25,12 @@ namespace OffscreenRenderingConstants
   constexpr int NUM_CUBE_MAP_FACES = 6;
   constexpr int NUM_HDR_IMAGES = 4;
 
+  // HDR 큐브맵의 mip level 개수 -> bright dot artifact 해결을 위해 512 * 512 부터 1 * 1 까지 전체 mip chain 할당 (log2(512) + 1)
+  constexpr int ENV_CUBEMAP_MIP_LEVELS = 10;
+
+  // pre-filtered env map 의 mip level 개수 -> roughness 단계별로 렌더링할 level 만 할당 (pbr.fs 의 MAX_REFLECTION_LOD 는 이 값 - 1 과 같아야 함)
+  constexpr int PREFILTER_MAP_MIP_LEVELS = 5;
+
   struct HDRImage
   {
     const char *label;
@@ -0,0 +1,67 @@
+#ifndef SCENE_CONSTANTS_HPP
+#define SCENE_CONSTANTS_HPP
+
+#include <array>
+#include <glm/glm.hpp>
+
+/**
+ * Scene 관련 심볼릭 상수 정의
+ *
+ * 일반적으로 권장되는 심볼릭 상수 정의 방식은 아래와 같음.
+ *
+ * 1. 헤더 파일 안에 한 곳에 모아서
+ * 2. 네임스페이스로 논리적 그룹을 묶어서
+ * 3. constexpr 로 선언
+ *
+ * https://github.com/jooo0922/cpp-study/blob/main/TBCppStudy/Chapter2_9/MY_CONSTANTS.h 참고
+ */
+namespace SceneConstants
+{
+  constexpr bool ENABLED_DEFAULT = false;
+  constexpr const char ENABLED_UI_LABEL[] = "render scene";
+
+  // scene 오브젝트들이 배치되는 xz 평면 grid 의 열 및 행 개수 (첫 번째 행이 카메라에 가장 가깝고 -z 방향으로 멀어짐)
+  constexpr int GRID_COLUMNS = 12;
+  constexpr int GRID_ROWS = 8;
+
+  // grid 한 칸의 크기, grid 가 놓이는 높이 및 첫 번째 행의 z 위치
+  constexpr float GRID_SPACING = 1.5f;
+  constexpr float GRID_HEIGHT = -1.0f;
+  constexpr float GRID_FRONT_Z = 0.0f;
+
+  // 모델마다 크기가 다르므로, 각 모델의 AABB 를 감싸는 구의 반지름이 이 값이 되도록 크기를 맞춰서 배치함
+  constexpr float OBJECT_RADIUS = 0.6f;
+
+  // 오브젝트마다 다르게 적용할 y 축 회전 각도 간격 (degree)
+  constexpr float OBJECT_YAW_STEP = 47.0f;
+
+  constexpr int NUM_MATERIALS = 6;
+
+  struct Material
+  {
+    const char *label;
+    glm::vec3 albedo;
+    float metallic;
+    float roughness;
+    float ao;
+  };
+
+  // scene 오브젝트들이 돌려가며 사용하는 material 프리셋
+  constexpr std::array<Material, NUM_MATERIALS> materials = {{
+      {"Red plastic", glm::vec3(0.5f, 0.0f, 0.0f), 0.0f, 0.4f, 1.0f},
+      {"Gold", glm::vec3(1.0f, 0.78f, 0.34f), 1.0f, 0.25f, 1.0f},
+      {"Copper", glm::vec3(0.95f, 0.64f, 0.54f), 1.0f, 0.45f, 1.0f},
+      {"Rubber", glm::vec3(0.05f, 0.05f, 0.05f), 0.0f, 0.9f, 1.0f},
+      {"Ceramic", glm::vec3(0.8f, 0.8f, 0.75f), 0.0f, 0.15f, 1.0f},
+      {"Iron", glm::vec3(0.56f, 0.57f, 0.58f), 1.0f, 0.6f, 1.0f},
+  }};
+
+  /*
+    정렬 키의 깊이 필드로 변환할 카메라 거리 범위 (카메라의 far plane 과 같은 값)
+
+    -> 이 범위를 16-bit 로 양자화하므로, 범위 밖의 거리는 가장 먼 값으로 clamp 됨.
+  */
+  constexpr float SORT_DEPTH_RANGE = 100.0f;
+}
+
+#endif /* SCENE_CONSTANTS_HPP */
@@ -0,0 +1,72 @@
+#ifndef SHADER_CONSTANTS_HPP
+#define SHADER_CONSTANTS_HPP
+
+#include <cstdint>
+
+/**
+ * Shader 관련 심볼릭 상수 정의
+ *
+ * 일반적으로 권장되는 심볼릭 상수 정의 방식은 아래와 같음.
+ *
+ * 1. 헤더 파일 안에 한 곳에 모아서
+ * 2. 네임스페이스로 논리적 그룹을 묶어서
+ * 3. constexpr 로 선언
+ *
+ * https://github.com/jooo0922/cpp-study/blob/main/TBCppStudy/Chapter2_9/MY_CONSTANTS.h 참고
+ */
+namespace ShaderConstants
+{
+  // 링크된 프로그램 바이너리를 저장할 디렉토리 (실행 위치 기준 상대 경로) 및 파일 확장자
+  constexpr const char PROGRAM_BINARY_CACHE_DIRECTORY[] = "shader_cache";
+  constexpr const char PROGRAM_BINARY_FILE_EXTENSION[] = ".bin";
+
+  /*
+    프로그램 바이너리 파일 헤더의 식별자 및 포맷 버전
+
+    -> 파일 헤더 구조가 바뀌면 버전을 올려서 이전 포맷으로 저장된 파일을 무효화함.
+  */
+  constexpr std::uint32_t PROGRAM_BINARY_MAGIC = 0x50524742; // "PRGB"
+  constexpr std::uint32_t PROGRAM_BINARY_VERSION = 1;
+
+  /*
+    쉐이더 생성자에서 컴파일 및 링크를 제출만 하고, 결과 조회를 프로그램을 처음 사용할 때로 미룰지 여부
+
+    -> false 로 바꾸면 생성자에서 결과를 바로 조회하는 이전 방식으로 동작하므로, 시작 시간을 비교하는 용도로 사용함.
+  */
+  constexpr bool DEFERRED_LINK_ENABLED = true;
+
+  /*
+    쉐이더 소스 override 디렉토리 (실행 위치 기준 상대 경로)
+
+    쉐이더 소스는 빌드 시 실행 파일에 포함되므로 (cmake/embed_shaders.cmake 참고) 기본적으로 파일을 읽지 않지만,
+    override 가 켜져 있으면 이 디렉토리에 같은 이름의 파일이 있을 때 파일을 우선 읽어서 재빌드 없이 수정한 소스를 사용할 수 있음.
+
+    -> 개발 중에만 사용하도록 기본적으로 꺼져 있으며, cmake -DSHADER_SOURCE_OVERRIDE=ON 으로 빌드했을 때만 켜짐.
+  */
+  constexpr const char SHADER_SOURCE_DIRECTORY[] = "resources/shaders";
+#ifdef SHADER_SOURCE_OVERRIDE
+  constexpr bool SOURCE_OVERRIDE_ENABLED = true;
+#else
+  constexpr bool SOURCE_OVERRIDE_ENABLED = false;
+#endif
+
+  /*
+    override 디렉토리의 쉐이더 소스 파일이 바뀌면 실행 중에 다시 컴파일하여 교체할지 여부
+
+    -> override 가 꺼져 있거나 지원하지 않는 플랫폼에서는 켜져 있어도 동작하지 않음. (ShaderWatcher 참고)
+  */
+  constexpr bool HOT_RELOAD_ENABLED = true;
+
+  // pbr 쉐이더 변형들의 소스 이름
+  constexpr const char PBR_VERTEX_SOURCE[] = "pbr.vs";
+  constexpr const char PBR_FRAGMENT_SOURCE[] = "pbr.fs";
+
+  /*
+    쉐이더 변형별 GPU 처리 시간을 측정하는 timestamp query 를 돌려가며 사용할 프레임 수
+
+    -> 결과는 몇 프레임 뒤에 사용 가능하므로, 가장 오래 전 프레임의 query 결과를 읽은 뒤 재사용함.
+  */
+  constexpr int VARIANT_TIMER_FRAMES = 3;
+}
+
+#endif /* SHADER_CONSTANTS_HPP */
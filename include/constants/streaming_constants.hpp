@@ -0,0 +1,75 @@
+#ifndef STREAMING_CONSTANTS_HPP
+#define STREAMING_CONSTANTS_HPP
+
+#include <array>
+#include <cstddef>
+#include <glm/glm.hpp>
+
+/**
+ * Streaming 관련 심볼릭 상수 정의
+ *
+ * 일반적으로 권장되는 심볼릭 상수 정의 방식은 아래와 같음.
+ *
+ * 1. 헤더 파일 안에 한 곳에 모아서
+ * 2. 네임스페이스로 논리적 그룹을 묶어서
+ * 3. constexpr 로 선언
+ *
+ * https://github.com/jooo0922/cpp-study/blob/main/TBCppStudy/Chapter2_9/MY_CONSTANTS.h 참고
+ */
+namespace StreamingConstants
+{
+  constexpr bool ENABLED_DEFAULT = false;
+  constexpr const char ENABLED_UI_LABEL[] = "stream chunked mesh";
+
+  // chunk 파일이 없으면 원본 모델 파일을 변환하여 생성함
+  constexpr const char SOURCE_MODEL_PATH[] = "resources/models/dragon/dragon.obj";
+  constexpr const char CHUNKED_MESH_PATH[] = "resources/models/dragon/dragon.chunks";
+
+  // chunk 하나에 포함될 최대 삼각형 개수 (정점 개수가 16-bit 인덱스 범위를 넘지 않도록 MAX_SHORT_INDEXED_VERTICES / 3 이하여야 함)
+  constexpr size_t CHUNK_MAX_TRIANGLES = 4096;
+
+  // chunk 파일 변환 시 한번에 메모리에 올려서 chunk 로 나눌 최대 삼각형 개수 (이보다 많으면 임시 파일로 나눠서 상위 노드를 만듦)
+  constexpr size_t CONVERSION_IN_MEMORY_TRIANGLES = size_t(1) << 18;
+
+  // chunk 파일 변환 시 임시 파일을 읽고 쓰는 단위 삼각형 개수 (변환 취소 요청도 이 단위로 확인함)
+  constexpr size_t CONVERSION_BATCH_TRIANGLES = size_t(1) << 14;
+
+  constexpr int NUM_MEMORY_BUDGETS = 4;
+
+  struct MemoryBudget
+  {
+    const char *label;
+    size_t bytes; // GPU 에 상주하는 chunk 와 읽기 및 업로드를 기다리는 chunk 의 총 크기 상한
+  };
+
+  constexpr std::array<MemoryBudget, NUM_MEMORY_BUDGETS> MEMORY_BUDGETS = {{
+      {"4 MB", size_t(4) << 20},
+      {"16 MB", size_t(16) << 20},
+      {"64 MB", size_t(64) << 20},
+      {"256 MB", size_t(256) << 20},
+  }};
+
+  constexpr int MEMORY_BUDGET_INDEX_DEFAULT = 1;
+  constexpr const char MEMORY_BUDGET_SELECTOR_UI_LABEL[] = "memory budget";
+
+  // chunk 를 읽어들일 카메라로부터의 거리 (chunk 파일 전체 bounding box 의 대각선 길이 대비 비율)
+  constexpr float STREAM_RADIUS_DEFAULT = 0.5f;
+  constexpr float STREAM_RADIUS_MIN = 0.05f;
+  constexpr float STREAM_RADIUS_MAX = 2.0f;
+  constexpr float STREAM_RADIUS_UI_SPEED = 0.005f;
+  constexpr const char STREAM_RADIUS_UI_LABEL[] = "stream radius";
+
+  // 상주 중인 chunk 는 읽기 거리보다 이 비율만큼 더 멀어져야 내려서, 경계 부근에서 chunk 를 반복해서 올리고 내리지 않도록 함
+  constexpr float STREAM_RADIUS_HYSTERESIS = 0.1f;
+
+  // chunk payload 를 읽어들일 백그라운드 I/O 스레드 개수
+  constexpr size_t NUM_IO_THREADS = 2;
+
+  // 한 프레임에 GPU 에 업로드할 chunk 크기 상한 (업로드가 몰려서 프레임이 끊기지 않도록 나머지는 다음 프레임으로 미룸)
+  constexpr size_t UPLOAD_BYTES_PER_FRAME = size_t(4) << 20;
+
+  // 스트리밍되는 mesh 를 배치할 위치 (ModelFeature 의 모델과 겹치지 않도록 옆에 배치)
+  constexpr glm::vec3 POSITION = glm::vec3(3.0f, 0.0f, 0.0f);
+}
+
+#endif /* STREAMING_CONSTANTS_HPP */
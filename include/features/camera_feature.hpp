@@ -10,8 +10,9 @@
 #include <glm/glm.hpp>
 #include <features/feature.hpp>
 #include <common/listener.hpp>
-#include <shader/shader.hpp>
+#include <common/frame_uniforms.hpp>
 #include <camera/camera.hpp>
+#include <camera/frustum.hpp>
 
 struct CameraParameter
 {
@@ -37,19 +38,33 @@ public:
 
   void onChange(const CameraParameter &param) override;
 
-  void setPbrShader(std::shared_ptr<Shader> pbrShader);
-  void setBackgroundShader(std::shared_ptr<Shader> backgroundShader);
+  void setFrameUniforms(FrameUniforms *frameUniforms);
 
   void getCameraParameter(CameraParameter &param) const;
 
+  // process() 에서 계산된 현재 프레임의 카메라 행렬 및 위치 getter (다른 Feature 에서 LOD 선택 등에 사용)
+  const glm::mat4 &getProjectionMatrix() const;
+  const glm::mat4 &getViewMatrix() const;
+  glm::vec3 getCameraPosition() const;
+
+  // process() 에서 view-projection 행렬로부터 추출된 현재 프레임의 world space 절두체 getter (frustum culling 에 사용)
+  const Frustum &getFrustum() const;
+
 private:
   Camera camera;
 
-  std::shared_ptr<Shader> pbrShaderPtr;
-  std::shared_ptr<Shader> backgroundShaderPtr;
+  // 카메라 행렬 및 위치를 기록할 uniform block (pbr 및 background 쉐이더가 공유)
+  FrameUniforms *frameUniformsPtr;
 
   CameraParameter cameraParameter;
 
+  // 현재 프레임의 투영 행렬 및 뷰 행렬
+  glm::mat4 projection;
+  glm::mat4 view;
+
+  // 현재 프레임의 절두체
+  Frustum frustum;
+
   // 파라미터 Setter 멤버 함수
   void setYaw(const float yaw);
   void setPitch(const float pitch);
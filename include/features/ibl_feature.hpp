@@ -5,6 +5,8 @@
 #include <features/feature.hpp>
 #include <common/listener.hpp>
 #include <shader/shader.hpp>
+#include <common/frame_uniforms.hpp>
+#include <shader/pbr_shader_variants.hpp>
 #include <features/offscreen_rendering_feature.hpp>
 
 struct IBLParameter
@@ -31,14 +33,16 @@ public:
 
   void onChange(const IBLParameter &param) override;
 
-  void setPbrShader(std::shared_ptr<Shader> pbrShader);
+  void setFrameUniforms(FrameUniforms *frameUniforms);
+  void setPbrShaders(PbrShaderVariants *pbrShaders);
   void setBackgroundShader(std::shared_ptr<Shader> backgroundShader);
   void setOffscreenRenderingFeature(OffscreenRenderingFeature *offscreenRenderingFeature);
 
   void getIBLParameter(IBLParameter &param) const;
 
 private:
-  std::shared_ptr<Shader> pbrShaderPtr;
+  FrameUniforms *frameUniformsPtr; // IBL 파라미터를 기록할 uniform block (파라미터가 바뀔 때만 기록)
+  PbrShaderVariants *pbrShadersPtr; // IBL 적용 여부에 따라 그리는 Feature 들이 사용할 쉐이더 변형을 선택
   std::shared_ptr<Shader> backgroundShaderPtr;
   OffscreenRenderingFeature *offscreenRenderingFeaturePtr;
 
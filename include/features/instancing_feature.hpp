@@ -0,0 +1,113 @@
+#ifndef INSTANCING_FEATURE_HPP
+#define INSTANCING_FEATURE_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <memory>
+#include <array>
+#include <vector>
+#include <glm/glm.hpp>
+#include <features/feature.hpp>
+#include <common/listener.hpp>
+#include <common/render_stats.hpp>
+#include <shader/pbr_shader_variants.hpp>
+#include <renderable_objects/sphere.hpp>
+#include <gl_objects/vertex_buffer_object.hpp>
+#include <gl_objects/query_object.hpp>
+#include <constants/instancing_constants.hpp>
+
+struct InstancingParameter
+{
+  bool enabled;
+  bool useInstancing;
+  int gridSizeIndex;
+};
+
+/**
+ * InstancingFeature 클래스
+ *
+ * metallic, roughness 값이 서로 다른 구체들을 grid 형태로 배치하여 그리는 Feature 클래스
+ *
+ * 각 구체의 모델 행렬과 Material 파라미터를 instanced VBO 에 저장해두고
+ * glDrawElementsInstanced() 한번으로 모든 구체를 그리거나,
+ * 비교를 위해 구체마다 uniform 을 갱신하며 draw call 을 하나씩 호출할 수 있음.
+ *
+ * -> 두 방식 모두 CPU 제출 시간 및 GPU 처리 시간을 측정하여 초당 인스턴스 처리량을 RenderStats 에 집계함.
+ */
+class InstancingFeature : public IFeature, public IListener<InstancingParameter>
+{
+public:
+  InstancingFeature();
+
+  void initialize() override;
+  void process() override;
+  void finalize() override;
+
+  void onChange(const InstancingParameter &param) override;
+
+  void setPbrShaders(PbrShaderVariants *pbrShaders);
+  void setRenderStats(RenderStats *renderStats);
+
+  void getInstancingParameter(InstancingParameter &param) const;
+
+private:
+  PbrShaderVariants *pbrShadersPtr;
+  RenderStats *renderStatsPtr;
+
+  bool enabled;
+  bool useInstancing;
+  int gridSizeIndex;
+
+  InstancingParameter instancingParameter;
+
+  // grid 에 배치할 구체 및 인스턴스별 데이터
+  Sphere sphere;
+  VertexBufferObject instanceVbo;
+
+  /*
+    인스턴스마다 draw call 을 호출할 때 사용할 구체
+
+    -> sphere 의 VAO 에는 instanced VBO 가 모델 행렬 attribute 로 연결되어 있어서
+    일반 draw call 에서도 첫 번째 인스턴스의 모델 행렬이 읽히므로, instanced VBO 가 연결되지 않은 구체를 따로 둠.
+  */
+  Sphere perInstanceSphere;
+  std::vector<InstanceData> instances;
+  bool instancesDirty;
+
+  // 인스턴스마다 전송하는 uniform 들의 handle 및 handle 을 조회한 쉐이더 변형과 revision (변형이 바뀌거나 reload 될 때만 다시 조회)
+  const Shader *uniformShader;
+  std::uint32_t uniformShaderRevision;
+  UniformHandle<glm::mat4> modelUniform;
+  UniformHandle<glm::mat3> normalMatrixUniform;
+  UniformHandle<float> metallicUniform;
+  UniformHandle<float> roughnessUniform;
+  UniformHandle<float> aoUniform;
+  UniformHandle<glm::vec3> albedoUniform;
+
+  // 여러 프레임에 걸쳐 돌려가며 사용하는 GPU timer query 및 가장 최근에 읽은 GPU 처리 시간
+  std::array<std::unique_ptr<QueryObject>, InstancingConstants::NUM_TIMER_QUERIES> timerQueries;
+  int timerQueryIndex;
+  float gpuTimeMs;
+
+  // 현재 grid 크기에 맞춰 인스턴스별 데이터를 생성하고 instanced VBO 에 업로드
+  void updateInstances();
+
+  // pbrShader 의 uniform handle 조회
+  void updateUniformHandles(const Shader &pbrShader);
+
+  // 모든 인스턴스를 한번의 draw call 로 그림
+  void drawInstanced(Shader &pbrShader);
+
+  // 인스턴스마다 uniform 을 갱신하며 draw call 을 하나씩 호출
+  void drawPerInstance(Shader &pbrShader);
+
+  // 파라미터 Setter 멤버 함수
+  void setEnabled(const bool enabled);
+  void setUseInstancing(const bool useInstancing);
+  void setGridSizeIndex(const int gridSizeIndex);
+};
+
+#endif /* INSTANCING_FEATURE_HPP */
@@ -8,10 +8,12 @@
 
 #include <memory>
 #include <array>
+#include <string>
 #include <glm/glm.hpp>
 #include <features/feature.hpp>
 #include <common/listener.hpp>
-#include <shader/shader.hpp>
+#include <common/frame_uniforms.hpp>
+#include <shader/pbr_shader_variants.hpp>
 #include <light/light.hpp>
 #include <constants/light_constants.hpp>
 
@@ -43,14 +45,19 @@ public:
 
   void onChange(const LightParameter &param) override;
 
-  void setPbrShader(std::shared_ptr<Shader> pbrShader);
+  void setFrameUniforms(FrameUniforms *frameUniforms);
+  void setPbrShaders(PbrShaderVariants *pbrShaders);
 
   void getLightParameter(LightParameter &param) const;
 
 private:
   std::array<Light, LightConstants::NUM_LIGHTS> lights;
 
-  std::shared_ptr<Shader> pbrShaderPtr;
+  // 광원 위치 및 색상 배열을 기록할 uniform block
+  FrameUniforms *frameUniformsPtr;
+
+  // 켜진 광원 개수에 따라 그리는 Feature 들이 사용할 쉐이더 변형을 선택
+  PbrShaderVariants *pbrShadersPtr;
 
   LightParameter lightParameter;
 
@@ -10,7 +10,7 @@
 #include <glm/glm.hpp>
 #include <features/feature.hpp>
 #include <common/listener.hpp>
-#include <shader/shader.hpp>
+#include <shader/pbr_shader_variants.hpp>
 
 struct MaterialParameter
 {
@@ -37,17 +37,25 @@ public:
 
   void onChange(const MaterialParameter &param) override;
 
-  void setPbrShader(std::shared_ptr<Shader> pbrShader);
+  void setPbrShaders(PbrShaderVariants *pbrShaders);
 
   void getMaterialParameter(MaterialParameter &param) const;
 
 private:
-  std::shared_ptr<Shader> pbrShaderPtr;
+  PbrShaderVariants *pbrShadersPtr;
   float roughness;
   float metallic;
   float ambientOcclusion;
   glm::vec3 albedo;
 
+  // material uniform handle 및 handle 을 조회한 쉐이더 변형과 revision (변형마다 location 이 다르므로 변형이 바뀌거나 reload 될 때만 다시 조회)
+  const Shader *uniformShader = nullptr;
+  std::uint32_t uniformShaderRevision = 0;
+  UniformHandle<float> roughnessUniform;
+  UniformHandle<float> metallicUniform;
+  UniformHandle<float> aoUniform;
+  UniformHandle<glm::vec3> albedoUniform;
+
   MaterialParameter materialParameter;
 
   // 파라미터 Setter 멤버 함수
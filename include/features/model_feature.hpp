@@ -5,9 +5,15 @@
 #include <glm/glm.hpp>
 #include <features/feature.hpp>
 #include <common/listener.hpp>
-#include <shader/shader.hpp>
+#include <shader/pbr_shader_variants.hpp>
 #include <model/model.hpp>
+#include <features/camera_feature.hpp>
+#include <common/render_stats.hpp>
+#include <common/thread_pool.hpp>
 #include <constants/model_constants.hpp>
+#include <scene/render_queue.hpp>
+#include <chrono>
+#include <vector>
 
 struct ModelParameter
 {
@@ -15,6 +21,17 @@ struct ModelParameter
   glm::vec3 rotation; // rotation 파라미터는 Euler 각 기준 인터페이스 정의 -> 내부에서는 Quaternion 으로 계산
   glm::vec3 scale;
   int modelIndex;
+  bool animate;         // skinning 되는 Model 의 애니메이션 재생 여부
+  float animationSpeed; // 애니메이션 재생 속도 배율
+  bool sceneEnabled;    // 선택된 Model 하나 대신 여러 Model 인스턴스로 구성된 scene 을 그릴지 여부
+};
+
+// scene 을 구성하는 오브젝트 하나 (어떤 Model 을 어떤 material 과 transform 으로 그릴지)
+struct SceneObject
+{
+  int modelIndex;
+  std::uint32_t material; // SceneConstants::materials 인덱스
+  glm::mat4 transform;
 };
 
 /**
@@ -33,17 +50,34 @@ public:
 
   void onChange(const ModelParameter &param) override;
 
-  void setPbrShader(std::shared_ptr<Shader> pbrShader);
+  void setPbrShaders(PbrShaderVariants *pbrShaders);
+  void setCameraFeature(CameraFeature *cameraFeature);
+  void setRenderStats(RenderStats *renderStats);
 
   void getModelParameter(ModelParameter &param) const;
 
+  /**
+   * 커서 위치에서 카메라 광선을 쏴서 선택된 Model 의 Mesh 를 picking
+   *
+   * @param x, y 윈도우 좌측 상단 기준으로 [0, 1] 범위로 정규화된 커서 좌표
+   */
+  void pick(float x, float y);
+
 private:
-  std::shared_ptr<Shader> pbrShaderPtr;
+  PbrShaderVariants *pbrShadersPtr;
+  CameraFeature *cameraFeaturePtr;
+  RenderStats *renderStatsPtr;
 
   glm::vec3 position;
   glm::vec3 rotation;
   glm::vec3 scale;
   int modelIndex;
+  bool animate;
+  float animationSpeed;
+  bool sceneEnabled;
+
+  // 애니메이션 재생 시간을 진행하기 위해 기록하는 이전 프레임의 시각
+  std::chrono::steady_clock::time_point lastFrameTime;
 
   ModelParameter modelParameter;
 
@@ -53,14 +87,51 @@ private:
   // 모델링 파일 url 을 저장할 컨테이너
   std::array<const char *, ModelConstants::NUM_MODELS> modelUrls;
 
+  // 모델 import 시의 aiMesh 변환 및 meshlet culling 을 병렬로 수행할 worker 스레드들
+  ThreadPool threadPool;
+
+  // 모든 Model 의 Mesh 들이 공유하는 정점 및 인덱스 버퍼 (multi draw indirect 를 지원하지 않으면 nullptr)
+  std::shared_ptr<ModelGeometryArenas> geometryArenas;
+
   // Model 인스턴스를 저장할 정적 배열 컨테이너
   std::array<std::unique_ptr<Model>, ModelConstants::NUM_MODELS> models;
 
+  // 모델 로드 직후 측정한 Model 별 BVH 광선 처리량 (Mrays/s)
+  std::array<float, ModelConstants::NUM_MODELS> bvhClosestHitMrays;
+  std::array<float, ModelConstants::NUM_MODELS> bvhAnyHitMrays;
+
+  // 마지막 picking 결과 및 소요 시간 (선택된 Model 이 바뀌면 초기화됨)
+  ModelPickResult pickResult;
+  float pickTimeMs;
+
+  /*
+    scene 렌더링 관련 데이터
+
+    -> 오브젝트들은 모델 로드 후 grid 에 한번 배치되고, UI 로 입력받은 모델 행렬은 scene 전체에 적용됨.
+    -> meshIdOffsets 는 Model 별 첫 번째 Mesh 의 전역 id 로, 정렬 키의 mesh 필드에 Model 구분 없이 고유한 값을 쓰기 위해 사용함.
+  */
+  std::vector<SceneObject> sceneObjects;
+  std::vector<RenderMaterial> sceneMaterials;
+  std::array<std::uint32_t, ModelConstants::NUM_MODELS> meshIdOffsets;
+  RenderQueue renderQueue;
+
+  // 로드된 Model 들의 크기를 맞춰서 scene 오브젝트들을 grid 에 배치
+  void buildScene();
+
+  // 선택된 Model 하나의 애니메이션을 deltaTime 만큼 진행하고, culling, LOD 선택 및 meshlet culling 후 그림
+  void processModel(float deltaTime, Shader &pbrShader);
+
+  // scene 오브젝트들의 Mesh 들을 culling 및 LOD 선택 후 RenderQueue 에 제출하고, 정렬된 순서로 그림
+  void processScene(Shader &pbrShader);
+
   // 파라미터 Setter 멤버 함수
   void setPosition(const glm::vec3 &position);
   void setRotation(const glm::vec3 &rotation);
   void setScale(const glm::vec3 &scale);
   void setModelIndex(const int modelIndex);
+  void setAnimate(const bool animate);
+  void setAnimationSpeed(const float animationSpeed);
+  void setSceneEnabled(const bool sceneEnabled);
 };
 
 #endif /* MODEL_FEATURE_HPP */
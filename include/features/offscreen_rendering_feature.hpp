@@ -8,9 +8,11 @@
 
 #include <memory>
 #include <array>
+#include <string_view>
 #include <glm/glm.hpp>
 #include <features/feature.hpp>
 #include <shader/shader.hpp>
+#include <shader/pbr_shader_variants.hpp>
 #include <gl_objects/frame_buffer_object.hpp>
 #include <gl_objects/render_buffer_object.hpp>
 #include <gl_objects/texture.hpp>
@@ -33,9 +35,17 @@ public:
   void process() override;
   void finalize() override;
 
-  void setPbrShader(std::shared_ptr<Shader> pbrShader);
+  void setPbrShaders(PbrShaderVariants *pbrShaders);
   void setBackgroundShader(std::shared_ptr<Shader> backgroundShader);
 
+  /**
+   * fileName 을 소스로 사용하는 offscreen rendering 쉐이더들의 reload 제출
+   *
+   * 교체된 쉐이더를 사용하는 텍스쳐 버퍼와 그 결과를 입력으로 사용하는 텍스쳐 버퍼들만 process() 에서 다시 렌더링함.
+   * (ex> brdf.fs 가 바뀌면 BRDF Integration map 만, equirectangular_to_cubemap.fs 가 바뀌면 env cubemap 부터 모두 다시 렌더링)
+   */
+  void beginShaderReload(std::string_view fileName);
+
   // 각 텍스쳐 버퍼의 index 를 매개변수로 전달받아 사용할 offscreen rendering 버퍼를 바인딩하는 함수
   void useEnvCubemap(const int index);
   void useIrradianceMap(const int index);
@@ -48,9 +58,20 @@ public:
 
 private:
   // offscreen rendering 결과가 저장된 텍스쳐들의 texture unit 위치값을 전송할 쉐이더 객체들
-  std::shared_ptr<Shader> pbrShaderPtr;
+  PbrShaderVariants *pbrShadersPtr;
   std::shared_ptr<Shader> backgroundShaderPtr;
 
+  /*
+    각 텍스쳐 버퍼에 offscreen rendering 할 때 사용하는 쉐이더 객체들
+
+    -> 생성자에서 HDR 이미지를 디코딩하기 전에 컴파일 및 링크를 제출해두어, 디코딩하는 동안 드라이버가 컴파일하도록 함.
+    -> 쉐이더 소스가 바뀌면 reload 된 쉐이더로 다시 렌더링해야 하므로 initialize() 이후에도 유지함.
+  */
+  std::unique_ptr<Shader> equirectangularToCubemapShaderPtr;
+  std::unique_ptr<Shader> irradianceShaderPtr;
+  std::unique_ptr<Shader> prefilterShaderPtr;
+  std::unique_ptr<Shader> brdfShaderPtr;
+
   // offscreen rendering 시 렌더링할 primitive 객체들
   Cube cube;
   Quad quad;
@@ -73,6 +94,15 @@ private:
   glm::mat4 captureProjection;
   std::array<glm::mat4, OffscreenRenderingConstants::NUM_CUBE_MAP_FACES> captureViews;
 
+  // reload 된 쉐이더 때문에 다시 렌더링해야 하는 텍스쳐 버퍼들
+  bool envCubemapsDirty;
+  bool irradianceMapsDirty;
+  bool prefilterMapsDirty;
+  bool brdfLUTTextureDirty;
+
+  // 다시 렌더링해야 하는 텍스쳐 버퍼들만 의존 순서대로 다시 렌더링한 뒤 viewport 복원
+  void regenerateDirtyTextures();
+
   // 각 텍스쳐 버퍼에 offscreen rendering 하는 함수들
   void generateEnvCubemap();
   void generateIrradianceMap();
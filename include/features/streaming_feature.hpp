@@ -0,0 +1,100 @@
+#ifndef STREAMING_FEATURE_HPP
+#define STREAMING_FEATURE_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <glm/glm.hpp>
+#include <features/feature.hpp>
+#include <common/listener.hpp>
+#include <common/render_stats.hpp>
+#include <shader/pbr_shader_variants.hpp>
+#include <features/camera_feature.hpp>
+#include <streaming/streaming_mesh.hpp>
+#include <constants/streaming_constants.hpp>
+
+struct StreamingParameter
+{
+  bool enabled;
+  int memoryBudgetIndex;
+  float streamRadius; // chunk 파일 전체 bounding box 의 대각선 길이 대비 비율
+};
+
+/**
+ * StreamingFeature 클래스
+ *
+ * 메모리에 한번에 올릴 수 없는 크기의 mesh 를 chunk 파일로부터 카메라 주변의 chunk 만 읽어들여 그리는 Feature 클래스
+ *
+ * 처음 활성화될 때 chunk 파일을 열고, 비활성화되면 StreamingMesh 를 해제하여 상주하던 chunk 들과 I/O 스레드를 모두 정리함.
+ *
+ * chunk 파일이 없으면 백그라운드 스레드에서 원본 모델 파일을 변환하고 (ChunkedMeshWriter::convert() 참고),
+ * 변환이 끝날 때까지는 렌더 스레드를 막지 않고 RenderStats 에 변환 중임을 표시만 함.
+ * -> 변환 도중에 비활성화되어도 변환은 계속 진행하고, finalize() 에서는 변환을 취소하고 스레드가 끝날 때까지 기다림.
+ */
+class StreamingFeature : public IFeature, public IListener<StreamingParameter>
+{
+public:
+  StreamingFeature();
+  ~StreamingFeature();
+
+  void initialize() override;
+  void process() override;
+  void finalize() override;
+
+  void onChange(const StreamingParameter &param) override;
+
+  void setPbrShaders(PbrShaderVariants *pbrShaders);
+  void setCameraFeature(CameraFeature *cameraFeature);
+  void setRenderStats(RenderStats *renderStats);
+
+  void getStreamingParameter(StreamingParameter &param) const;
+
+private:
+  PbrShaderVariants *pbrShadersPtr;
+  CameraFeature *cameraFeaturePtr;
+  RenderStats *renderStatsPtr;
+
+  bool enabled;
+  int memoryBudgetIndex;
+  float streamRadius;
+
+  StreamingParameter streamingParameter;
+
+  // 스트리밍되는 mesh 의 모델 행렬
+  glm::mat4 transform;
+
+  std::unique_ptr<StreamingMesh> streamingMesh;
+
+  // chunk 파일을 열거나 변환하는 데 실패했으면 매 프레임 다시 시도하지 않음
+  bool openFailed;
+
+  // chunk 파일을 변환하는 백그라운드 스레드 및 변환 상태 (conversionRunning 은 스레드가 변환을 마치면 false 로 바뀜)
+  std::thread conversionThread;
+  std::atomic<bool> conversionRunning;
+  std::atomic<bool> conversionSucceeded;
+  std::atomic<bool> conversionCancelRequested;
+
+  // chunk 파일을 열어서 StreamingMesh 생성 (chunk 파일이 없으면 변환을 시작하고, 변환이 끝난 뒤의 프레임에서 염)
+  void openStreamingMesh();
+
+  // 백그라운드 스레드에서 원본 모델 파일을 chunk 파일로 변환 시작
+  void startConversion();
+
+  // 진행 중인 변환을 취소하고 스레드가 끝날 때까지 기다림
+  void stopConversion();
+
+  // 현재 파라미터를 StreamingMesh 에 적용
+  void applyParameters();
+
+  // 파라미터 Setter 멤버 함수
+  void setEnabled(const bool enabled);
+  void setMemoryBudgetIndex(const int memoryBudgetIndex);
+  void setStreamRadius(const float streamRadius);
+};
+
+#endif /* STREAMING_FEATURE_HPP */
@@ -0,0 +1,165 @@
+#ifndef GL_EXTENSIONS_HPP
+#define GL_EXTENSIONS_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <glad/glad.h> // OpenGL 함수를 초기화하기 위한 헤더
+#include <string>
+
+/*
+  glad 는 OpenGL 3.3 core 기준으로 생성되어 있으므로,
+  상위 버전 또는 확장에서만 제공되는 enum 값들은 직접 정의함.
+*/
+#ifndef GL_DRAW_INDIRECT_BUFFER
+#define GL_DRAW_INDIRECT_BUFFER 0x8F3F
+#endif
+#ifndef GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#endif
+#ifndef GL_PROGRAM_BINARY_LENGTH
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#endif
+#ifndef GL_NUM_PROGRAM_BINARY_FORMATS
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+#endif
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+/**
+ * glMultiDrawElementsIndirect() 에 전달하는 indirect command 구조체
+ *
+ * OpenGL 명세에 정의된 메모리 레이아웃과 동일해야 하므로 멤버 순서를 바꾸면 안됨.
+ */
+struct DrawElementsIndirectCommand
+{
+  GLuint count;         // 그릴 인덱스 개수
+  GLuint instanceCount; // 인스턴스 개수
+  GLuint firstIndex;    // IBO 내에서 인덱스가 시작하는 위치 (인덱스 개수 단위)
+  GLint baseVertex;     // 인덱스에 더해질 정점 offset
+  GLuint baseInstance;  // instanced attribute 를 읽기 시작할 위치 (per-draw 데이터 인덱스로 사용)
+};
+
+/**
+ * GLExtensions 클래스
+ *
+ * 현재 컨텍스트의 OpenGL 버전 및 확장 지원 여부를 검사하고,
+ * glad 가 로드하지 않는 상위 버전(또는 확장)의 함수 포인터들을 런타임에 로드하는 클래스
+ *
+ * -> 윈도우는 3.3 core 컨텍스트를 요청하지만, 대부분의 드라이버는 호환되는 가장 높은 버전의 컨텍스트를 생성하므로
+ * 지원 여부를 확인한 뒤 상위 버전 기능을 선택적으로 사용하고, 지원되지 않으면 기존 3.3 경로로 동작하도록 함.
+ */
+class GLExtensions
+{
+public:
+  // glad 로드 이후 호출하여 버전 정보 및 함수 포인터들을 로드
+  static void load(GLADloadproc loadProc);
+
+  // 현재 컨텍스트가 major.minor 이상의 버전인지 검사
+  static bool isVersionSupported(int major, int minor);
+
+  // 현재 컨텍스트가 name 에 해당하는 확장을 지원하는지 검사
+  static bool isExtensionSupported(const std::string &name);
+
+  // glMultiDrawElementsIndirect() 및 indirect command 의 baseInstance 사용 가능 여부 (GL 4.3 또는 ARB_multi_draw_indirect + ARB_base_instance)
+  static bool hasMultiDrawIndirect();
+
+  // glGetProgramBinary() / glProgramBinary() 사용 가능 여부 (GL 4.1 또는 ARB_get_program_binary, 바이너리 포맷이 1개 이상)
+  static bool hasProgramBinary();
+
+  /*
+    KHR_parallel_shader_compile (또는 ARB_parallel_shader_compile) 사용 가능 여부
+
+    -> 지원하면 load() 에서 드라이버의 컴파일 스레드 개수 제한을 풀고,
+    GL_COMPLETION_STATUS_KHR 로 컴파일 및 링크가 끝났는지 기다리지 않고 조회할 수 있음.
+  */
+  static bool hasParallelShaderCompile();
+
+  /*
+    Direct State Access 사용 가능 여부 (GL 4.5 또는 ARB_direct_state_access)
+
+    -> 지원하면 gl_objects 래퍼 클래스들이 객체를 바인딩하지 않고 이름(ID)으로 직접 설정하므로,
+    호출하는 쪽에서 바인딩해 둔 상태를 바꾸지 않고 GL 호출 횟수도 줄어듦.
+    (GLObjectConstants::DIRECT_STATE_ACCESS_ENABLED 가 false 면 지원하더라도 로드하지 않음)
+  */
+  static bool hasDirectStateAccess();
+
+  /*
+    glTexStorage2D() 로 immutable 텍스쳐 메모리를 할당할 수 있는지 여부 (GL 4.2 또는 ARB_texture_storage)
+
+    -> DSA 를 지원하면 바인딩 없이 할당하는 glTextureStorage2D() 를 대신 사용함.
+  */
+  static bool hasTextureStorage();
+
+  // 상위 버전 함수 포인터 타입 및 함수 포인터
+  typedef void(APIENTRYP MultiDrawElementsIndirectProc)(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride);
+  static MultiDrawElementsIndirectProc multiDrawElementsIndirect;
+
+  typedef void(APIENTRYP GetProgramBinaryProc)(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary);
+  typedef void(APIENTRYP ProgramBinaryProc)(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length);
+  typedef void(APIENTRYP ProgramParameteriProc)(GLuint program, GLenum pname, GLint value);
+  static GetProgramBinaryProc getProgramBinary;
+  static ProgramBinaryProc programBinary;
+  static ProgramParameteriProc programParameteri;
+
+  typedef void(APIENTRYP MaxShaderCompilerThreadsProc)(GLuint count);
+  static MaxShaderCompilerThreadsProc maxShaderCompilerThreads;
+
+  typedef void(APIENTRYP TexStorage2DProc)(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height);
+  static TexStorage2DProc texStorage2D;
+
+  // Direct State Access 텍스쳐 함수
+  typedef void(APIENTRYP CreateTexturesProc)(GLenum target, GLsizei n, GLuint *textures);
+  typedef void(APIENTRYP TextureParameteriProc)(GLuint texture, GLenum pname, GLint param);
+  typedef void(APIENTRYP GenerateTextureMipmapProc)(GLuint texture);
+  typedef void(APIENTRYP BindTextureUnitProc)(GLuint unit, GLuint texture);
+  typedef void(APIENTRYP TextureStorage2DProc)(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height);
+  typedef void(APIENTRYP TextureSubImage2DProc)(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels);
+  static CreateTexturesProc createTextures;
+  static TextureParameteriProc textureParameteri;
+  static GenerateTextureMipmapProc generateTextureMipmap;
+  static BindTextureUnitProc bindTextureUnit;
+  static TextureStorage2DProc textureStorage2D;
+  static TextureSubImage2DProc textureSubImage2D;
+
+  // Direct State Access 버퍼 함수
+  typedef void(APIENTRYP CreateBuffersProc)(GLsizei n, GLuint *buffers);
+  typedef void(APIENTRYP NamedBufferDataProc)(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage);
+  typedef void(APIENTRYP NamedBufferSubDataProc)(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data);
+  typedef void *(APIENTRYP MapNamedBufferRangeProc)(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access);
+  typedef GLboolean(APIENTRYP UnmapNamedBufferProc)(GLuint buffer);
+  typedef void(APIENTRYP CopyNamedBufferSubDataProc)(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size);
+  static CreateBuffersProc createBuffers;
+  static NamedBufferDataProc namedBufferData;
+  static NamedBufferSubDataProc namedBufferSubData;
+  static MapNamedBufferRangeProc mapNamedBufferRange;
+  static UnmapNamedBufferProc unmapNamedBuffer;
+  static CopyNamedBufferSubDataProc copyNamedBufferSubData;
+
+  // Direct State Access VAO 함수
+  typedef void(APIENTRYP CreateVertexArraysProc)(GLsizei n, GLuint *arrays);
+  typedef void(APIENTRYP VertexArrayVertexBufferProc)(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride);
+  typedef void(APIENTRYP VertexArrayElementBufferProc)(GLuint vaobj, GLuint buffer);
+  typedef void(APIENTRYP VertexArrayAttribFormatProc)(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset);
+  typedef void(APIENTRYP VertexArrayAttribIFormatProc)(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset);
+  typedef void(APIENTRYP VertexArrayAttribBindingProc)(GLuint vaobj, GLuint attribindex, GLuint bindingindex);
+  typedef void(APIENTRYP EnableVertexArrayAttribProc)(GLuint vaobj, GLuint index);
+  typedef void(APIENTRYP VertexArrayBindingDivisorProc)(GLuint vaobj, GLuint bindingindex, GLuint divisor);
+  static CreateVertexArraysProc createVertexArrays;
+  static VertexArrayVertexBufferProc vertexArrayVertexBuffer;
+  static VertexArrayElementBufferProc vertexArrayElementBuffer;
+  static VertexArrayAttribFormatProc vertexArrayAttribFormat;
+  static VertexArrayAttribIFormatProc vertexArrayAttribIFormat;
+  static VertexArrayAttribBindingProc vertexArrayAttribBinding;
+  static EnableVertexArrayAttribProc enableVertexArrayAttrib;
+  static VertexArrayBindingDivisorProc vertexArrayBindingDivisor;
+
+private:
+  static int majorVersion;
+  static int minorVersion;
+};
+
+#endif // GL_EXTENSIONS_HPP
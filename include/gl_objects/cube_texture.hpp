@@ -23,8 +23,14 @@ class CubeTexture : public IGLObject
 public:
   CubeTexture() = default;
 
-  // 비어있는 텍스쳐 버퍼 객체 생성 -> offscreen rendering 결과를 저장할 용도
-  CubeTexture(GLsizei width, GLsizei height, GLenum format, GLenum internalFormat);
+  /**
+   * 비어있는 텍스쳐 버퍼 객체 생성 -> offscreen rendering 결과를 저장할 용도
+   *
+   * Cubemap 6면의 levels 개 mip level 메모리를 glTexStorage2D() 로 한번에 할당하므로,
+   * 각 mip level 에 직접 렌더링할 텍스쳐도 generateMipmap() 으로 메모리를 할당할 필요가 없음.
+   * (immutable 할당은 크기가 명시된(sized) 내부 포맷만 허용하므로 format 은 GL_RGB16F 같은 sized 포맷이어야 함)
+   */
+  CubeTexture(GLsizei width, GLsizei height, GLenum format, GLenum internalFormat, GLsizei levels = 1);
 
   // 소멸자
   ~CubeTexture();
@@ -54,7 +60,10 @@ public:
 
   GLuint getID() const;
 
-  // 밉맵 생성
+  // 할당된 mip level 개수
+  GLsizei getLevels() const;
+
+  // level 0 의 이미지로 할당된 나머지 mip level 들을 채움
   void generateMipmap();
 
 private:
@@ -77,6 +86,11 @@ private:
   GLint minFilter = GL_LINEAR;
 
   GLint magFilter = GL_LINEAR;
+
+  GLsizei levels = 1;
+
+  // 텍스쳐 파라미터 하나를 설정 (DSA 를 지원하지 않으면 바인딩 후 설정하고 바인딩 해제)
+  void setParameter(GLenum name, GLint value);
 };
 
 #endif // CUBE_TEXTURE_HPP
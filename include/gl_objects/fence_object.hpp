@@ -0,0 +1,44 @@
+#ifndef FENCE_OBJECT_HPP
+#define FENCE_OBJECT_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <glad/glad.h> // OpenGL 함수를 초기화하기 위한 헤더
+#include <gl_objects/gl_object.hpp>
+
+/**
+ * FenceObject 클래스
+ *
+ * sync 객체(glFenceSync)를 추상화한 클래스
+ *
+ * bind() 시점까지 제출된 GPU 명령들이 모두 처리되면 signaled 상태가 되므로,
+ * 그 명령들이 읽던 버퍼 영역을 언제 다시 덮어써도 안전한지 확인하는 데 사용함.
+ *
+ * -> isSignaled() 는 대기하지 않고 현재 상태만 확인하므로 렌더링 루프를 멈추지 않음.
+ */
+class FenceObject : public IGLObject
+{
+public:
+  FenceObject();
+
+  ~FenceObject();
+
+  // 가장 최근에 삽입한 fence 가 signaled 상태인지 여부 (한번도 삽입되지 않은 fence 는 true)
+  bool isSignaled() const;
+
+  // 지금까지 제출된 GPU 명령들 뒤에 fence 삽입 (이전에 삽입된 fence 는 삭제됨)
+  void bind() const override;
+
+  // fence 는 삽입 이후 별도로 종료할 필요가 없으므로 아무 동작도 하지 않음
+  void unbind() const override;
+
+  void destroy() override;
+
+private:
+  mutable GLsync sync;
+};
+
+#endif // FENCE_OBJECT_HPP
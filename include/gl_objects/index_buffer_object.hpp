@@ -23,6 +23,20 @@ public:
 
   void setData(const void *data, GLsizeiptr size, GLenum usage);
 
+  // setData() 로 할당된 버퍼의 일부 영역만 갱신
+  void setSubData(GLintptr offset, const void *data, GLsizeiptr size);
+
+  /**
+   * GPU 동기화 없이 버퍼의 일부 영역을 매핑하여 갱신 (GL_MAP_UNSYNCHRONIZED_BIT)
+   *
+   * 드라이버가 이전 그리기 명령이 끝날 때까지 기다리지 않으므로,
+   * 해당 영역을 읽는 GPU 명령이 남아있지 않다는 것을 호출하는 쪽에서 보장해야 함. (ex> FenceObject 로 확인)
+   */
+  void setSubDataUnsynchronized(GLintptr offset, const void *data, GLsizeiptr size);
+
+  // 다른 IBO 객체의 데이터 일부를 CPU 를 거치지 않고 GPU 메모리 상에서 복사 (버퍼 크기 확장 시 사용)
+  void copySubData(const IndexBufferObject &source, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size);
+
   GLuint getID() const;
 
   void bind() const override;
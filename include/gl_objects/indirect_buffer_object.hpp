@@ -0,0 +1,40 @@
+#ifndef INDIRECT_BUFFER_OBJECT_HPP
+#define INDIRECT_BUFFER_OBJECT_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <glad/glad.h> // OpenGL 함수를 초기화하기 위한 헤더
+#include <gl_objects/gl_object.hpp>
+#include <gl_context/gl_extensions.hpp>
+
+/**
+ * IndirectBufferObject 클래스
+ *
+ * glMultiDrawElementsIndirect() 등에서 읽어들일 draw command 들을 저장하는
+ * GL_DRAW_INDIRECT_BUFFER 버퍼 객체를 추상화한 클래스
+ */
+class IndirectBufferObject : public IGLObject
+{
+public:
+  IndirectBufferObject();
+
+  ~IndirectBufferObject();
+
+  void setData(const void *data, GLsizeiptr size, GLenum usage);
+
+  GLuint getID() const;
+
+  void bind() const override;
+
+  void unbind() const override;
+
+  void destroy() override;
+
+private:
+  GLuint ID;
+};
+
+#endif // INDIRECT_BUFFER_OBJECT_HPP
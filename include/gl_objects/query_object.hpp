@@ -0,0 +1,61 @@
+#ifndef QUERY_OBJECT_HPP
+#define QUERY_OBJECT_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <glad/glad.h> // OpenGL 함수를 초기화하기 위한 헤더
+#include <gl_objects/gl_object.hpp>
+
+/**
+ * QueryObject 클래스
+ *
+ * query 객체를 추상화한 클래스
+ *
+ * bind() ~ unbind() 사이에 실행된 GPU 명령들에 대한 결과를 query 대상(target)에 따라 기록함.
+ * (ex> GL_TIME_ELAPSED 는 GPU 에서 해당 명령들을 처리하는 데 걸린 시간을 nanosecond 단위로 기록)
+ *
+ * -> 결과는 GPU 가 명령을 모두 처리한 이후에 사용 가능하므로,
+ * 렌더링 루프를 멈추지 않으려면 isResultAvailable() 로 확인한 뒤 다음 프레임 이후에 읽어야 함.
+ */
+class QueryObject : public IGLObject
+{
+public:
+  QueryObject(GLenum target);
+
+  ~QueryObject();
+
+  // query 결과가 사용 가능한지 여부 (한번도 실행되지 않은 query 는 false)
+  bool isResultAvailable() const;
+
+  // query 결과 반환 (결과가 아직 사용 가능하지 않다면 GPU 가 처리를 마칠 때까지 대기함)
+  GLuint64 getResult() const;
+
+  GLuint getID() const;
+
+  // query 시작 (glBeginQuery)
+  void bind() const override;
+
+  // query 종료 (glEndQuery)
+  void unbind() const override;
+
+  /**
+   * 이전 GPU 명령들이 모두 처리된 시점의 GPU 시각을 기록 (glQueryCounter, target 이 GL_TIMESTAMP 인 query 에서만 사용)
+   *
+   * -> GL_TIME_ELAPSED 와 달리 시작/종료 쌍이 중첩되어도 되므로, 다른 timer query 가 실행 중인 구간도 측정할 수 있음.
+   */
+  void recordTimestamp() const;
+
+  void destroy() override;
+
+private:
+  GLuint ID;
+  GLenum target;
+
+  // 한번이라도 bind() ~ unbind() 로 실행되었는지 여부
+  mutable bool issued;
+};
+
+#endif // QUERY_OBJECT_HPP
@@ -8,13 +8,14 @@
 
 #include <glad/glad.h> // OpenGL 함수를 초기화하기 위한 헤더
 #include <gl_objects/gl_object.hpp>
+#include <cstddef>
 
 /**
  * Texture 클래스
  *
  * Texture 객체를 추상화한 클래스
  */
-class Texture : public IGLObject
+class Texture final : public IGLObject
 {
 public:
   Texture() = default;
@@ -25,8 +26,8 @@ public:
   // 이미지 url 을 로드하여 텍스쳐 객체 생성
   Texture(const char *url, GLenum format, GLenum internalFormat);
 
-  // 비어있는 텍스쳐 버퍼 객체 생성 -> offscreen rendering 결과를 저장할 용도
-  Texture(GLsizei width, GLsizei height, GLenum format, GLenum internalFormat);
+  // 비어있는 텍스쳐 버퍼 객체 생성 -> offscreen rendering 결과를 저장할 용도 (levels 개의 mip level 메모리를 한번에 할당)
+  Texture(GLsizei width, GLsizei height, GLenum format, GLenum internalFormat, GLsizei levels = 1);
 
   // 소멸자
   ~Texture();
@@ -54,7 +55,17 @@ public:
 
   GLuint getID() const;
 
-  // 밉맵 생성
+  GLsizei getWidth() const;
+
+  GLsizei getHeight() const;
+
+  // 내부 포맷과 크기로 추정한 텍스쳐의 GPU 메모리 크기 (bytes, 할당된 mip level 포함)
+  size_t getByteSize() const;
+
+  // 할당된 mip level 개수
+  GLsizei getLevels() const;
+
+  // level 0 의 이미지로 할당된 나머지 mip level 들을 채움 (생성 시 levels 를 2 이상으로 할당해야 함)
   void generateMipmap();
 
 private:
@@ -75,6 +86,26 @@ private:
   GLint minFilter = GL_LINEAR;
 
   GLint magFilter = GL_LINEAR;
+
+  GLsizei levels = 1;
+
+  // 텍스쳐 객체 생성 (DSA 지원 여부에 따라 glCreateTextures() 또는 glGenTextures() 사용)
+  void create();
+
+  /*
+    levels 개의 mip level 메모리를 할당하고 data 가 있으면 level 0 에 전달
+
+    -> glTexStorage2D() 로 할당한 immutable 텍스쳐는 이후 크기나 포맷이 바뀌지 않으므로,
+    드라이버가 메모리를 한번에 할당하고 그리기마다 mipmap completeness 검사를 하지 않아도 됨.
+    (지원하지 않으면 mip level 마다 glTexImage2D() 로 할당)
+  */
+  void allocate(const float *data);
+
+  // 생성자에서 멤버에 저장된 Wrapping 및 Filtering 모드를 한번에 설정 (bind 경로는 텍스쳐가 바인딩된 상태에서 호출)
+  void applyParameters();
+
+  // 텍스쳐 파라미터 하나를 설정 (DSA 를 지원하지 않으면 바인딩 후 설정하고 바인딩 해제)
+  void setParameter(GLenum name, GLint value);
 };
 
 #endif /* TEXTURE_HPP */
@@ -0,0 +1,114 @@
+#ifndef TEXTURE_CACHE_HPP
+#define TEXTURE_CACHE_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <glad/glad.h>
+#include <gl_objects/texture.hpp>
+#include <string>
+#include <memory>
+#include <mutex>
+#include <future>
+#include <unordered_map>
+#include <cstddef>
+
+/**
+ * 텍스쳐 로드 시 적용할 파라미터
+ *
+ * 같은 이미지 파일이라도 파라미터가 다르면 서로 다른 텍스쳐 객체가 생성되므로 캐시 key 에 포함됨.
+ * (format, internalFormat 이 0 이면 이미지의 색상 채널 개수에 따라 자동 설정)
+ */
+struct TextureLoadParams
+{
+  GLenum format = 0;
+  GLenum internalFormat = 0;
+
+  bool operator==(const TextureLoadParams &other) const
+  {
+    return format == other.format && internalFormat == other.internalFormat;
+  }
+};
+
+/**
+ * TextureCache 클래스
+ *
+ * 프로세스 전체에서 공유되는 텍스쳐 캐시.
+ * 정규화된(canonical) 파일 경로와 로드 파라미터를 key 로 하는 hash map 에 텍스쳐를 weak_ptr 로 저장하여,
+ * 여러 Model 이 같은 이미지 파일을 사용해도 텍스쳐 객체는 한번만 생성되고,
+ * 텍스쳐를 참조하는 shared_ptr 가 모두 사라지면 텍스쳐 객체도 곧바로 해제됨.
+ *
+ * 아직 로드 중인 텍스쳐를 다른 스레드가 요청하면 중복 로드하지 않고 먼저 시작된 로드가 끝나기를 기다렸다가 같은 텍스쳐를 반환함.
+ * (텍스쳐 객체 생성에 OpenGL 함수를 사용하므로, 실제 로드는 OpenGL 컨텍스트가 바인딩된 스레드에서 시작되어야 함)
+ */
+class TextureCache
+{
+public:
+  // 프로세스 전체에서 공유되는 캐시 인스턴스 반환
+  static TextureCache &getInstance();
+
+  /**
+   * 이미지 파일 경로와 로드 파라미터에 해당하는 텍스쳐 반환
+   *
+   * 캐시에 살아있는 텍스쳐가 있으면 그대로 반환하고, 로드 중이면 완료될 때까지 기다렸다가 반환하며,
+   * 둘 다 아니면 새로 로드함.
+   */
+  std::shared_ptr<Texture> acquire(const std::string &path, const TextureLoadParams &params = TextureLoadParams());
+
+  // 현재 GPU 메모리에 상주하는 캐시된 텍스쳐들의 추정 크기 (bytes)
+  size_t getResidentBytes() const;
+
+  // 현재 살아있는 캐시된 텍스쳐 개수
+  size_t getTextureCount() const;
+
+  // 캐시 조회 시 이미 로드된(또는 로드 중인) 텍스쳐를 재사용한 횟수 및 새로 로드한 횟수
+  size_t getHitCount() const;
+  size_t getMissCount() const;
+
+private:
+  TextureCache() = default;
+  TextureCache(const TextureCache &) = delete;
+  TextureCache &operator=(const TextureCache &) = delete;
+
+  struct Key
+  {
+    std::string path;
+    TextureLoadParams params;
+
+    bool operator==(const Key &other) const
+    {
+      return path == other.path && params == other.params;
+    }
+  };
+
+  struct KeyHash
+  {
+    size_t operator()(const Key &key) const;
+  };
+
+  struct Entry
+  {
+    // 로드가 완료된 텍스쳐 (캐시는 텍스쳐의 수명을 연장하지 않음)
+    std::weak_ptr<Texture> texture;
+
+    // 로드 중인 동안만 유효한 future (같은 텍스쳐를 요청한 다른 스레드들이 기다림)
+    std::shared_future<std::shared_ptr<Texture>> pending;
+  };
+
+  // 실제로 이미지 파일을 로드하여 텍스쳐 객체를 생성하고, 해제될 때 캐시에서 상주 크기를 빼도록 deleter 설정
+  std::shared_ptr<Texture> load(const Key &key);
+
+  // 텍스쳐가 해제될 때 호출되어 캐시 항목 및 상주 크기 정리
+  void release(const Key &key, Texture *texture, size_t byteSize);
+
+  mutable std::mutex mutex;
+  std::unordered_map<Key, Entry, KeyHash> entries;
+
+  size_t residentBytes = 0;
+  size_t hitCount = 0;
+  size_t missCount = 0;
+};
+
+#endif /* TEXTURE_CACHE_HPP */
@@ -0,0 +1,50 @@
+#ifndef UNIFORM_BUFFER_OBJECT_HPP
+#define UNIFORM_BUFFER_OBJECT_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <glad/glad.h> // OpenGL 함수를 초기화하기 위한 헤더
+#include <gl_objects/gl_object.hpp>
+
+/**
+ * UniformBufferObject 클래스
+ *
+ * UBO 객체를 추상화한 클래스
+ *
+ * 쉐이더의 uniform block 은 UBO 를 직접 참조하지 않고 binding point 를 통해 연결되므로,
+ * bindBase() 로 UBO 를 binding point 에 연결하고 쉐이더 쪽에서는 Shader::setUniformBlockBinding() 으로 같은 binding point 를 지정해야 함.
+ */
+class UniformBufferObject : public IGLObject
+{
+public:
+  UniformBufferObject();
+
+  ~UniformBufferObject();
+
+  void setData(const void *data, GLsizeiptr size, GLenum usage);
+
+  // setData() 로 할당된 버퍼의 일부 영역만 갱신
+  void setSubData(GLintptr offset, const void *data, GLsizeiptr size);
+
+  // UBO 를 uniform block binding point 에 연결
+  void bindBase(GLuint bindingPoint) const;
+
+  // UBO 의 [offset, offset + size) 영역만 uniform block binding point 에 연결 (offset 은 GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT 의 배수여야 함)
+  void bindRange(GLuint bindingPoint, GLintptr offset, GLsizeiptr size) const;
+
+  GLuint getID() const;
+
+  void bind() const override;
+
+  void unbind() const override;
+
+  void destroy() override;
+
+private:
+  GLuint ID;
+};
+
+#endif // UNIFORM_BUFFER_OBJECT_HPP
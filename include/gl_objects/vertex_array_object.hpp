@@ -30,6 +30,9 @@ public:
 
   void linkIBO(const IndexBufferObject &ibo);
 
+  // 연결된 attribute 를 몇 개의 인스턴스마다 다음 데이터로 넘어가며 읽을지 설정 (0 이면 정점마다, 1 이면 인스턴스마다)
+  void setAttributeDivisor(GLuint index, GLuint divisor);
+
   GLuint getID() const;
 
   void bind() const override;
@@ -40,6 +43,12 @@ public:
 
 private:
   GLuint ID;
+
+  // glVertexAttribIPointer() 로 연결해야 하는 정수형 데이터 타입인지 검사
+  static bool isIntegerType(GLenum type);
+
+  // DSA 를 지원하는 경우의 linkVBO() 구현 (VAO 및 VBO 를 바인딩하지 않고 attribute 형식과 buffer binding 을 설정)
+  void linkVBODirect(const VertexBufferObject &vbo, const std::vector<std::tuple<GLuint, GLint, GLenum, GLboolean, GLsizei, const void *>> &attributes);
 };
 
 #endif /* VERTEX_ARRAY_OBJECT_HPP */
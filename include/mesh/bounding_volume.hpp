@@ -0,0 +1,38 @@
+#ifndef BOUNDING_VOLUME_HPP
+#define BOUNDING_VOLUME_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <vector>
+#include <glm/glm.hpp>
+
+// mesh 를 감싸는 bounding sphere (object space 기준)
+struct BoundingSphere
+{
+  glm::vec3 center = glm::vec3(0.0f);
+  float radius = 0.0f;
+};
+
+// mesh 를 감싸는 축 정렬 bounding box (object space 기준)
+struct BoundingBox
+{
+  glm::vec3 min = glm::vec3(0.0f);
+  glm::vec3 max = glm::vec3(0.0f);
+};
+
+// 정점 position 들을 모두 포함하는 AABB 계산
+BoundingBox computeBoundingBox(const std::vector<glm::vec3> &positions);
+
+// 모델 행렬로 변환된 AABB 를 다시 감싸는 world space 기준의 AABB 계산
+BoundingBox transformBoundingBox(const BoundingBox &box, const glm::mat4 &transform);
+
+// 정점 position 들의 AABB 중심을 기준으로 모든 정점을 포함하는 bounding sphere 계산
+BoundingSphere computeBoundingSphere(const std::vector<glm::vec3> &positions);
+
+// 모델 행렬로 변환된 world space 기준의 bounding sphere 계산 (radius 는 가장 큰 축의 scale 만큼 확대)
+BoundingSphere transformBoundingSphere(const BoundingSphere &sphere, const glm::mat4 &transform);
+
+#endif /* BOUNDING_VOLUME_HPP */
@@ -0,0 +1,49 @@
+#ifndef BUFFER_SUBALLOCATOR_HPP
+#define BUFFER_SUBALLOCATOR_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <map>
+#include <cstddef>
+
+/**
+ * BufferSuballocator 클래스
+ *
+ * 하나의 큰 GPU 버퍼를 여러 mesh 가 나눠 쓸 수 있도록
+ * 버퍼 내의 빈 영역(free block)들을 관리하는 first-fit 방식의 할당기
+ *
+ * 실제 GPU 메모리는 다루지 않고 원소(정점 또는 인덱스) 개수 단위의 offset 만 계산하며,
+ * 해제된 영역은 인접한 빈 영역과 병합하여 단편화를 줄임.
+ */
+class BufferSuballocator
+{
+public:
+  // 할당 실패 시 반환되는 offset
+  static constexpr size_t INVALID_OFFSET = static_cast<size_t>(-1);
+
+  explicit BufferSuballocator(size_t capacity = 0);
+
+  // count 개의 원소를 담을 수 있는 빈 영역을 찾아 offset 반환 (빈 영역이 없으면 INVALID_OFFSET 반환)
+  size_t allocate(size_t count);
+
+  // allocate() 로 할당받은 영역 해제
+  void free(size_t offset, size_t count);
+
+  // 버퍼 크기가 확장되었을 때 늘어난 영역을 빈 영역으로 추가
+  void grow(size_t newCapacity);
+
+  size_t getCapacity() const;
+  size_t getUsedCount() const;
+
+private:
+  // 빈 영역의 시작 offset -> 원소 개수 (offset 순으로 정렬되어 인접한 영역 병합이 쉬움)
+  std::map<size_t, size_t> freeBlocks;
+
+  size_t capacity;
+  size_t usedCount;
+};
+
+#endif /* BUFFER_SUBALLOCATOR_HPP */
@@ -0,0 +1,128 @@
+#ifndef BVH_HPP
+#define BVH_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <vector>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include "mesh/bounding_volume.hpp"
+
+// Bvh 에 쏘는 광선 (direction 은 정규화하지 않아도 되며, 교차 거리는 direction 길이 단위로 계산됨)
+struct BvhRay
+{
+  glm::vec3 origin;
+  glm::vec3 direction;
+};
+
+// Bvh::intersect() 로 찾은 가장 가까운 교차 지점
+struct BvhHit
+{
+  float distance = 0.0f;       // 교차 지점 = origin + direction * distance
+  std::uint32_t triangle = 0;  // Bvh 를 생성할 때 전달한 인덱스 배열 기준 삼각형 번호
+  float u = 0.0f;              // 교차 지점의 barycentric 좌표 (v1, v2 의 weight)
+  float v = 0.0f;
+};
+
+/**
+ * Bvh 클래스
+ *
+ * mesh 의 삼각형들을 AABB 계층 구조로 묶어서 광선과 교차하는 삼각형을 빠르게 찾는 bounding volume hierarchy.
+ *
+ * - 생성 : 각 노드의 삼각형들을 centroid 기준으로 축마다 BvhConstants::NUM_BINS 개의 bin 에 나눠 담고,
+ *   bin 경계 중 SAH(Surface Area Heuristic) 비용이 가장 작은 위치에서 분할함.
+ * - 노드 : 32 bytes 로 압축하여 cache line 하나에 두 노드가 들어가며, 형제 노드는 항상 연속으로 배치하여 오른쪽 자식 인덱스를 저장하지 않음.
+ * - leaf : 최대 PACKET_WIDTH 개의 삼각형을 성분별 배열(SoA) packet 하나에 저장하여, 광선 하나를 packet 의 삼각형들과 SIMD 로 한꺼번에 검사함.
+ *
+ * 삼각형의 정점 좌표를 packet 에 복사해두므로, 생성 이후에는 원본 정점 및 인덱스 배열이 필요하지 않음.
+ */
+class Bvh
+{
+public:
+  // leaf 하나에 저장되는 최대 삼각형 개수 (= SIMD 로 한번에 검사하는 삼각형 개수)
+  static constexpr size_t PACKET_WIDTH = 4;
+
+  /**
+   * positions 와 indices 의 앞에서부터 indexCount 개의 인덱스로 구성된 삼각형들로 BVH 생성
+   *
+   * -> 인덱스 배열에 여러 LOD 가 이어붙여져 있어도 LOD 0 의 인덱스 개수만 전달하면 원본 삼각형들로만 생성할 수 있음.
+   */
+  void build(const std::vector<glm::vec3> &positions, const std::vector<unsigned int> &indices, size_t indexCount);
+
+  /**
+   * 광선과 교차하는 가장 가까운 삼각형 검색 (closest-hit)
+   *
+   * @param maxDistance 이 거리보다 먼 교차는 무시
+   * @return 교차하는 삼각형이 있으면 hit 에 기록하고 true 반환
+   */
+  bool intersect(const BvhRay &ray, float maxDistance, BvhHit &hit) const;
+
+  // maxDistance 이내에 광선과 교차하는 삼각형이 하나라도 있는지 검사 (any-hit, 첫 교차를 찾으면 바로 종료)
+  bool occluded(const BvhRay &ray, float maxDistance) const;
+
+  bool empty() const;
+  size_t getNodeCount() const;
+  size_t getTriangleCount() const;
+
+  // 노드 및 삼각형 packet 이 차지하는 메모리 크기 (bytes)
+  size_t getMemorySize() const;
+
+  // 전체 삼각형을 감싸는 AABB (루트 노드의 AABB)
+  BoundingBox getBounds() const;
+
+private:
+  /*
+    32 bytes 노드
+
+    -> count 가 0 이면 내부 노드이고 leftOrFirst 는 왼쪽 자식 인덱스 (오른쪽 자식은 leftOrFirst + 1)
+    -> count 가 0 보다 크면 leaf 이고 leftOrFirst 는 삼각형 packet 인덱스, count 는 packet 에 들어있는 삼각형 개수
+  */
+  struct Node
+  {
+    float min[3];
+    std::uint32_t leftOrFirst;
+    float max[3];
+    std::uint32_t count;
+  };
+  static_assert(sizeof(Node) == 32, "Bvh::Node must be 32 bytes");
+
+  /*
+    leaf 하나의 삼각형들을 Möller–Trumbore 교차 검사에 필요한 형태(v0, e1 = v1 - v0, e2 = v2 - v0)로 저장한 SoA packet
+
+    -> 삼각형이 PACKET_WIDTH 개보다 적은 leaf 의 남는 lane 은 e1, e2 가 0 인 퇴화 삼각형으로 채워서 교차하지 않도록 함.
+  */
+  struct alignas(16) TrianglePacket
+  {
+    float v0x[PACKET_WIDTH], v0y[PACKET_WIDTH], v0z[PACKET_WIDTH];
+    float e1x[PACKET_WIDTH], e1y[PACKET_WIDTH], e1z[PACKET_WIDTH];
+    float e2x[PACKET_WIDTH], e2y[PACKET_WIDTH], e2z[PACKET_WIDTH];
+    std::uint32_t triangle[PACKET_WIDTH];
+  };
+
+  std::vector<Node> nodes;
+  std::vector<TrianglePacket> packets;
+  size_t triangleCount = 0;
+
+  /*
+    루트부터 광선과 교차하는 노드를 가까운 자식부터 순회하며 leaf 의 packet 들을 검사
+
+    -> AnyHit 이면 첫 교차를 찾는 즉시 true 를 반환하고, 아니면 maxDistance 를 가장 가까운 교차 거리로 줄여가며 끝까지 순회함.
+  */
+  template <bool AnyHit>
+  bool traverse(const BvhRay &ray, float maxDistance, BvhHit &hit) const;
+
+  // 노드 AABB 와 광선의 교차 구간 시작 거리 계산 (origin, inverseDirection 의 w 성분은 0, 교차 구간이 없거나 maxDistance 이후면 false)
+  static bool intersectNode(const Node &node, const glm::vec4 &origin, const glm::vec4 &inverseDirection, float maxDistance, float &entryDistance);
+
+  /**
+   * packet 의 삼각형들과 광선을 동시에 검사하여 maxDistance 보다 가까운 교차 중 가장 가까운 것을 hit 에 기록
+   *
+   * @return 교차하는 삼각형이 있으면 true (hit.distance 는 maxDistance 보다 작아짐)
+   */
+  static bool intersectPacket(const TrianglePacket &packet, const BvhRay &ray, float maxDistance, BvhHit &hit);
+};
+
+#endif /* BVH_HPP */
@@ -0,0 +1,299 @@
+#ifndef GEOMETRY_ARENA_HPP
+#define GEOMETRY_ARENA_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+#include <cstdint>
+#include <type_traits>
+#include <spdlog/spdlog.h>
+#include "mesh/mesh.hpp"
+#include "mesh/buffer_suballocator.hpp"
+#include "gl_objects/vertex_array_object.hpp"
+#include "gl_objects/vertex_buffer_object.hpp"
+#include "gl_objects/index_buffer_object.hpp"
+#include "gl_objects/indirect_buffer_object.hpp"
+#include "gl_context/gl_extensions.hpp"
+
+/**
+ * 템플릿으로 GeometryArena 클래스 선언
+ *
+ * 동일한 정점 포맷(VertexDataType)과 인덱스 타입(IndexType)을 사용하는 여러 Mesh 들의
+ * 정점 및 인덱스를 하나의 큰 VBO, IBO 에 나눠서 저장하는 클래스
+ *
+ * -> 모든 Mesh 가 하나의 VAO 를 공유하므로, Mesh 마다 VAO 를 바인딩할 필요 없이
+ * indirect command 배열 하나로 여러 Mesh 를 glMultiDrawElementsIndirect() 한번에 그릴 수 있음.
+ *
+ * 각 Mesh 는 arena 로부터 할당받은 버퍼 영역(MeshGeometry)만 기록하며,
+ * 버퍼 공간이 부족해지면 더 큰 버퍼를 생성하고 기존 데이터를 GPU 메모리 상에서 복사하여 확장함.
+ */
+template <typename VertexDataType, typename IndexType>
+class GeometryArena
+{
+  static_assert(std::is_same_v<IndexType, std::uint16_t> || std::is_same_v<IndexType, std::uint32_t>, "GeometryArena index type must be std::uint16_t or std::uint32_t");
+
+public:
+  // IBO 에 저장되는 인덱스 타입
+  static constexpr GLenum INDEX_TYPE = std::is_same_v<IndexType, std::uint16_t> ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+
+  GeometryArena(size_t initialVertexCount, size_t initialIndexCount)
+      : vertexAllocator(initialVertexCount), indexAllocator(initialIndexCount)
+  {
+    vbo = std::make_unique<VertexBufferObject>();
+    vbo->setData(nullptr, initialVertexCount * sizeof(VertexDataType), GL_STATIC_DRAW);
+
+    ibo = std::make_unique<IndexBufferObject>();
+    ibo->setData(nullptr, initialIndexCount * sizeof(IndexType), GL_STATIC_DRAW);
+
+    linkBuffers();
+  }
+
+  /**
+   * 정점 및 인덱스를 arena 에 업로드하고, 업로드된 버퍼 영역 반환
+   *
+   * 인덱스는 Mesh 내부의 지역 인덱스 그대로 저장되며, 그리기 명령 시 baseVertex 로 offset 이 더해짐.
+   * (전달받은 인덱스 타입이 IBO 의 인덱스 타입과 같으면 변환용 배열을 만들지 않고 그대로 업로드함)
+   */
+  template <typename SourceIndexType>
+  MeshGeometry allocate(const std::vector<VertexDataType> &vertices, const std::vector<SourceIndexType> &indices)
+  {
+    if (std::is_same_v<IndexType, std::uint16_t> && vertices.size() > MAX_SHORT_INDEXED_VERTICES)
+    {
+      throw std::out_of_range("Too many vertices for 16-bit indexed geometry arena.");
+    }
+
+    // 빈 영역이 부족하면 버퍼를 확장한 뒤 다시 할당
+    size_t baseVertex = vertexAllocator.allocate(vertices.size());
+    if (baseVertex == BufferSuballocator::INVALID_OFFSET)
+    {
+      growVertexBuffer(vertices.size());
+      baseVertex = vertexAllocator.allocate(vertices.size());
+    }
+
+    size_t firstIndex = indexAllocator.allocate(indices.size());
+    if (firstIndex == BufferSuballocator::INVALID_OFFSET)
+    {
+      growIndexBuffer(indices.size());
+      firstIndex = indexAllocator.allocate(indices.size());
+    }
+
+    // 할당받은 영역에 정점 및 인덱스 업로드
+    uploadVertices(baseVertex * sizeof(VertexDataType), vertices.data(), vertices.size() * sizeof(VertexDataType));
+
+    if constexpr (std::is_same_v<SourceIndexType, IndexType>)
+    {
+      uploadIndices(firstIndex * sizeof(IndexType), indices.data(), indices.size() * sizeof(IndexType));
+    }
+    else
+    {
+      std::vector<IndexType> arenaIndices(indices.begin(), indices.end());
+      uploadIndices(firstIndex * sizeof(IndexType), arenaIndices.data(), arenaIndices.size() * sizeof(IndexType));
+    }
+
+    MeshGeometry geometry;
+    geometry.vao = &vao;
+    geometry.indexType = INDEX_TYPE;
+    geometry.baseVertex = static_cast<GLint>(baseVertex);
+    geometry.firstIndex = firstIndex;
+    geometry.vertexCount = vertices.size();
+    geometry.indexCount = indices.size();
+    return geometry;
+  }
+
+  /**
+   * allocate() 에서 GPU 동기화 없이 버퍼를 매핑하여 업로드할지 여부 설정
+   *
+   * free() 한 영역을 읽는 GPU 명령이 모두 끝난 뒤에만 free() 를 호출한다고 보장할 수 있을 때 켜야 함.
+   * (ex> 매 프레임 chunk 를 올리고 내리는 스트리밍 mesh 에서 fence 로 free() 시점을 늦추는 경우)
+   */
+  void setUnsynchronizedUploads(bool enabled)
+  {
+    unsynchronizedUploads = enabled;
+  }
+
+  // allocate() 로 할당받은 버퍼 영역 해제 (해제된 영역은 이후 다른 Mesh 에 재사용됨)
+  void free(const MeshGeometry &geometry)
+  {
+    vertexAllocator.free(static_cast<size_t>(geometry.baseVertex), geometry.vertexCount);
+    indexAllocator.free(geometry.firstIndex, geometry.indexCount);
+  }
+
+  /**
+   * indirect command 배열로 arena 에 저장된 여러 Mesh 를 한번에 그리는 함수
+   *
+   * 각 command 의 baseInstance 는 drawData 배열에서 해당 Mesh 의 per-draw 데이터 위치를 가리켜야 함.
+   * (per-draw 데이터는 divisor 가 1 인 instanced attribute 로 연결되어 있어 baseInstance 위치부터 읽힘)
+   */
+  void multiDraw(GLenum mode, const std::vector<DrawElementsIndirectCommand> &commands, const std::vector<MeshDrawData> &drawData)
+  {
+    if (commands.empty())
+    {
+      return;
+    }
+
+    // 매 프레임 새로 기록되는 데이터이므로 GL_STREAM_DRAW 로 업로드
+    drawDataVbo.setData(drawData.data(), drawData.size() * sizeof(MeshDrawData), GL_STREAM_DRAW);
+    indirectBuffer.setData(commands.data(), commands.size() * sizeof(DrawElementsIndirectCommand), GL_STREAM_DRAW);
+
+    vao.bind();
+    indirectBuffer.bind();
+
+    GLExtensions::multiDrawElementsIndirect(mode, INDEX_TYPE, nullptr, static_cast<GLsizei>(commands.size()), 0);
+
+    indirectBuffer.unbind();
+    vao.unbind();
+  }
+
+  size_t getUsedVertexCount() const
+  {
+    return vertexAllocator.getUsedCount();
+  }
+
+  size_t getUsedIndexCount() const
+  {
+    return indexAllocator.getUsedCount();
+  }
+
+private:
+  // arena 의 모든 Mesh 가 공유하는 VAO (버퍼가 확장되어도 VAO 객체는 유지되므로 MeshGeometry 에 주소값을 저장해도 안전함)
+  VertexArrayObject vao;
+
+  // 정점 및 인덱스 버퍼 (확장 시 새로운 버퍼로 교체됨)
+  std::unique_ptr<VertexBufferObject> vbo;
+  std::unique_ptr<IndexBufferObject> ibo;
+
+  // per-draw 데이터 및 indirect command 버퍼
+  VertexBufferObject drawDataVbo;
+  IndirectBufferObject indirectBuffer;
+
+  // 정점 및 인덱스 버퍼의 빈 영역 관리
+  BufferSuballocator vertexAllocator;
+  BufferSuballocator indexAllocator;
+
+  bool unsynchronizedUploads = false;
+
+  void uploadVertices(GLintptr offset, const void *data, GLsizeiptr size)
+  {
+    if (size == 0)
+    {
+      return;
+    }
+
+    if (unsynchronizedUploads)
+    {
+      vbo->setSubDataUnsynchronized(offset, data, size);
+    }
+    else
+    {
+      vbo->setSubData(offset, data, size);
+    }
+  }
+
+  void uploadIndices(GLintptr offset, const void *data, GLsizeiptr size)
+  {
+    if (size == 0)
+    {
+      return;
+    }
+
+    if (unsynchronizedUploads)
+    {
+      ibo->setSubDataUnsynchronized(offset, data, size);
+    }
+    else
+    {
+      ibo->setSubData(offset, data, size);
+    }
+  }
+
+  // 정점, 인덱스, per-draw 데이터 버퍼를 VAO 에 연결
+  void linkBuffers()
+  {
+    vao.linkVBO(*vbo, Mesh<VertexDataType>::getVertexAttributes());
+    vao.linkIBO(*ibo);
+
+    /*
+      multi draw indirect 를 지원하는 경우에만 per-draw 데이터를 instanced attribute 로 연결
+
+      -> 지원하지 않는 경우에는 attribute 배열을 비활성화된 상태로 두어서,
+      Mesh::draw() 에서 glVertexAttrib*() 로 설정한 상수값을 읽도록 함.
+    */
+    if (GLExtensions::hasMultiDrawIndirect())
+    {
+      std::vector<std::tuple<GLuint, GLint, GLenum, GLboolean, GLsizei, const void *>> attributes = {
+          {POSITION_SCALE_ATTRIBUTE_LOCATION, 3, GL_FLOAT, GL_FALSE, sizeof(MeshDrawData), (void *)(offsetof(MeshDrawData, dequantization) + offsetof(PositionDequantization, scale))},
+          {POSITION_OFFSET_ATTRIBUTE_LOCATION, 3, GL_FLOAT, GL_FALSE, sizeof(MeshDrawData), (void *)(offsetof(MeshDrawData, dequantization) + offsetof(PositionDequantization, offset))},
+      };
+
+      // scene graph 노드의 world transform 및 노멀 행렬은 열(column)마다 연속된 location 에 연결
+      for (GLuint column = 0; column < 4; column++)
+      {
+        attributes.push_back({INSTANCE_MODEL_ATTRIBUTE_LOCATION + column, 4, GL_FLOAT, GL_FALSE, sizeof(MeshDrawData), (void *)(offsetof(MeshDrawData, transform) + sizeof(glm::vec4) * column)});
+      }
+      for (GLuint column = 0; column < 3; column++)
+      {
+        attributes.push_back({INSTANCE_NORMAL_MATRIX_ATTRIBUTE_LOCATION + column, 3, GL_FLOAT, GL_FALSE, sizeof(MeshDrawData), (void *)(offsetof(MeshDrawData, normalMatrix) + sizeof(glm::vec3) * column)});
+      }
+
+      vao.linkVBO(drawDataVbo, attributes);
+      for (const auto &attribute : attributes)
+      {
+        vao.setAttributeDivisor(std::get<0>(attribute), 1);
+      }
+    }
+  }
+
+  // 최소 requiredCount 개의 정점을 추가로 담을 수 있도록 정점 버퍼 확장
+  void growVertexBuffer(size_t requiredCount)
+  {
+    size_t oldCapacity = vertexAllocator.getCapacity();
+    size_t newCapacity = std::max(oldCapacity * 2, oldCapacity + requiredCount);
+
+    auto newVbo = std::make_unique<VertexBufferObject>();
+    newVbo->setData(nullptr, newCapacity * sizeof(VertexDataType), GL_STATIC_DRAW);
+    newVbo->copySubData(*vbo, 0, 0, oldCapacity * sizeof(VertexDataType));
+    vbo = std::move(newVbo);
+
+    // GPU 상의 복사가 끝나기 전에 동기화 없이 같은 영역을 덮어쓰지 않도록, unsynchronized 업로드 중에는 복사가 끝날 때까지 대기 (버퍼 확장은 드물게 발생함)
+    if (unsynchronizedUploads)
+    {
+      glFinish();
+    }
+
+    vertexAllocator.grow(newCapacity);
+    linkBuffers();
+
+    spdlog::info("GeometryArena vertex buffer grown ({} -> {} vertices)", oldCapacity, newCapacity);
+  }
+
+  // 최소 requiredCount 개의 인덱스를 추가로 담을 수 있도록 인덱스 버퍼 확장
+  void growIndexBuffer(size_t requiredCount)
+  {
+    size_t oldCapacity = indexAllocator.getCapacity();
+    size_t newCapacity = std::max(oldCapacity * 2, oldCapacity + requiredCount);
+
+    auto newIbo = std::make_unique<IndexBufferObject>();
+    newIbo->setData(nullptr, newCapacity * sizeof(IndexType), GL_STATIC_DRAW);
+    newIbo->copySubData(*ibo, 0, 0, oldCapacity * sizeof(IndexType));
+    ibo = std::move(newIbo);
+
+    // GPU 상의 복사가 끝나기 전에 동기화 없이 같은 영역을 덮어쓰지 않도록, unsynchronized 업로드 중에는 복사가 끝날 때까지 대기 (버퍼 확장은 드물게 발생함)
+    if (unsynchronizedUploads)
+    {
+      glFinish();
+    }
+
+    indexAllocator.grow(newCapacity);
+    linkBuffers();
+
+    spdlog::info("GeometryArena index buffer grown ({} -> {} indices)", oldCapacity, newCapacity);
+  }
+};
+
+#endif /* GEOMETRY_ARENA_HPP */
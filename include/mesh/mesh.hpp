@@ -13,14 +13,51 @@
 #include "gl_objects/vertex_buffer_object.hpp" // VBO 클래스
 #include "gl_objects/index_buffer_object.hpp"  // IBO 클래스
 #include "gl_objects/texture.hpp"
+#include "gl_context/gl_extensions.hpp"
+#include "mesh/bounding_volume.hpp"
+#include "mesh/meshlet.hpp"
+#include "mesh/bvh.hpp"
 #include <vector>
 #include <tuple>
+#include <utility>
 #include <type_traits> // std::is_same_v<> 사용을 위해 포함
 #include <memory>
 #include <string>
+#include <stdexcept>
+#include <cstdint>
 
 #define MAX_BONE_INFLUENCE 4
 
+// 16-bit(GL_UNSIGNED_SHORT) 인덱스로 참조할 수 있는 최대 정점 개수
+#define MAX_SHORT_INDEXED_VERTICES 65536
+
+// mesh 별 position dequantization 변환을 전달하는 vertex attribute location (pbr.vs 참고)
+#define POSITION_SCALE_ATTRIBUTE_LOCATION 7
+#define POSITION_OFFSET_ATTRIBUTE_LOCATION 8
+
+/*
+  hardware instancing 시 인스턴스별 데이터를 전달하는 vertex attribute location (mat4 는 location 4개, mat3 는 3개를 차지함, pbr.vs 참고)
+
+  -> INSTANCE_MODEL, INSTANCE_NORMAL_MATRIX 는 instancing 을 사용하지 않을 때에도
+  mesh 가 속한 scene graph 노드(또는 RenderQueue 의 per-draw)의 world transform 및 노멀 행렬을 전달하는 데 사용됨.
+  -> GL 3.3 에서 보장되는 attribute location 16개(0 ~ 15)가 정점 포맷(0 ~ 6)과 per-draw 데이터(7 ~ 15)로 모두 사용되므로,
+  Material 파라미터는 pbr.vs 가 읽지 않는 tangent, bitangent location(3, 4)을 사용함.
+  (정점 포맷이 두 location 을 사용하는 Mesh 에는 instance buffer 를 연결할 수 없음, Mesh::linkInstanceBuffer() 참고)
+*/
+#define INSTANCE_MODEL_ATTRIBUTE_LOCATION 9
+#define INSTANCE_NORMAL_MATRIX_ATTRIBUTE_LOCATION 13
+#define INSTANCE_MATERIAL_ATTRIBUTE_LOCATION 3
+#define INSTANCE_ALBEDO_ATTRIBUTE_LOCATION 4
+
+/*
+  skinning 에 사용할 정점별 bone ID 및 weight 를 전달하는 vertex attribute location (pbr.vs 참고)
+
+  -> VertexData 의 m_BoneIDs, m_Weights 와 같은 location 을 사용하며,
+  압축된 정점 포맷(PackedVertexData, QuantizedVertexData)에서는 비어있는 location 이므로 별도 VBO 로 연결함. (Mesh::setSkinning() 참고)
+*/
+#define BONE_IDS_ATTRIBUTE_LOCATION 5
+#define BONE_WEIGHTS_ATTRIBUTE_LOCATION 6
+
 // 메모리 낭비를 줄이기 위한 간소화된 Vertex 구조체 선언
 struct SimpleVertexData
 {
@@ -41,6 +78,137 @@ struct VertexData
   float m_Weights[MAX_BONE_INFLUENCE];
 };
 
+/**
+ * 정적 mesh 의 정점 대역폭을 줄이기 위해 압축된 Vertex 구조체 (24 bytes)
+ *
+ * - Normal : 10:10:10:2 snorm 으로 압축 (GL_INT_2_10_10_10_REV)
+ * - Tangent : 10:10:10:2 snorm 으로 압축하고, w 성분에 bitangent 방향 부호를 저장하여 Bitangent 멤버를 대체
+ * - TexCoords : half float 으로 압축
+ *
+ * -> VertexData 로부터 압축된 정점 데이터를 생성하는 함수들은 mesh/vertex_packing.hpp 참고
+ */
+struct PackedVertexData
+{
+  glm::vec3 Position;
+  std::uint32_t Normal;
+  std::uint32_t Tangent;
+  std::uint16_t TexCoords[2];
+};
+
+/**
+ * PackedVertexData 에서 position 까지 unorm16 으로 양자화한 Vertex 구조체 (20 bytes)
+ *
+ * position 은 mesh 의 AABB 범위를 기준으로 [0, 1] 로 정규화된 뒤 양자화되므로,
+ * 버텍스 쉐이더에서 mesh 별 dequantization 변환(scale, offset)을 적용해서 복원해야 함.
+ * (Position[3] 은 4 bytes 정렬을 맞추기 위한 padding)
+ */
+struct QuantizedVertexData
+{
+  std::uint16_t Position[4];
+  std::uint32_t Normal;
+  std::uint32_t Tangent;
+  std::uint16_t TexCoords[2];
+};
+
+/**
+ * skinning 되는 mesh 의 정점마다 영향을 주는 bone 인덱스와 weight 를 압축한 구조체 (8 bytes)
+ *
+ * - BoneIDs : bone palette 인덱스 (unsigned byte, 쉐이더에서 uvec4 로 읽음)
+ * - Weights : unorm8 로 양자화된 weight (합이 항상 255 가 되도록 양자화됨)
+ *
+ * -> 정적 mesh 의 정점 크기를 늘리지 않도록 ModelVertexData 와 분리된 vertex stream 으로 업로드함.
+ */
+struct SkinVertexData
+{
+  std::uint8_t BoneIDs[MAX_BONE_INFLUENCE];
+  std::uint8_t Weights[MAX_BONE_INFLUENCE];
+};
+
+/**
+ * 양자화된 position 을 원래 좌표로 복원하는 mesh 별 변환 (position = aPos * scale + offset)
+ *
+ * multi draw indirect 로 여러 mesh 를 한번에 그릴 때는 uniform 을 mesh 마다 바꿀 수 없으므로,
+ * 쉐이더에 uniform 대신 vertex attribute 로 전달함. (GeometryArena 에서는 per-draw instanced attribute 로 사용)
+ */
+struct PositionDequantization
+{
+  glm::vec3 scale = glm::vec3(1.0f);
+  glm::vec3 offset = glm::vec3(0.0f);
+};
+
+/**
+ * multi draw indirect 로 여러 mesh 를 한번에 그릴 때 mesh 마다 per-draw instanced VBO 에 저장되는 데이터
+ *
+ * mesh 가 속한 scene graph 노드의 world transform, 그 노멀 행렬 및 position dequantization 변환을 함께 전달함.
+ * (노멀 행렬은 정점마다 inverse() 를 계산하지 않도록 transform 이 바뀔 때 CPU 에서 미리 계산해 둠)
+ */
+struct MeshDrawData
+{
+  glm::mat4 transform = glm::mat4(1.0f);
+  glm::mat3 normalMatrix = glm::mat3(1.0f); // transpose(inverse(mat3(transform)))
+  PositionDequantization dequantization;
+};
+
+/**
+ * hardware instancing 으로 그릴 때 인스턴스마다 instanced VBO 에 저장되는 데이터
+ *
+ * 쉐이더에서는 모델 행렬 앞에 인스턴스의 모델 행렬을 곱하고,
+ * uniform 으로 전송된 Material 파라미터 대신 인스턴스의 Material 파라미터를 사용함.
+ *
+ * 노멀 행렬은 정점마다 inverse() 를 계산하지 않도록 인스턴스 데이터를 채울 때 CPU 에서 미리 계산해 둠.
+ */
+struct InstanceData
+{
+  glm::mat4 model;
+  glm::mat3 normalMatrix; // transpose(inverse(mat3(model)))
+  glm::vec4 material;     // (metallic, roughness, ao, 사용 안함)
+  glm::vec4 albedo;       // (r, g, b, 사용 안함)
+};
+
+/**
+ * Mesh 의 정점 및 인덱스가 저장된 GPU 버퍼 영역
+ *
+ * Mesh 가 자신의 VAO, VBO, IBO 를 직접 소유하는 경우에는 baseVertex, firstIndex 가 항상 0 이고,
+ * 여러 Mesh 가 하나의 GeometryArena 버퍼를 공유하는 경우에는 arena 내에서 할당받은 영역의 offset 이 저장됨.
+ */
+struct MeshGeometry
+{
+  const VertexArrayObject *vao = nullptr; // 그리기 명령 시 바인딩할 VAO
+  GLenum indexType = GL_UNSIGNED_INT;     // IBO 에 업로드된 인덱스 타입
+  GLint baseVertex = 0;                   // 버퍼 내에서 정점이 시작하는 위치 (정점 개수 단위)
+  size_t firstIndex = 0;                  // 버퍼 내에서 인덱스가 시작하는 위치 (인덱스 개수 단위)
+  size_t vertexCount = 0;
+  size_t indexCount = 0;
+};
+
+/**
+ * LOD(Level of Detail) 구조체 선언
+ *
+ * 모든 LOD 의 인덱스는 하나의 IBO 에 이어붙여서 업로드하고,
+ * 각 LOD 는 IBO 내에서 자신의 인덱스 범위만 기록함. (-> 모든 LOD 가 동일한 VBO 를 공유)
+ */
+struct MeshLod
+{
+  size_t indexOffset; // IBO 내에서 LOD 인덱스가 시작하는 위치 (바이트가 아닌 인덱스 개수 단위)
+  size_t indexCount;  // LOD 인덱스 개수
+  float error;        // 원본 mesh 대비 기하 오차 (object space 거리 단위)
+};
+
+// Mesh 의 인덱스 배열 내에서 그릴 구간 (meshlet culling 결과 보이는 meshlet 들을 이어붙인 구간)
+struct MeshIndexRange
+{
+  size_t indexOffset; // 인덱스 개수 단위
+  size_t indexCount;
+};
+
+// 텍스처를 쉐이더의 sampler uniform 에 연결하기 위해 미리 계산해두는 binding 정보
+struct TextureBinding
+{
+  GLint location = -1; // sampler uniform location (쉐이더에서 사용되지 않으면 -1)
+  GLint unit = 0;      // 텍스처를 바인딩할 texture unit 번호
+  GLuint textureId = 0;
+};
+
 // 텍스처 구조체 선언
 struct TextureData
 {
@@ -71,119 +239,546 @@ public:
   // 기본 생성자
   Mesh() {}
 
-  // 생성자 override
-  Mesh(const std::string &name, const std::vector<VertexDataType> &vertices, const std::vector<unsigned int> &indices, const std::vector<TextureData> &textures)
-      : name(name), vertices(vertices), indices(indices), textures(textures)
+  /**
+   * 생성자 override
+   *
+   * 정점, 인덱스, 텍스처 배열은 값으로 전달받아 멤버로 move 하므로,
+   * 호출하는 쪽에서 std::move() 로 넘겨주면 배열 복사 없이 Mesh 를 생성할 수 있음.
+   */
+  Mesh(const std::string &name, std::vector<VertexDataType> vertices, std::vector<unsigned int> indices, std::vector<TextureData> textures)
+      : vertices(std::move(vertices)), indices(std::move(indices)), textures(std::move(textures)), name(name)
   {
     setupMesh();
   }
 
   // 생성자 override (texture 데이터 미전달)
-  Mesh(const std::string &name, const std::vector<VertexDataType> &vertices, const std::vector<unsigned int> &indices)
-      : name(name), vertices(vertices), indices(indices)
+  Mesh(const std::string &name, std::vector<VertexDataType> vertices, std::vector<unsigned int> indices)
+      : vertices(std::move(vertices)), indices(std::move(indices)), name(name)
   {
     setupMesh();
   }
 
+  /**
+   * 생성자 override (GeometryArena 에 이미 업로드된 버퍼 영역 전달)
+   *
+   * 이 경우 Mesh 는 자신의 VAO, VBO, IBO 를 생성하지 않고 arena 의 버퍼 영역(offset, count)만 기록함.
+   */
+  Mesh(const std::string &name, std::vector<VertexDataType> vertices, std::vector<unsigned int> indices, std::vector<TextureData> textures, const MeshGeometry &geometry)
+      : vertices(std::move(vertices)), indices(std::move(indices)), textures(std::move(textures)), geometry(geometry), name(name)
+  {
+    lods = {{0, this->indices.size(), 0.0f}};
+  }
+
   void setDrawMode(GLenum mode)
   {
     drawMode = mode;
   }
 
-  // 소멸자 (의도치 않은 소멸자 호출 감지를 위해 console 출력)
-  ~Mesh()
+  /**
+   * LOD 인덱스 범위 설정
+   *
+   * indices 멤버에 모든 LOD 의 인덱스가 이어붙여져 있을 때 사용하며,
+   * 설정하지 않으면 indices 전체를 하나의 LOD 로 그림.
+   */
+  void setLods(const std::vector<MeshLod> &meshLods)
   {
-    spdlog::info("Mesh <{}> destroyed", name);
+    for (const MeshLod &lod : meshLods)
+    {
+      // CPU 측 indices 가 해제되었을 수 있으므로 GPU 버퍼에 업로드된 인덱스 개수로 검증
+      if (lod.indexOffset + lod.indexCount > geometry.indexCount)
+      {
+        spdlog::error("Mesh <{}> LOD range [{}, {}) exceeds index count {}", name, lod.indexOffset, lod.indexOffset + lod.indexCount, geometry.indexCount);
+        return;
+      }
+    }
+
+    if (!meshLods.empty())
+    {
+      lods = meshLods;
+      currentLod = 0;
+    }
   }
 
-  // 그리기 함수
-  void draw(Shader &shader)
+  const std::vector<MeshLod> &getLods() const
   {
-    /* 각각의 텍스쳐들을 적절한 texture unit 위치에 바인딩 */
-    // 각각의 동일한 타입의 텍스쳐들이 여러 개 사용될 수 있으므로, 텍스쳐 타입별로 구분짓기 위한 번호 counter
-    unsigned int diffuseNr = 1;
-    unsigned int specularNr = 1;
-    unsigned int normalNr = 1;
-    unsigned int heightNr = 1;
+    return lods;
+  }
 
-    // 반복문을 순회하며 쉐이더에 선언된 sampler uniform 변수들의 이름을 파싱함
-    for (unsigned int i = 0; i < textures.size(); i++)
+  // 다음 draw() 호출 시 그릴 LOD 설정
+  void setCurrentLod(size_t lodIndex)
+  {
+    currentLod = lodIndex < lods.size() ? lodIndex : lods.size() - 1;
+  }
+
+  size_t getCurrentLod() const
+  {
+    return currentLod;
+  }
+
+  // object space 기준 bounding sphere 설정 (LOD 선택 시 화면에 투영된 크기 계산에 사용)
+  void setBoundingSphere(const BoundingSphere &sphere)
+  {
+    boundingSphere = sphere;
+  }
+
+  const BoundingSphere &getBoundingSphere() const
+  {
+    return boundingSphere;
+  }
+
+  // object space 기준 AABB 설정 (frustum culling 시 bounding sphere 검사를 통과한 mesh 를 한번 더 검사하는 데 사용)
+  void setBoundingBox(const BoundingBox &box)
+  {
+    boundingBox = box;
+  }
+
+  const BoundingBox &getBoundingBox() const
+  {
+    return boundingBox;
+  }
+
+  // 양자화된 position 을 복원할 때 사용할 dequantization 변환 설정 (QuantizedVertexData 전용)
+  void setPositionDequantization(const PositionDequantization &dequantization)
+  {
+    positionDequantization = dequantization;
+  }
+
+  const PositionDequantization &getPositionDequantization() const
+  {
+    return positionDequantization;
+  }
+
+  /**
+   * mesh 가 속한 scene graph 노드의 world transform 설정 (모델 행렬 앞에 적용됨)
+   *
+   * 동일한 mesh 데이터를 여러 노드가 참조하거나 노드가 움직이는 경우에도 정점 데이터를 다시 업로드하지 않고 transform 만 바꿔서 그림.
+   */
+  void setNodeTransform(const glm::mat4 &transform)
+  {
+    // 노드 transform 은 non-uniform scale 을 포함할 수 있으므로, 바뀔 때마다 노멀 행렬을 역전치 행렬로 다시 계산
+    nodeTransform = transform;
+    nodeNormalMatrix = glm::transpose(glm::inverse(glm::mat3(transform)));
+  }
+
+  const glm::mat4 &getNodeTransform() const
+  {
+    return nodeTransform;
+  }
+
+  const glm::mat3 &getNodeNormalMatrix() const
+  {
+    return nodeNormalMatrix;
+  }
+
+  // multi draw indirect 로 그릴 때 per-draw 데이터 배열에 기록할 데이터 반환
+  MeshDrawData getDrawData() const
+  {
+    return {nodeTransform, nodeNormalMatrix, positionDequantization};
+  }
+
+  const MeshGeometry &getGeometry() const
+  {
+    return geometry;
+  }
+
+  /**
+   * LOD 0 의 인덱스 범위를 나눈 meshlet 목록 설정
+   *
+   * meshlet 들은 LOD 0 인덱스 범위를 앞에서부터 빈틈없이 나눠서 차지해야 하며 (MeshletBuilder::build() 참고),
+   * 매 프레임 meshlet 가시성을 기록할 배열과 그리기 구간 배열도 미리 할당하여 프레임 중에는 재할당이 일어나지 않도록 함.
+   */
+  void setMeshlets(const std::vector<Meshlet> &meshlets)
+  {
+    meshletRanges.resize(meshlets.size());
+    for (size_t i = 0; i < meshlets.size(); i++)
     {
-      // 현재 순회중인 텍스쳐 객체를 바인딩할 texture unit 활성화
-      glActiveTexture(GL_TEXTURE0 + i);
+      meshletRanges[i] = {meshlets[i].indexOffset, meshlets[i].indexCount};
+    }
 
-      std::string number;                  // 현재 순회중인 텍스쳐의 번호를 문자열로 저장할 변수 (타입이 동일한 텍스쳐 간 구분 목적)
-      std::string name = textures[i].type; // 현재 순회중인 텍스쳐의 타입을 문자열로 저장할 변수
+    meshletBatch.set(meshlets);
+    meshletVisibility.assign(meshlets.size(), 1);
 
-      // 현재 순회중인 텍스쳐 타입과 순서에 따라 현재 텍스쳐의 번호를 저장한 뒤,
-      // 타입별 텍스쳐 번호 counter 를 누산시킴.
-      if (name == "texture_diffuse")
-      {
-        // 참고로, increment operator(++) 가 postfix 로 붙어있기 때문에,
-        // 현재 ~Nr 변수에 들어있는 unsigned int -> string 으로 먼저 변환한 뒤,
-        // ~Nr 변수의 값을 1 증가시키는 것. 즉, 문자열 변환 먼저, 그 값 증가!
-        number = std::to_string(diffuseNr++);
-      }
-      else if (name == "texture_specular")
+    visibleRanges.reserve(meshlets.size());
+    multiDrawCounts.reserve(meshlets.size());
+    multiDrawOffsets.reserve(meshlets.size());
+    multiDrawBaseVertices.reserve(meshlets.size());
+  }
+
+  size_t getMeshletCount() const
+  {
+    return meshletRanges.size();
+  }
+
+  // meshlet 들의 bounding sphere 및 normal cone (SoA)
+  const MeshletBatch &getMeshletBatch() const
+  {
+    return meshletBatch;
+  }
+
+  // meshlet culling 결과를 기록할 meshlet 별 가시성 배열 (여러 스레드가 서로 다른 구간에 기록할 수 있도록 포인터로 반환)
+  std::uint8_t *getMeshletVisibility()
+  {
+    return meshletVisibility.data();
+  }
+
+  /**
+   * getMeshletVisibility() 에 기록된 culling 결과로 다음 draw() 에서 그릴 인덱스 구간들을 생성
+   *
+   * 보이는 meshlet 들 중 인덱스 배열 상에서 연속된 것들은 하나의 구간으로 합쳐서 draw 명령 개수를 줄임.
+   *
+   * @return culling 되어 그리지 않게 된 삼각형 개수
+   */
+  size_t compactVisibleMeshlets()
+  {
+    visibleRanges.clear();
+    visibleMeshletTriangleCount = 0;
+
+    size_t culledTriangleCount = 0;
+    for (size_t i = 0; i < meshletRanges.size(); i++)
+    {
+      const MeshIndexRange &range = meshletRanges[i];
+      if (!meshletVisibility[i])
       {
-        number = std::to_string(specularNr++);
+        culledTriangleCount += range.indexCount / 3;
+        continue;
       }
-      else if (name == "texture_normal")
+
+      visibleMeshletTriangleCount += range.indexCount / 3;
+      if (!visibleRanges.empty() && visibleRanges.back().indexOffset + visibleRanges.back().indexCount == range.indexOffset)
       {
-        number = std::to_string(normalNr++);
+        visibleRanges.back().indexCount += range.indexCount;
       }
-      else if (name == "texture_height")
+      else
       {
-        number = std::to_string(heightNr++);
+        visibleRanges.push_back(range);
       }
+    }
+
+    useVisibleRanges = true;
+    return culledTriangleCount;
+  }
+
+  // meshlet culling 결과를 사용하지 않고 현재 LOD 전체를 그리도록 설정
+  void clearVisibleMeshlets()
+  {
+    useVisibleRanges = false;
+  }
+
+  // 다음 draw() 에서 meshlet culling 결과로 생성된 구간들만 그리는지 여부 (LOD 0 을 그릴 때만 적용됨)
+  bool isUsingVisibleMeshlets() const
+  {
+    return useVisibleRanges && currentLod == 0;
+  }
+
+  const std::vector<MeshIndexRange> &getVisibleMeshletRanges() const
+  {
+    return visibleRanges;
+  }
+
+  // 다음 draw() 에서 그려질 삼각형 개수
+  size_t getDrawnTriangleCount() const
+  {
+    return isUsingVisibleMeshlets() ? visibleMeshletTriangleCount : lods[currentLod].indexCount / 3;
+  }
+
+  // 현재 LOD 를 그리기 위한 indirect command 반환 (baseInstance 는 per-draw 데이터 배열에서 이 Mesh 의 데이터 위치)
+  DrawElementsIndirectCommand getIndirectCommand(GLuint baseInstance) const
+  {
+    const MeshLod &lod = lods[currentLod];
+
+    DrawElementsIndirectCommand command;
+    command.count = static_cast<GLuint>(lod.indexCount);
+    command.instanceCount = 1;
+    command.firstIndex = static_cast<GLuint>(geometry.firstIndex + lod.indexOffset);
+    command.baseVertex = geometry.baseVertex;
+    command.baseInstance = baseInstance;
+    return command;
+  }
+
+  // 인덱스 배열의 특정 구간을 그리기 위한 indirect command 반환 (meshlet culling 결과 구간을 그릴 때 사용)
+  DrawElementsIndirectCommand getIndirectCommand(const MeshIndexRange &range, GLuint baseInstance) const
+  {
+    DrawElementsIndirectCommand command;
+    command.count = static_cast<GLuint>(range.indexCount);
+    command.instanceCount = 1;
+    command.firstIndex = static_cast<GLuint>(geometry.firstIndex + range.indexOffset);
+    command.baseVertex = geometry.baseVertex;
+    command.baseInstance = baseInstance;
+    return command;
+  }
+
+  /**
+   * GPU 에 업로드가 끝난 정점 및 인덱스 배열의 CPU 메모리 해제
+   *
+   * 그리기에는 GPU 버퍼와 LOD 인덱스 범위만 사용되므로, CPU 측 geometry 가 필요한 경우가 아니라면
+   * 업로드 직후 해제하여 메모리 사용량을 줄임. (picking 은 삼각형을 자체적으로 보관하는 Bvh 를 사용하므로 필요 없음)
+   */
+  void releaseCpuData()
+  {
+    // clear() 만으로는 capacity 가 유지되므로, 빈 배열과 교환하여 메모리를 실제로 반납함
+    std::vector<VertexDataType>().swap(vertices);
+    std::vector<unsigned int>().swap(indices);
+  }
+
+  // CPU 측 정점 및 인덱스 배열을 보관하고 있는지 여부
+  bool hasCpuData() const
+  {
+    return !vertices.empty();
+  }
+
+  // LOD 0 의 삼각형들로 생성된 BVH 설정 (여러 스레드에서 읽기만 하므로 const 로 공유)
+  void setBvh(std::shared_ptr<const Bvh> meshBvh)
+  {
+    bvh = std::move(meshBvh);
+  }
+
+  // 광선 검사에 사용할 object space 기준 BVH (생성되지 않았으면 nullptr)
+  const Bvh *getBvh() const
+  {
+    return bvh.get();
+  }
+
+  const std::string &getName() const
+  {
+    return name;
+  }
+
+  // 소멸자 (의도치 않은 소멸자 호출 감지를 위해 console 출력)
+  ~Mesh()
+  {
+    spdlog::info("Mesh <{}> destroyed", name);
+  }
+
+  /**
+   * 각각의 텍스쳐들을 적절한 texture unit 위치에 바인딩하는 함수 (여러 Mesh 를 한번에 그릴 때도 사용)
+   *
+   * sampler uniform 이름 생성 및 location 조회는 Mesh 가 처음 쉐이더와 함께 그려질 때 한번만 수행하여
+   * binding table 에 저장해두고, 이후에는 table 을 순회하며 uniform 전송 및 텍스쳐 바인딩만 수행함.
+   * -> 매 프레임 문자열 생성에 의한 heap 할당 및 glGetUniformLocation() 호출이 발생하지 않음.
+   */
+  void bindTextures(Shader &shader) const
+  {
+    // 다른 쉐이더 프로그램과 함께 그려지면 uniform location 이 달라지므로 binding table 을 다시 생성
+    if (textureBindingShaderId != shader.ID)
+    {
+      buildTextureBindings(shader);
+    }
+
+    for (const TextureBinding &binding : textureBindings)
+    {
+      // 현재 순회중인 텍스쳐 객체를 바인딩할 texture unit 활성화
+      glActiveTexture(GL_TEXTURE0 + binding.unit);
 
-      // '텍스쳐 타입 + 텍스쳐 번호' 로 파싱한 uniform sampler 변수명을 c-style 문자열로 변환한 뒤,
       // 쉐이더 프로그램에 해당 sampler 가 가져다 쓸 텍스쳐 객체가 바인딩되어 있는 texture unit 값 전달
-      shader.setInt((name + number).c_str(), i);
+      // (쉐이더에서 사용되지 않는 sampler 는 location 이 -1 이므로 전송하지 않음)
+      if (binding.location != -1)
+      {
+        glUniform1i(binding.location, binding.unit);
+      }
 
       // 현재 활성화된 texture unit 위치에 현재 순회중인 텍스쳐 객체 바인딩
-      glBindTexture(GL_TEXTURE_2D, textures[i].id);
+      glBindTexture(GL_TEXTURE_2D, binding.textureId);
+    }
+  }
+
+  /**
+   * 인스턴스별 데이터(InstanceData)가 저장된 VBO 를 Mesh 의 VAO 에 instanced attribute 로 연결
+   *
+   * GeometryArena 를 공유하는 Mesh 는 VAO 를 다른 Mesh 들과 공유하므로 연결할 수 없고,
+   * 인스턴스 Material 파라미터 location 을 정점 데이터로 사용하는 정점 포맷(tangent, bitangent 가 있는 포맷)이면
+   * 정점 데이터가 인스턴스 데이터로 덮어써지므로 예외를 던짐.
+   */
+  void linkInstanceBuffer(const VertexBufferObject &instanceVbo)
+  {
+    if (!vao)
+    {
+      spdlog::error("Mesh <{}> does not own a VAO, instance buffer cannot be linked", name);
+      return;
+    }
+
+    for (const auto &attribute : getVertexAttributes())
+    {
+      const GLuint location = std::get<0>(attribute);
+      if (location == INSTANCE_MATERIAL_ATTRIBUTE_LOCATION || location == INSTANCE_ALBEDO_ATTRIBUTE_LOCATION)
+      {
+        throw std::runtime_error("Mesh <" + name + "> uses vertex attribute location " + std::to_string(location) + " reserved for instance materials.");
+      }
+    }
+
+    // mat4, mat3 attribute 는 열(column) 단위로 나눠서 연속된 location 에 연결함
+    std::vector<std::tuple<GLuint, GLint, GLenum, GLboolean, GLsizei, const void *>> attributes;
+    for (GLuint column = 0; column < 4; column++)
+    {
+      attributes.push_back({INSTANCE_MODEL_ATTRIBUTE_LOCATION + column, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void *)(offsetof(InstanceData, model) + sizeof(glm::vec4) * column)});
+    }
+    for (GLuint column = 0; column < 3; column++)
+    {
+      attributes.push_back({INSTANCE_NORMAL_MATRIX_ATTRIBUTE_LOCATION + column, 3, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void *)(offsetof(InstanceData, normalMatrix) + sizeof(glm::vec3) * column)});
+    }
+    attributes.push_back({INSTANCE_MATERIAL_ATTRIBUTE_LOCATION, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void *)offsetof(InstanceData, material)});
+    attributes.push_back({INSTANCE_ALBEDO_ATTRIBUTE_LOCATION, 3, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void *)offsetof(InstanceData, albedo)});
+
+    vao->linkVBO(instanceVbo, attributes);
+
+    // 정점마다가 아니라 인스턴스마다 다음 데이터를 읽도록 divisor 설정
+    for (const auto &attribute : attributes)
+    {
+      vao->setAttributeDivisor(std::get<0>(attribute), 1);
+    }
+  }
+
+  /**
+   * 정점별 bone ID 및 weight 를 별도 VBO 에 업로드하여 Mesh 의 VAO 에 연결
+   *
+   * GeometryArena 를 공유하는 Mesh 는 VAO 를 다른 Mesh 들과 공유하므로 연결할 수 없고,
+   * VertexData 포맷의 Mesh 는 같은 location 을 이미 정점 데이터로 사용하므로 압축된 정점 포맷에서만 사용해야 함.
+   */
+  void setSkinning(const std::vector<SkinVertexData> &skinVertices)
+  {
+    if (!vao)
+    {
+      spdlog::error("Mesh <{}> does not own a VAO, skinning buffer cannot be linked", name);
+      return;
+    }
+
+    skinVbo = std::make_unique<VertexBufferObject>();
+    skinVbo->setData(skinVertices.data(), skinVertices.size() * sizeof(SkinVertexData), GL_STATIC_DRAW);
+
+    // bone ID 는 정규화하지 않은 정수형 attribute 로, weight 는 [0, 1] 범위로 정규화된 attribute 로 연결
+    vao->linkVBO(*skinVbo, {{BONE_IDS_ATTRIBUTE_LOCATION, MAX_BONE_INFLUENCE, GL_UNSIGNED_BYTE, GL_FALSE, sizeof(SkinVertexData), (void *)offsetof(SkinVertexData, BoneIDs)},
+                            {BONE_WEIGHTS_ATTRIBUTE_LOCATION, MAX_BONE_INFLUENCE, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(SkinVertexData), (void *)offsetof(SkinVertexData, Weights)}});
+  }
+
+  // bone palette 로 skinning 되는 Mesh 인지 여부
+  bool isSkinned() const
+  {
+    return skinVbo != nullptr;
+  }
+
+  // linkInstanceBuffer() 로 연결된 instanced VBO 의 앞에서부터 instanceCount 개의 인스턴스를 한번의 draw call 로 그리는 함수
+  void drawInstanced(Shader &shader, GLsizei instanceCount)
+  {
+    bindTextures(shader);
+
+    glVertexAttrib3fv(POSITION_SCALE_ATTRIBUTE_LOCATION, &positionDequantization.scale[0]);
+    glVertexAttrib3fv(POSITION_OFFSET_ATTRIBUTE_LOCATION, &positionDequantization.offset[0]);
+
+    geometry.vao->bind();
+
+    const MeshLod &lod = lods[currentLod];
+    const size_t indexSize = geometry.indexType == GL_UNSIGNED_SHORT ? sizeof(std::uint16_t) : sizeof(unsigned int);
+    glDrawElementsInstancedBaseVertex(drawMode, static_cast<GLsizei>(lod.indexCount), geometry.indexType, (void *)((geometry.firstIndex + lod.indexOffset) * indexSize), instanceCount, geometry.baseVertex);
+
+    geometry.vao->unbind();
+
+    glActiveTexture(0);
+  }
+
+  // 그리기 함수
+  void draw(Shader &shader)
+  {
+    bindTextures(shader);
+
+    /*
+      양자화된 position 을 복원할 dequantization 변환 전송
+
+      -> 양자화되지 않은 mesh 는 항등 변환(scale = 1, offset = 0)을 전송해서
+      이전에 그려진 양자화된 mesh 의 변환값이 쉐이더에 남아있지 않도록 함.
+
+      -> 해당 attribute 는 VAO 에서 배열로 활성화되어 있지 않으므로,
+      glVertexAttrib*() 로 설정한 값이 모든 정점에서 상수로 읽힘.
+    */
+    glVertexAttrib3fv(POSITION_SCALE_ATTRIBUTE_LOCATION, &positionDequantization.scale[0]);
+    glVertexAttrib3fv(POSITION_OFFSET_ATTRIBUTE_LOCATION, &positionDequantization.offset[0]);
+
+    // scene graph 노드의 world transform 및 노멀 행렬도 같은 방식으로 열(column)마다 상수 attribute 로 전송
+    for (GLuint column = 0; column < 4; column++)
+    {
+      glVertexAttrib4fv(INSTANCE_MODEL_ATTRIBUTE_LOCATION + column, &nodeTransform[column][0]);
+    }
+    for (GLuint column = 0; column < 3; column++)
+    {
+      glVertexAttrib3fv(INSTANCE_NORMAL_MATRIX_ATTRIBUTE_LOCATION + column, &nodeNormalMatrix[column][0]);
     }
 
     /* 실제 Mesh 그리기 명령 수행 */
 
     // VAO 객체를 바인딩하여 이에 저장된 설정대로 그리도록 명령
-    vao.bind();
+    geometry.vao->bind();
 
-    // indexed drawing 명령 수행
-    glDrawElements(drawMode, static_cast<unsigned int>(indices.size()), GL_UNSIGNED_INT, 0);
+    /*
+      현재 LOD 의 인덱스 범위만 indexed drawing 명령 수행 (IBO 에 업로드된 인덱스 타입에 맞춰 그림)
+
+      -> GeometryArena 를 공유하는 Mesh 는 버퍼 내 자신의 영역(firstIndex, baseVertex)을 기준으로 그림.
+      -> meshlet culling 결과를 사용하는 경우에는 보이는 구간들만 glMultiDrawElementsBaseVertex() 한번으로 그림.
+    */
+    const size_t indexSize = geometry.indexType == GL_UNSIGNED_SHORT ? sizeof(std::uint16_t) : sizeof(unsigned int);
+    if (isUsingVisibleMeshlets())
+    {
+      multiDrawCounts.clear();
+      multiDrawOffsets.clear();
+      multiDrawBaseVertices.clear();
+      for (const MeshIndexRange &range : visibleRanges)
+      {
+        multiDrawCounts.push_back(static_cast<GLsizei>(range.indexCount));
+        multiDrawOffsets.push_back((const void *)((geometry.firstIndex + range.indexOffset) * indexSize));
+        multiDrawBaseVertices.push_back(geometry.baseVertex);
+      }
+
+      if (!multiDrawCounts.empty())
+      {
+        glMultiDrawElementsBaseVertex(drawMode, multiDrawCounts.data(), geometry.indexType, multiDrawOffsets.data(), static_cast<GLsizei>(multiDrawCounts.size()), multiDrawBaseVertices.data());
+      }
+    }
+    else
+    {
+      const MeshLod &lod = lods[currentLod];
+      glDrawElementsBaseVertex(drawMode, static_cast<GLsizei>(lod.indexCount), geometry.indexType, (void *)((geometry.firstIndex + lod.indexOffset) * indexSize), geometry.baseVertex);
+    }
 
     // 그리기 명령을 완료했으므로, 바인딩했던 VAO 객체 해제
-    vao.unbind();
+    geometry.vao->unbind();
 
     // 그리기 명령 완료 후, 활성 texture unit 을 다시 기본값으로 초기화함.
     glActiveTexture(0);
   }
 
-private:
-  // VAO, VBO, IBO 객체
-  VertexArrayObject vao;
-  VertexBufferObject vbo;
-  IndexBufferObject ibo;
+  /**
+   * 현재 LOD 와 노드 transform 대신 전달받은 LOD 및 world transform, 노멀 행렬로 그리는 함수 (RenderQueue 에서 사용)
+   *
+   * 같은 Mesh 를 여러 오브젝트가 서로 다른 LOD 로 그릴 수 있도록 Mesh 의 상태를 바꾸지 않으며,
+   * 텍스쳐는 호출하는 쪽에서 바뀔 때만 bindTextures() 로 바인딩한다고 가정하여 바인딩하지 않음.
+   */
+  void drawLod(size_t lodIndex, const glm::mat4 &transform, const glm::mat3 &normalMatrix) const
+  {
+    glVertexAttrib3fv(POSITION_SCALE_ATTRIBUTE_LOCATION, &positionDequantization.scale[0]);
+    glVertexAttrib3fv(POSITION_OFFSET_ATTRIBUTE_LOCATION, &positionDequantization.offset[0]);
 
-  // draw mode
-  GLenum drawMode = GL_TRIANGLES; // 기본값
+    for (GLuint column = 0; column < 4; column++)
+    {
+      glVertexAttrib4fv(INSTANCE_MODEL_ATTRIBUTE_LOCATION + column, &transform[column][0]);
+    }
+    for (GLuint column = 0; column < 3; column++)
+    {
+      glVertexAttrib3fv(INSTANCE_NORMAL_MATRIX_ATTRIBUTE_LOCATION + column, &normalMatrix[column][0]);
+    }
 
-  // mesh name
-  std::string name;
+    geometry.vao->bind();
 
-  // 버퍼 설정 함수
-  void setupMesh()
-  {
-    // VAO 바인딩
-    vao.bind();
-
-    // VBO에 데이터 설정
-    vbo.setData(vertices.data(), vertices.size() * sizeof(VertexDataType), GL_STATIC_DRAW);
+    const MeshLod &lod = lods[lodIndex];
+    const size_t indexSize = geometry.indexType == GL_UNSIGNED_SHORT ? sizeof(std::uint16_t) : sizeof(unsigned int);
+    glDrawElementsBaseVertex(drawMode, static_cast<GLsizei>(lod.indexCount), geometry.indexType, (void *)((geometry.firstIndex + lod.indexOffset) * indexSize), geometry.baseVertex);
 
-    // IBO에 데이터 설정
-    ibo.setData(indices.data(), indices.size() * sizeof(unsigned int), GL_STATIC_DRAW);
+    geometry.vao->unbind();
+  }
 
+  /**
+   * 템플릿 파라미터인 VertexType 에 따라 각 정점 데이터 해석 방식을 정의하는 데이터 쌍을 tuple 구조로 반환
+   *
+   * Mesh 가 직접 소유하는 VAO 뿐만 아니라, 동일한 정점 포맷의 Mesh 들이 공유하는 GeometryArena 의 VAO 설정에도 사용됨.
+   */
+  static std::vector<std::tuple<GLuint, GLint, GLenum, GLboolean, GLsizei, const void *>> getVertexAttributes()
+  {
     // 각 정점 데이터 해석 방식을 정의하는 데이터 쌍을 tuple 구조로 저장할 변수 초기화
     std::vector<std::tuple<GLuint, GLint, GLenum, GLboolean, GLsizei, const void *>> attributes;
 
@@ -208,7 +803,7 @@ private:
           {2, 2, GL_FLOAT, GL_FALSE, sizeof(VertexData), (void *)offsetof(VertexData, TexCoords)},
           {3, 3, GL_FLOAT, GL_FALSE, sizeof(VertexData), (void *)offsetof(VertexData, Tangent)},
           {4, 3, GL_FLOAT, GL_FALSE, sizeof(VertexData), (void *)offsetof(VertexData, Bitangent)},
-          {5, 4, GL_FLOAT, GL_FALSE, sizeof(VertexData), (void *)offsetof(VertexData, m_BoneIDs)},
+          {5, 4, GL_INT, GL_FALSE, sizeof(VertexData), (void *)offsetof(VertexData, m_BoneIDs)}, // bone ID 는 정수형 attribute 로 연결 (VertexArrayObject::linkVBO() 참고)
           {6, 4, GL_FLOAT, GL_FALSE, sizeof(VertexData), (void *)offsetof(VertexData, m_Weights)}};
     }
     else if constexpr (std::is_same_v<VertexDataType, SimpleVertexData>)
@@ -218,15 +813,185 @@ private:
           {1, 3, GL_FLOAT, GL_FALSE, sizeof(SimpleVertexData), (void *)offsetof(SimpleVertexData, Normal)},
           {2, 2, GL_FLOAT, GL_FALSE, sizeof(SimpleVertexData), (void *)offsetof(SimpleVertexData, TexCoords)}};
     }
+    else if constexpr (std::is_same_v<VertexDataType, PackedVertexData>)
+    {
+      // GL_INT_2_10_10_10_REV 포맷은 size 를 항상 4 로 지정해야 함. (쉐이더에서 vec3 로 선언해도 나머지 성분은 무시됨)
+      attributes = {
+          {0, 3, GL_FLOAT, GL_FALSE, sizeof(PackedVertexData), (void *)offsetof(PackedVertexData, Position)},
+          {1, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof(PackedVertexData), (void *)offsetof(PackedVertexData, Normal)},
+          {2, 2, GL_HALF_FLOAT, GL_FALSE, sizeof(PackedVertexData), (void *)offsetof(PackedVertexData, TexCoords)},
+          {3, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof(PackedVertexData), (void *)offsetof(PackedVertexData, Tangent)}};
+    }
+    else if constexpr (std::is_same_v<VertexDataType, QuantizedVertexData>)
+    {
+      // unorm16 position 은 normalized 로 연결하여 쉐이더에서 [0, 1] 범위의 vec3 로 읽음
+      attributes = {
+          {0, 3, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(QuantizedVertexData), (void *)offsetof(QuantizedVertexData, Position)},
+          {1, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof(QuantizedVertexData), (void *)offsetof(QuantizedVertexData, Normal)},
+          {2, 2, GL_HALF_FLOAT, GL_FALSE, sizeof(QuantizedVertexData), (void *)offsetof(QuantizedVertexData, TexCoords)},
+          {3, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof(QuantizedVertexData), (void *)offsetof(QuantizedVertexData, Tangent)}};
+    }
+    return attributes;
+  }
+
+private:
+  /**
+   * VAO, VBO, IBO 객체
+   *
+   * GeometryArena 에 정점 및 인덱스를 업로드한 Mesh 는 버퍼 객체를 직접 소유하지 않으므로 포인터로 관리함.
+   */
+  std::unique_ptr<VertexArrayObject> vao;
+  std::unique_ptr<VertexBufferObject> vbo;
+  std::unique_ptr<IndexBufferObject> ibo;
+
+  // skinning 되는 Mesh 의 정점별 bone ID 및 weight 를 저장하는 VBO (skinning 되지 않으면 nullptr)
+  std::unique_ptr<VertexBufferObject> skinVbo;
+
+  // 그리기 명령 시 사용할 버퍼 영역
+  MeshGeometry geometry;
+
+  // draw mode
+  GLenum drawMode = GL_TRIANGLES; // 기본값
+
+  // LOD 별 인덱스 범위 및 현재 그릴 LOD
+  std::vector<MeshLod> lods;
+  size_t currentLod = 0;
+
+  // object space 기준 bounding sphere 및 AABB
+  BoundingSphere boundingSphere;
+  BoundingBox boundingBox;
+
+  // mesh name
+  std::string name;
+
+  // LOD 0 의 삼각형들로 생성된 BVH (picking 등 광선 검사에 사용)
+  std::shared_ptr<const Bvh> bvh;
+
+  // 양자화된 position 복원 변환 (기본값은 항등 변환)
+  PositionDequantization positionDequantization;
+
+  // mesh 가 속한 scene graph 노드의 world transform 및 그 노멀 행렬 (기본값은 단위 행렬)
+  glm::mat4 nodeTransform = glm::mat4(1.0f);
+  glm::mat3 nodeNormalMatrix = glm::mat3(1.0f);
+
+  // LOD 0 을 나눈 meshlet 들의 인덱스 구간, bounding volume 및 매 프레임 culling 결과
+  std::vector<MeshIndexRange> meshletRanges;
+  MeshletBatch meshletBatch;
+  std::vector<std::uint8_t> meshletVisibility;
+
+  // meshlet culling 결과 보이는 meshlet 들을 합친 그리기 구간
+  std::vector<MeshIndexRange> visibleRanges;
+  size_t visibleMeshletTriangleCount = 0;
+  bool useVisibleRanges = false;
+
+  // glMultiDrawElementsBaseVertex() 에 전달할 구간별 인덱스 개수, offset, baseVertex 배열 (매 프레임 재할당하지 않도록 멤버로 유지)
+  std::vector<GLsizei> multiDrawCounts;
+  std::vector<const void *> multiDrawOffsets;
+  std::vector<GLint> multiDrawBaseVertices;
+
+  /*
+    텍스쳐별 sampler uniform location, texture unit 및 텍스쳐 ID 를 저장한 binding table 과 이를 생성할 때 사용된 쉐이더 프로그램 ID
+
+    -> const 멤버 함수인 bindTextures() 에서 처음 그려질 때 생성되는 캐시이므로 mutable 로 선언함.
+    -> textures 멤버는 Mesh 생성 이후 변경되지 않는다고 가정함.
+  */
+  mutable std::vector<TextureBinding> textureBindings;
+  mutable GLuint textureBindingShaderId = 0;
+
+  // 텍스쳐 타입과 순서에 따라 sampler uniform 이름을 파싱하여 binding table 생성
+  void buildTextureBindings(const Shader &shader) const
+  {
+    // 각각의 동일한 타입의 텍스쳐들이 여러 개 사용될 수 있으므로, 텍스쳐 타입별로 구분짓기 위한 번호 counter
+    unsigned int diffuseNr = 1;
+    unsigned int specularNr = 1;
+    unsigned int normalNr = 1;
+    unsigned int heightNr = 1;
+
+    textureBindings.clear();
+    textureBindings.reserve(textures.size());
+
+    // 반복문을 순회하며 쉐이더에 선언된 sampler uniform 변수들의 이름을 파싱함
+    for (unsigned int i = 0; i < textures.size(); i++)
+    {
+      std::string number;                         // 현재 순회중인 텍스쳐의 번호를 문자열로 저장할 변수 (타입이 동일한 텍스쳐 간 구분 목적)
+      const std::string &type = textures[i].type; // 현재 순회중인 텍스쳐의 타입
+
+      // 현재 순회중인 텍스쳐 타입과 순서에 따라 현재 텍스쳐의 번호를 저장한 뒤,
+      // 타입별 텍스쳐 번호 counter 를 누산시킴. (postfix increment 이므로 문자열 변환 먼저, 그 값 증가!)
+      if (type == "texture_diffuse")
+      {
+        number = std::to_string(diffuseNr++);
+      }
+      else if (type == "texture_specular")
+      {
+        number = std::to_string(specularNr++);
+      }
+      else if (type == "texture_normal")
+      {
+        number = std::to_string(normalNr++);
+      }
+      else if (type == "texture_height")
+      {
+        number = std::to_string(heightNr++);
+      }
+
+      // '텍스쳐 타입 + 텍스쳐 번호' 로 파싱한 uniform sampler 변수의 location 을 쉐이더의 uniform 테이블에서 조회하여 저장
+      TextureBinding binding;
+      binding.location = shader.getUniformLocation(type + number);
+      binding.unit = static_cast<GLint>(i);
+      binding.textureId = textures[i].id;
+      textureBindings.push_back(binding);
+    }
+
+    textureBindingShaderId = shader.ID;
+  }
+
+  // 버퍼 설정 함수
+  void setupMesh()
+  {
+    // Mesh 전용 VAO, VBO, IBO 객체 생성
+    vao = std::make_unique<VertexArrayObject>();
+    vbo = std::make_unique<VertexBufferObject>();
+    ibo = std::make_unique<IndexBufferObject>();
+
+    // VAO 바인딩
+    vao->bind();
+
+    // VBO에 데이터 설정
+    vbo->setData(vertices.data(), vertices.size() * sizeof(VertexDataType), GL_STATIC_DRAW);
+
+    /*
+      IBO에 데이터 설정
+
+      정점 개수가 16-bit 인덱스 범위 이내라면 인덱스를 GL_UNSIGNED_SHORT 로 변환해서 업로드하여
+      인덱스 버퍼 메모리 및 vertex fetch 시 읽어들이는 인덱스 대역폭을 절반으로 줄임.
+    */
+    lods = {{0, indices.size(), 0.0f}};
+    if (vertices.size() <= MAX_SHORT_INDEXED_VERTICES)
+    {
+      std::vector<std::uint16_t> shortIndices(indices.begin(), indices.end());
+      ibo->setData(shortIndices.data(), shortIndices.size() * sizeof(std::uint16_t), GL_STATIC_DRAW);
+      geometry.indexType = GL_UNSIGNED_SHORT;
+    }
+    else
+    {
+      ibo->setData(indices.data(), indices.size() * sizeof(unsigned int), GL_STATIC_DRAW);
+      geometry.indexType = GL_UNSIGNED_INT;
+    }
+
+    // Mesh 전용 버퍼 전체를 사용하므로 offset 은 0
+    geometry.vao = vao.get();
+    geometry.vertexCount = vertices.size();
+    geometry.indexCount = indices.size();
 
     // VBO 및 IBO 객체를 VAO 객체에 연결
-    vao.linkVBO(vbo, attributes);
-    vao.linkIBO(ibo);
+    vao->linkVBO(*vbo, getVertexAttributes());
+    vao->linkIBO(*ibo);
 
     // VAO, VBO, IBO 객체 바인딩 해제
-    vao.unbind();
-    vbo.unbind();
-    ibo.unbind();
+    vao->unbind();
+    vbo->unbind();
+    ibo->unbind();
   }
 };
 
@@ -0,0 +1,70 @@
+#ifndef MESH_SIMPLIFIER_HPP
+#define MESH_SIMPLIFIER_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <vector>
+#include <glm/glm.hpp>
+
+/**
+ * MeshSimplifier 클래스
+ *
+ * Quadric Error Metric(Garland & Heckbert) 기반의 edge collapse 로
+ * 삼각형 mesh 의 인덱스 버퍼를 단순화하는 클래스
+ *
+ * 새로운 정점을 만들지 않고 edge 의 한쪽 정점을 다른 쪽 정점으로 합치기만 하므로,
+ * 단순화된 인덱스 버퍼는 원본 정점 버퍼를 그대로 공유할 수 있음. (-> 모든 LOD 가 하나의 VBO 를 공유)
+ *
+ * 텍스쳐 좌표 및 노멀이 끊기는 seam 정점과, 열린 경계(border) 위의 정점은
+ * 실루엣과 uv 가 깨지지 않도록 제거하지 않음.
+ */
+class MeshSimplifier
+{
+public:
+  MeshSimplifier(const std::vector<glm::vec3> &positions, const std::vector<unsigned int> &indices);
+
+  /**
+   * 삼각형 인덱스 개수가 targetIndexCount 이하가 될 때까지 단순화한 인덱스 버퍼를 반환
+   *
+   * 비용이 가장 작은 edge 부터 합치며, 더 이상 합칠 수 있는 edge 가 없으면
+   * targetIndexCount 에 도달하지 못한 채로 반환될 수 있음.
+   *
+   * @param resultError 합쳐진 edge 들 중 가장 큰 기하 오차(object space 거리 단위)를 저장할 출력 변수
+   */
+  std::vector<unsigned int> simplify(size_t targetIndexCount, float *resultError = nullptr) const;
+
+private:
+  // 대칭 4x4 행렬의 상삼각 성분 10개만 저장하는 quadric
+  struct Quadric
+  {
+    double a00 = 0.0, a01 = 0.0, a02 = 0.0, a03 = 0.0;
+    double a11 = 0.0, a12 = 0.0, a13 = 0.0;
+    double a22 = 0.0, a23 = 0.0;
+    double a33 = 0.0;
+
+    void addPlane(const glm::dvec4 &plane);
+    void add(const Quadric &other);
+    double evaluate(const glm::vec3 &position) const;
+  };
+
+  const std::vector<glm::vec3> &positions;
+  const std::vector<unsigned int> &indices;
+
+  // 다른 정점으로 합쳐지면 안되는 정점 여부 (seam 또는 border 정점)
+  std::vector<bool> locked;
+
+  // 동일한 position 을 공유하는 정점들 중 대표 정점 인덱스 (quadric 은 대표 정점 기준으로 누적함)
+  std::vector<unsigned int> positionRoots;
+
+  // 원본 mesh 로 계산한 대표 정점별 quadric
+  std::vector<Quadric> quadrics;
+
+  void buildPositionRoots();
+  void buildLockedVertices();
+  void buildQuadrics();
+};
+
+#endif /* MESH_SIMPLIFIER_HPP */
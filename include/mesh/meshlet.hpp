@@ -0,0 +1,103 @@
+#ifndef MESHLET_HPP
+#define MESHLET_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <vector>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include "mesh/bounding_volume.hpp"
+#include "camera/frustum.hpp"
+
+/**
+ * Meshlet 구조체
+ *
+ * mesh 의 삼각형들을 공간적으로 인접한 작은 묶음(수십 ~ 백여 개의 삼각형)으로 나눈 cluster.
+ * mesh 의 인덱스 배열은 meshlet 단위로 재정렬되어 있으므로, 각 meshlet 은 인덱스 배열 상의 연속된 구간을 차지함.
+ *
+ * meshlet 마다 bounding sphere 와 normal cone 을 저장하여,
+ * 절두체 바깥에 있거나 모든 삼각형이 카메라 반대쪽을 향하는 meshlet 을 그리기 전에 걸러낼 수 있음.
+ */
+struct Meshlet
+{
+  size_t indexOffset; // mesh 의 인덱스 배열에서 meshlet 이 시작하는 위치 (인덱스 개수 단위)
+  size_t indexCount;
+
+  BoundingSphere sphere;
+
+  /*
+    normal cone
+
+    -> coneAxis 는 meshlet 삼각형들의 평균 normal 방향이고,
+    coneCutoff 는 sqrt(1 - minDot^2) (minDot 은 coneAxis 와 각 삼각형 normal 사이 내적의 최솟값)
+    -> 모든 삼각형의 normal 이 너무 넓게 퍼져있으면 coneCutoff 를 1 로 두어 항상 보이는 것으로 판정되도록 함.
+  */
+  glm::vec3 coneAxis = glm::vec3(0.0f, 0.0f, 1.0f);
+  float coneCutoff = 1.0f;
+};
+
+/**
+ * MeshletBatch 구조체
+ *
+ * 한 mesh 의 모든 meshlet 의 bounding sphere 및 normal cone 을 SIMD 로 한꺼번에 검사할 수 있도록
+ * 성분별 배열(SoA)로 저장하는 구조체
+ */
+struct MeshletBatch
+{
+  BoundingSphereBatch spheres;
+  std::vector<float> coneAxisX;
+  std::vector<float> coneAxisY;
+  std::vector<float> coneAxisZ;
+  std::vector<float> coneCutoff;
+
+  void set(const std::vector<Meshlet> &meshlets)
+  {
+    spheres.resize(meshlets.size());
+    coneAxisX.resize(meshlets.size());
+    coneAxisY.resize(meshlets.size());
+    coneAxisZ.resize(meshlets.size());
+    coneCutoff.resize(meshlets.size());
+
+    for (size_t i = 0; i < meshlets.size(); i++)
+    {
+      spheres.set(i, meshlets[i].sphere);
+      coneAxisX[i] = meshlets[i].coneAxis.x;
+      coneAxisY[i] = meshlets[i].coneAxis.y;
+      coneAxisZ[i] = meshlets[i].coneAxis.z;
+      coneCutoff[i] = meshlets[i].coneCutoff;
+    }
+  }
+
+  size_t size() const
+  {
+    return spheres.size();
+  }
+};
+
+/**
+ * MeshletBuilder 네임스페이스
+ *
+ * 모델 로드 시 mesh 를 meshlet 들로 나누고, 매 프레임 meshlet 들의 가시성을 검사하는 함수들
+ */
+namespace MeshletBuilder
+{
+  /**
+   * indices 의 삼각형들을 meshlet 단위로 묶어서 재정렬하고 meshlet 목록을 반환
+   *
+   * 아직 meshlet 에 포함되지 않은 삼각형 하나에서 시작하여, meshlet 에 새로 추가되는 정점이 가장 적은 인접 삼각형을
+   * 정점 개수(maxVertices) 또는 삼각형 개수(maxTriangles) 한도에 도달할 때까지 하나씩 추가함.
+   */
+  std::vector<Meshlet> build(const std::vector<glm::vec3> &positions, std::vector<unsigned int> &indices, size_t maxVertices, size_t maxTriangles);
+
+  /**
+   * meshlets 의 [begin, end) 구간에 대해 frustum culling 및 normal cone 기반 backface culling 을 수행하여 visible[begin, end) 에 기록
+   *
+   * frustum 과 cameraPosition 은 meshlet 과 같은 좌표계(mesh 의 object space) 기준이어야 함.
+   */
+  void cull(const MeshletBatch &meshlets, const Frustum &frustum, const glm::vec3 &cameraPosition, size_t begin, size_t end, std::uint8_t *visible);
+} // namespace MeshletBuilder
+
+#endif /* MESHLET_HPP */
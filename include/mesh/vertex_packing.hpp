@@ -0,0 +1,52 @@
+#ifndef VERTEX_PACKING_HPP
+#define VERTEX_PACKING_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <vector>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include "mesh/mesh.hpp"
+
+/**
+ * VertexPacking 네임스페이스
+ *
+ * 모델 로드 시 파싱한 VertexData 를 Mesh<VertexDataType> 에 전달할
+ * 압축된 정점 구조체(PackedVertexData, QuantizedVertexData)로 변환하는 함수들
+ *
+ * pack() 함수는 출력 배열의 정점 타입에 따라 오버로딩되어 있으므로,
+ * Mesh 의 템플릿 파라미터만 바꾸면 호출부 수정 없이 정점 포맷을 교체할 수 있음.
+ */
+namespace VertexPacking
+{
+  // 단위 벡터를 10:10:10:2 snorm 포맷으로 압축 (w 성분은 0)
+  std::uint32_t packNormal(const glm::vec3 &normal);
+
+  // tangent 를 normal 에 직교화한 뒤 10:10:10:2 snorm 포맷으로 압축 (w 성분에 bitangent 방향 부호 저장)
+  std::uint32_t packTangent(const glm::vec3 &normal, const glm::vec3 &tangent, const glm::vec3 &bitangent);
+
+  // uv 좌표를 half float 2개로 압축
+  void packTexCoords(const glm::vec2 &texCoords, std::uint16_t (&packed)[2]);
+
+  // 압축하지 않고 그대로 복사 (항등 dequantization 반환)
+  PositionDequantization pack(const std::vector<VertexData> &vertices, std::vector<VertexData> &packedVertices);
+
+  // normal, tangent, uv 만 압축 (항등 dequantization 반환)
+  PositionDequantization pack(const std::vector<VertexData> &vertices, std::vector<PackedVertexData> &packedVertices);
+
+  // position 까지 mesh AABB 기준으로 양자화하고, 이를 복원할 dequantization 변환을 반환
+  PositionDequantization pack(const std::vector<VertexData> &vertices, std::vector<QuantizedVertexData> &packedVertices);
+
+  /**
+   * VertexData 의 bone ID 및 weight 를 SkinVertexData 로 압축
+   *
+   * weight 는 합이 1 이 되도록 정규화한 뒤 unorm8 로 양자화하고, 반올림 오차는 가장 큰 weight 에 더해서 합이 정확히 255 가 되도록 함.
+   * (bone 이 하나도 연결되지 않은 정점은 모든 weight 가 0 으로 남으며, 쉐이더에서 skinning 을 적용하지 않음)
+   */
+  void packSkinning(const std::vector<VertexData> &vertices, std::vector<SkinVertexData> &skinVertices);
+}
+
+#endif /* VERTEX_PACKING_HPP */
@@ -15,30 +15,317 @@
 #include <assimp/postprocess.h>
 
 #include "mesh/mesh.hpp"
+#include "mesh/geometry_arena.hpp"
 #include "shader/shader.hpp"
+#include "camera/frustum.hpp"
+#include "scene/scene_graph.hpp"
+#include "common/thread_pool.hpp"
+#include "mesh/meshlet.hpp"
+#include "mesh/bounding_volume.hpp"
+#include "animation/skeleton.hpp"
+#include "animation/animation_clip.hpp"
+#include "animation/animator.hpp"
+#include "gl_objects/uniform_buffer_object.hpp"
+#include "constants/model_constants.hpp"
+
+/**
+ * Model 클래스가 GPU 에 업로드할 정점 구조체 타입
+ *
+ * 정적 mesh 의 정점 대역폭을 줄이기 위해 position 까지 양자화된 정점 포맷을 사용함.
+ * (VertexData, PackedVertexData 로 교체하면 압축 단계만 바뀌고 나머지 코드는 그대로 동작함)
+ */
+using ModelVertexData = QuantizedVertexData;
+
+// 모델 로드 시 적용할 옵션들
+struct ModelLoadOptions
+{
+  // 16-bit 인덱스 범위를 넘어서는 정점을 가진 aiMesh 를 16-bit 인덱스로 그릴 수 있는 크기의 Mesh 들로 분할할지 여부
+  bool splitLargeMeshes = true;
+
+  // 각 Mesh 마다 Quadric Error Metric 기반으로 단순화된 LOD 들을 생성할지 여부
+  bool generateLods = true;
+
+  /*
+    GPU 에 업로드한 뒤에도 Mesh 의 CPU 측 정점 및 인덱스 배열을 보관할지 여부
+
+    -> CPU 에서 geometry 를 다시 읽어야 하는 경우에만 켜고, 그렇지 않으면 업로드 직후 해제하여 모델 로드 이후의 메모리 사용량을 줄임.
+    (BVH 는 변환 작업 중에 생성되고 삼각형을 자체적으로 보관하므로 이 옵션과 무관함)
+  */
+  bool keepCpuGeometry = false;
+
+  // 각 Mesh 의 LOD 0 을 meshlet 단위로 나누고 인덱스를 meshlet 순서로 재정렬하여 cullMeshlets() 를 사용할 수 있게 할지 여부
+  bool generateMeshlets = true;
+
+  // 각 Mesh 의 LOD 0 으로 SAH BVH 를 생성하여 pick() 등 광선 검사를 할 수 있게 할지 여부 (skinning 되는 Mesh 는 형태가 바뀌므로 생성하지 않음)
+  bool buildBvh = true;
+};
+
+// Model::pick() 의 결과
+struct ModelPickResult
+{
+  int meshIndex = -1;                   // 광선과 교차한 Mesh 의 meshes 배열 인덱스 (교차하지 않으면 -1)
+  std::uint32_t triangle = 0;           // 교차한 삼각형의 LOD 0 기준 번호
+  float distance = 0.0f;                // 교차 지점 = origin + direction * distance
+  glm::vec3 position = glm::vec3(0.0f); // world space 기준 교차 지점
+};
+
+// Model::cullMeshlets() 의 결과 통계
+struct MeshletCullStats
+{
+  size_t meshletCount = 0;
+  size_t culledMeshletCount = 0;
+  size_t culledTriangleCount = 0;
+};
+
+/**
+ * 여러 Model 의 Mesh 들이 공유하는 ModelVertexData 포맷의 GeometryArena 들
+ *
+ * 16-bit 인덱스로 그릴 수 있는 Mesh 와 그렇지 않은 Mesh 는 인덱스 타입이 달라 하나의 draw call 로 그릴 수 없으므로
+ * 인덱스 타입별로 arena 를 따로 둠.
+ */
+struct ModelGeometryArenas
+{
+  GeometryArena<ModelVertexData, std::uint16_t> shortIndexed{ModelConstants::GEOMETRY_ARENA_INITIAL_VERTEX_COUNT, ModelConstants::GEOMETRY_ARENA_INITIAL_INDEX_COUNT};
+  GeometryArena<ModelVertexData, std::uint32_t> indexed{ModelConstants::GEOMETRY_ARENA_INITIAL_VERTEX_COUNT, ModelConstants::GEOMETRY_ARENA_INITIAL_INDEX_COUNT};
+};
 
 class Model
 {
 public:
-  // 생성자 함수 선언 및 구현
-  Model(const std::string &path);
+  /**
+   * 생성자 함수 선언 및 구현
+   *
+   * geometryArenas 를 전달하면 Mesh 들의 정점 및 인덱스를 arena 에 업로드하고 multi draw indirect 로 그리며,
+   * 전달하지 않으면 (ex> multi draw indirect 를 지원하지 않는 컨텍스트) 각 Mesh 가 자신의 버퍼를 소유하고 하나씩 그림.
+   *
+   * threadPool 을 전달하면 aiMesh 마다의 변환 작업(정점 파싱, 압축, meshlet 및 LOD 생성 등)을 병렬로 처리함.
+   */
+  Model(const std::string &path, const ModelLoadOptions &options = ModelLoadOptions(), std::shared_ptr<ModelGeometryArenas> geometryArenas = nullptr, ThreadPool *threadPool = nullptr);
+
+  // arena 에 할당받은 Mesh 들의 버퍼 영역 반납
+  ~Model();
+
+  /**
+   * scene graph 에서 local transform 이 바뀐 노드들의 world transform 을 갱신하고,
+   * 갱신된 노드에 속한 Mesh 들에 world transform 을 전달하는 멤버 함수 (cull(), selectLods(), draw() 이전에 호출해야 함)
+   *
+   * @return world transform 이 갱신된 노드 개수
+   */
+  size_t updateTransforms();
+
+  // 3D 모델 파일의 노드 계층 구조 (노드의 local transform 을 바꾸면 다음 updateTransforms() 에서 반영됨)
+  SceneGraph &getSceneGraph();
+
+  /**
+   * Model 클래스 내에 저장된 Mesh 클래스 인스턴스들 중 cull() 에서 보이는 것으로 판정된 Mesh 들을 그리는 멤버 함수
+   *
+   * @return 실제로 호출된 draw call 개수
+   */
+  unsigned int draw(Shader &shader);
+
+  /**
+   * 각 Mesh 의 bounding volume 을 절두체와 비교하여 다음 draw() 에서 그릴 Mesh 를 결정하는 멤버 함수
+   *
+   * 모든 Mesh 의 world space bounding sphere 를 SoA 배열에 모아 SIMD 로 한꺼번에 검사한 뒤,
+   * 통과한 Mesh 만 AABB 로 한번 더 검사함.
+   *
+   * @param transform 모델 행렬
+   * @param frustum world space 기준 카메라 절두체
+   */
+  void cull(const glm::mat4 &transform, const Frustum &frustum);
+
+  // 가장 최근의 cull() 결과에서 index 번째 Mesh 가 보이는지 여부
+  bool isMeshVisible(size_t index) const;
+
+  /**
+   * 각 Mesh 의 bounding sphere 가 화면에 투영된 크기에 따라 다음 draw() 에서 그릴 LOD 를 선택하는 멤버 함수
+   *
+   * @param transform 모델 행렬
+   * @param cameraPosition world space 기준 카메라 위치
+   * @param projectionScale 카메라로부터 거리 1 만큼 떨어진 물체의 크기를 pixel 단위 크기로 변환하는 값 (= projection[1][1] * viewport 높이 / 2)
+   */
+  void selectLods(const glm::mat4 &transform, const glm::vec3 &cameraPosition, float projectionScale);
+
+  /**
+   * cull() 을 통과하고 LOD 0 으로 그려질 Mesh 들의 meshlet 들을 frustum 및 normal cone 으로 검사하여
+   * 다음 draw() 에서 보이는 meshlet 들의 인덱스 구간만 그리도록 하는 멤버 함수 (cull(), selectLods() 이후에 호출해야 함)
+   *
+   * Mesh 들의 meshlet 을 MeshletConstants::CULL_BATCH_SIZE 개씩 나눠서 threadPool 로 병렬 검사하고,
+   * 검사가 끝나면 Mesh 마다 보이는 meshlet 구간들을 이어붙여서 그리기 구간 목록을 만듦.
+   *
+   * @param viewProjection 카메라의 projection * view 행렬
+   * @param transform 모델 행렬
+   * @param cameraPosition world space 기준 카메라 위치
+   */
+  MeshletCullStats cullMeshlets(const glm::mat4 &viewProjection, const glm::mat4 &transform, const glm::vec3 &cameraPosition, ThreadPool &threadPool);
+
+  /**
+   * 재생중인 애니메이션을 deltaTime(초)만큼 진행하여 bone palette 를 다시 계산하고 UBO 에 업로드하는 멤버 함수
+   *
+   * @return 이번 갱신에서 처리한 joint 개수 (skinning 되는 Mesh 가 없으면 0)
+   */
+  size_t updateAnimation(float deltaTime);
 
-  // Model 클래스 내에 저장된 모든 Mesh 클래스 인스턴스의 Draw() 명령 호출 멤버 함수
-  void draw(Shader &shader);
+  // skinning 되는 Mesh 가 있어서 bone palette 를 계산하는 Animator 가 생성되었는지 여부
+  bool isAnimated() const;
+
+  // 애니메이션 재생을 제어할 Animator (isAnimated() 가 false 이면 nullptr)
+  Animator *getAnimator();
+
+  // skinning 되는 Mesh 들의 정점 개수 합
+  size_t getSkinnedVertexCount() const;
+
+  /**
+   * world space 광선과 교차하는 가장 가까운 삼각형을 각 Mesh 의 BVH 로 찾는 멤버 함수 (BVH 가 없는 Mesh 는 무시)
+   *
+   * 광선을 Mesh 마다 object space 로 변환하여 검사하며, direction 을 정규화하지 않고 변환하므로
+   * 모든 Mesh 에서 교차 거리가 world space 광선 기준으로 비교됨.
+   *
+   * @param transform 모델 행렬
+   * @return 교차하는 삼각형이 있으면 result 에 기록하고 true 반환
+   */
+  bool pick(const BvhRay &ray, const glm::mat4 &transform, ModelPickResult &result) const;
+
+  // BVH 가 생성된 Mesh 들의 노드 개수 합, 메모리 크기 (bytes) 및 생성에 걸린 CPU 시간 합 (ms, 여러 worker 에서 생성한 시간을 모두 더한 값)
+  size_t getBvhNodeCount() const;
+  size_t getBvhMemorySize() const;
+  float getBvhBuildTimeMs() const;
 
   // model data 관련 public 멤버 선언
-  std::vector<TextureData> textures_loaded;              // 텍스쳐 객체 중복 생성 방지를 위해 이미 로드된 텍스쳐 구조체를 동적 배열에 저장해두는 멤버
-  std::vector<std::shared_ptr<Mesh<VertexData>>> meshes; // Model 클래스에 사용되는 Mesh 클래스 인스턴스들을 동적 배열에 저장하는 멤버
+  std::vector<std::shared_ptr<Mesh<ModelVertexData>>> meshes; // Model 클래스에 사용되는 Mesh 클래스 인스턴스들을 동적 배열에 저장하는 멤버
   std::string directory;                                 // 3D 모델 파일이 위치하는 디렉토리 경로를 저장하는 멤버
 
 private:
+  ModelLoadOptions options;
+
+  // Mesh 들의 정점 및 인덱스를 저장하는 공유 버퍼 (nullptr 이면 각 Mesh 가 자신의 버퍼를 소유)
+  std::shared_ptr<ModelGeometryArenas> geometryArenas;
+
+  // multi draw indirect 로 그릴 command 및 per-draw 데이터 (매 프레임 재할당하지 않도록 멤버로 유지)
+  std::vector<DrawElementsIndirectCommand> drawCommands;
+  std::vector<MeshDrawData> drawData;
+
+  // 같은 arena 와 같은 텍스쳐들을 사용하여 하나의 multi draw indirect 로 묶을 수 있는 Mesh 인지 검사
+  static bool canBatch(const Mesh<ModelVertexData> &a, const Mesh<ModelVertexData> &b);
+
+  // 지금까지 기록된 command 들을 batchMesh 의 텍스쳐로 한번에 그리고 command 배열 초기화
+  void flushDrawCommands(Shader &shader, const Mesh<ModelVertexData> &batchMesh);
+
+  // 보이는 skinning Mesh 들을 bone palette UBO 를 연결하여 하나씩 그리고 draw call 개수 반환
+  unsigned int drawSkinnedMeshes(Shader &shader);
+
+  // frustum culling 에 사용할 world space bounding sphere 배열 및 Mesh 별 가시성 (매 프레임 재할당하지 않도록 멤버로 유지)
+  BoundingSphereBatch worldSpheres;
+  std::vector<std::uint8_t> meshVisibility;
+
+  /*
+    aiNode 계층 구조 및 노드별 Mesh 범위
+
+    -> 노드를 전위 순회 순서로 처리하면서 노드의 aiMesh 들을 순서대로 import 작업으로 기록하고 같은 순서로 meshes 에 추가하므로,
+    node 번째 노드에 속한 Mesh 들은 meshes 배열의 [nodeMeshOffsets[node], nodeMeshOffsets[node + 1]) 구간에 위치함.
+  */
+  SceneGraph sceneGraph;
+  std::vector<size_t> nodeMeshOffsets;
+
+  /*
+    skeletal animation 관련 데이터
+
+    -> skeleton 의 joint 는 scene graph 노드와 1:1 로 대응하고, animations 는 aiScene 의 aiAnimation 들을 변환한 clip 들.
+    -> skinning 되는 aiMesh 가 하나라도 있으면 animator 를 생성하여 매 프레임 bone palette 를 계산하고 bonePaletteUbo 에 업로드함.
+  */
+  Skeleton skeleton;
+  std::vector<AnimationClip> animations;
+  std::unique_ptr<Animator> animator;
+  std::unique_ptr<UniformBufferObject> bonePaletteUbo;
+  size_t skinnedVertexCount = 0;
+
+  // Mesh 들의 BVH 통계
+  size_t bvhNodeCount = 0;
+  size_t bvhMemorySize = 0;
+  float bvhBuildTimeMs = 0.0f;
+
+  /*
+    cullMeshlets() 에서 스레드 풀에 나눠줄 작업 단위 (Mesh 하나의 meshlet [begin, end) 구간)
+
+    -> frustum 과 카메라 위치는 Mesh 의 object space 로 변환해두어 meshlet 의 bounding volume 을 변환하지 않고 검사함.
+  */
+  struct MeshletCullJob
+  {
+    Mesh<ModelVertexData> *mesh;
+    Frustum frustum;
+    glm::vec3 cameraPosition;
+    size_t begin;
+    size_t end;
+  };
+  std::vector<MeshletCullJob> meshletCullJobs;
+
+  /**
+   * GPU 에 업로드하기 전까지의 변환을 마친 Mesh 데이터
+   *
+   * 정점 압축, meshlet 및 LOD 생성, bounding volume 계산까지는 GL 호출이 없으므로 worker 스레드에서 수행하고,
+   * 렌더링 스레드는 이 데이터로 버퍼 생성 및 업로드만 수행함.
+   */
+  struct PreparedMesh
+  {
+    std::string name;
+    std::vector<ModelVertexData> vertices;
+    std::vector<unsigned int> indices; // 모든 LOD 의 인덱스를 이어붙인 배열
+    std::vector<MeshLod> lods;
+    std::vector<Meshlet> meshlets;
+    PositionDequantization dequantization;
+    BoundingSphere sphere;
+    BoundingBox box;
+    std::vector<SkinVertexData> skin; // skinning 되지 않는 Mesh 는 비어있음
+    std::shared_ptr<const Bvh> bvh;   // ModelLoadOptions::buildBvh 가 꺼져있거나 skinning 되는 Mesh 는 nullptr
+    float bvhBuildTimeMs = 0.0f;
+  };
+
+  // aiMesh 하나를 변환하는 import 작업 (16-bit 인덱스 범위를 넘어서 분할되면 여러 PreparedMesh 가 생성됨)
+  struct MeshImportJob
+  {
+    const aiMesh *mesh;
+    std::vector<TextureData> textures;
+    std::vector<PreparedMesh> prepared;
+  };
+
+  // 모델 import 에 사용할 스레드 풀 (nullptr 이면 렌더링 스레드에서 순차적으로 처리)
+  ThreadPool *threadPool;
+
   void loadModel(const std::string &path);
 
-  // Assimp Scene 구조에 따라 RootNode 부터 시작해서 재귀적으로 하위 aiNode 들을 처리하는 멤버 함수
-  void processNode(aiNode *node, const aiScene *scene);
+  /**
+   * Assimp Scene 구조에 따라 RootNode 부터 시작해서 재귀적으로 하위 aiNode 들을 scene graph 노드로 추가하며,
+   * 노드의 aiMesh 들을 순서대로 import 작업으로 기록하는 멤버 함수
+   *
+   * -> 텍스쳐 로드는 GL 호출이 필요하므로 노드 순회 중에 함께 수행함.
+   */
+  void processNode(aiNode *node, const aiScene *scene, int parentNode, std::vector<MeshImportJob> &jobs);
+
+  /**
+   * scene graph 로부터 skeleton 을 생성하고, aiMesh 들이 참조하는 bone 들과 aiAnimation 들을 불러오는 멤버 함수
+   *
+   * -> processNode() 이후, aiMesh 변환 작업을 시작하기 전에 호출해야 함. (변환 작업에서 bone 이름으로 bone 인덱스를 조회하므로)
+   */
+  void loadSkeleton(const aiScene *scene);
+
+  // aiMesh 의 aiBone 들에 저장된 정점별 weight 를 각 정점의 weight 가 큰 순서로 최대 MAX_BONE_INFLUENCE 개까지 기록하는 멤버 함수
+  void assignBoneWeights(const aiMesh *mesh, std::vector<VertexData> &vertices) const;
+
+  // aiMesh 의 aiMaterial 에 저장된 텍스쳐들을 로드하는 멤버 함수
+  std::vector<TextureData> loadMeshTextures(const aiMesh *mesh, const aiScene *scene);
+
+  // aiMesh 를 파싱하여 PreparedMesh 들로 변환하는 멤버 함수 (GL 호출이 없으므로 여러 worker 스레드에서 동시에 호출 가능)
+  void prepareMesh(const aiMesh *mesh, std::vector<PreparedMesh> &prepared) const;
+
+  // 파싱된 정점 데이터를 ModelVertexData 로 압축하고 meshlet, LOD, BVH 및 bounding volume 을 생성하여 prepared 에 추가하는 멤버 함수
+  // (skinned 이면 bone ID 및 weight 도 함께 압축하며, 애니메이션에 따라 변형되는 mesh 이므로 meshlet 은 생성하지 않음)
+  void prepareGeometry(const std::string &name, const std::vector<VertexData> &vertices, const std::vector<unsigned int> &indices, bool skinned, std::vector<PreparedMesh> &prepared) const;
+
+  // 정점 개수가 16-bit 인덱스 범위를 넘어서는 mesh 를 여러 chunk 로 분할하여 prepared 에 추가하는 멤버 함수
+  void prepareSplitMeshes(const std::string &name, const std::vector<VertexData> &vertices, const std::vector<unsigned int> &indices, bool skinned, std::vector<PreparedMesh> &prepared) const;
 
-  // aiMesh 를 파싱하여 실제 Mesh 클래스 인스턴스로 반환해주는 멤버 함수
-  void processMesh(aiMesh *mesh, const aiScene *scene);
+  // 변환을 마친 Mesh 데이터를 GPU 에 업로드하여 Mesh 클래스 인스턴스를 생성하는 멤버 함수 (렌더링 스레드에서만 호출)
+  void addMesh(PreparedMesh &prepared, const std::vector<TextureData> &textures);
 
   // aiMaterial 에 저장된 특정 타입의 텍스쳐들을 Texture 구조체 배열로 파싱하여 반환하는 멤버 함수
   std::vector<TextureData> loadMaterialTextures(aiMaterial *mat, aiTextureType type, std::string typeName);
@@ -13,6 +13,19 @@
 
 class Primitive : public IRenderableObject
 {
+public:
+  // 인스턴스별 데이터가 저장된 VBO 를 primitive mesh 의 VAO 에 연결 (Mesh::linkInstanceBuffer() 참고)
+  void linkInstanceBuffer(const VertexBufferObject &instanceVbo)
+  {
+    mesh->linkInstanceBuffer(instanceVbo);
+  }
+
+  // hardware instancing 으로 instanceCount 개의 primitive 를 한번에 그림
+  void drawInstanced(Shader &shader, GLsizei instanceCount)
+  {
+    mesh->drawInstanced(shader, instanceCount);
+  }
+
 protected:
   // Mesh 클래스 멤버변수를 스마트 포인터로 관리하는 이유 sphere.cpp 필기 참고
   std::unique_ptr<Mesh<SimpleVertexData>> mesh;
@@ -0,0 +1,114 @@
+#ifndef RENDER_QUEUE_HPP
+#define RENDER_QUEUE_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <glm/glm.hpp>
+#include "model/model.hpp"
+#include "shader/shader.hpp"
+
+// RenderQueue 로 그리는 오브젝트의 material uniform 값
+struct RenderMaterial
+{
+  glm::vec3 albedo;
+  float metallic;
+  float roughness;
+  float ao;
+};
+
+// RenderQueue 에 제출되는 Mesh 하나의 그리기 명령
+struct RenderCommand
+{
+  Shader *shader;
+  const Mesh<ModelVertexData> *mesh;
+  size_t lod;             // 그릴 LOD 인덱스
+  std::uint32_t material; // flush() 에 전달하는 material 배열의 인덱스
+  glm::mat4 transform;    // 오브젝트의 모델 행렬과 Mesh 의 노드 world transform 을 곱한 최종 world transform
+  glm::mat3 normalMatrix; // transform 의 노멀 행렬 (transpose(inverse(mat3(transform))))
+};
+
+// RenderQueue::flush() 로 그리면서 발생한 상태 변경 및 draw call 개수
+struct RenderQueueStats
+{
+  unsigned int commandCount = 0;
+  unsigned int programBindCount = 0;
+  unsigned int materialBindCount = 0;
+  unsigned int textureBindCount = 0;
+  unsigned int drawCallCount = 0;
+};
+
+/**
+ * RenderQueue 클래스
+ *
+ * 한 프레임 동안 제출된 그리기 명령들을 64-bit 정렬 키 순서로 정렬한 뒤,
+ * 정렬된 순서대로 그리면서 이전 명령과 달라진 상태(쉐이더 프로그램, material uniform, 텍스쳐)만 변경하는 클래스.
+ *
+ * 정렬 키는 상위 비트부터 아래 순서로 구성되어, 바꾸는 비용이 큰 상태일수록 같은 값끼리 연속으로 모임.
+ *
+ *  | shader (4) | material (8) | texture set (16) | mesh (20) | depth (16) |
+ *
+ * -> 같은 상태 안에서는 카메라에 가까운 명령부터 그려서 (front-to-back) early depth test 로 가려지는 fragment 를 줄임.
+ * -> 명령 자체가 아니라 (키, 명령 인덱스) 쌍 배열만 정렬하여 정렬 중 이동하는 데이터 크기를 줄임.
+ * -> 명령 배열들은 clear() 에서 capacity 를 유지하므로 매 프레임 재할당이 일어나지 않음.
+ */
+class RenderQueue
+{
+public:
+  static constexpr int SHADER_BITS = 4;
+  static constexpr int MATERIAL_BITS = 8;
+  static constexpr int TEXTURE_SET_BITS = 16;
+  static constexpr int MESH_BITS = 20;
+  static constexpr int DEPTH_BITS = 16;
+
+  /**
+   * 각 필드를 비트 수에 맞게 잘라서 정렬 키 생성
+   *
+   * @param depth [0, 1] 범위로 정규화된 카메라로부터의 거리 (범위를 벗어나면 clamp)
+   */
+  static std::uint64_t makeKey(std::uint32_t shader, std::uint32_t material, std::uint32_t textureSet, std::uint32_t mesh, float depth);
+
+  /**
+   * Mesh 가 사용하는 텍스쳐들의 id 를 TEXTURE_SET_BITS 로 접어서 만든 텍스쳐 세트 키
+   *
+   * -> 서로 다른 텍스쳐 세트가 같은 키를 가질 수 있으므로, 키는 같은 세트끼리 모으는 데만 사용하고
+   * 실제 텍스쳐 변경 여부는 flush() 에서 텍스쳐 목록을 직접 비교하여 판단함.
+   */
+  static std::uint32_t getTextureSetKey(const Mesh<ModelVertexData> &mesh);
+
+  void clear();
+  void submit(std::uint64_t key, const RenderCommand &command);
+
+  // 제출된 명령들을 정렬 키 오름차순으로 정렬
+  void sort();
+
+  /**
+   * 정렬된 순서대로 명령들을 그림
+   *
+   * geometryArenas 가 있고 multi draw indirect 를 지원하면, 같은 쉐이더, material, 텍스쳐 및 인덱스 타입을 사용하는
+   * 연속된 명령들을 하나의 glMultiDrawElementsIndirect() 로 묶어서 그림.
+   *
+   * @param materials submit() 된 명령들의 material 인덱스가 가리키는 material 배열
+   */
+  RenderQueueStats flush(const std::vector<RenderMaterial> &materials, ModelGeometryArenas *geometryArenas);
+
+  size_t size() const;
+
+private:
+  std::vector<RenderCommand> commands;
+  std::vector<std::pair<std::uint64_t, std::uint32_t>> sortedKeys;
+
+  // multi draw indirect 로 묶어서 그릴 command 및 per-draw 데이터 (매 프레임 재할당하지 않도록 멤버로 유지)
+  std::vector<DrawElementsIndirectCommand> drawCommands;
+  std::vector<MeshDrawData> drawData;
+
+  // 지금까지 묶인 command 들을 인덱스 타입에 맞는 arena 로 한번에 그리고 배열 초기화
+  void flushBatch(ModelGeometryArenas &geometryArenas, GLenum indexType);
+};
+
+#endif /* RENDER_QUEUE_HPP */
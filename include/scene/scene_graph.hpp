@@ -0,0 +1,81 @@
+#ifndef SCENE_GRAPH_HPP
+#define SCENE_GRAPH_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <glm/glm.hpp>
+
+/**
+ * SceneGraph 클래스
+ *
+ * 3D 모델 파일의 노드 계층 구조(aiNode 트리)와 각 노드의 local transform 을 보존하여
+ * 노드별 world transform 을 계산하는 클래스
+ *
+ * 노드들은 트리 구조 대신 깊이 우선 전위 순회(pre-order) 순서의 평탄화된 배열로 저장됨.
+ * -> 부모 노드가 항상 자식 노드보다 앞에 오므로 배열을 앞에서부터 순회하기만 해도 부모의 world transform 이 먼저 계산되고,
+ * -> 한 노드의 하위 노드들은 배열 상에서 [node, subtreeEnd) 의 연속된 구간을 차지하므로 서브트리 순회가 단순한 구간 순회가 됨.
+ *
+ * local transform 이 바뀐 노드는 dirty 목록에 기록해두었다가,
+ * updateWorldTransforms() 에서 해당 노드들의 서브트리 구간만 다시 계산하므로
+ * 갱신 비용은 전체 노드 개수가 아니라 실제로 바뀐 노드 개수에 비례함.
+ */
+class SceneGraph
+{
+public:
+  // 루트 노드의 부모 인덱스
+  static constexpr int NO_PARENT = -1;
+
+  /**
+   * 노드를 추가하고 노드 인덱스를 반환
+   *
+   * 노드는 전위 순회 순서로 추가되어야 하므로, 부모 노드는 가장 최근에 추가된 노드 또는 그 조상 노드여야 함.
+   *
+   * @param parent 부모 노드 인덱스 (루트 노드는 NO_PARENT)
+   */
+  int addNode(const std::string &name, int parent, const glm::mat4 &localTransform);
+
+  // 노드의 local transform 을 변경하고, 다음 updateWorldTransforms() 에서 서브트리 전체가 갱신되도록 dirty 표시
+  void setLocalTransform(int node, const glm::mat4 &localTransform);
+
+  /**
+   * dirty 로 표시된 노드들의 서브트리에 속한 노드들의 world transform 을 갱신
+   *
+   * @return 갱신된 노드 개수
+   */
+  size_t updateWorldTransforms();
+
+  // 가장 최근의 updateWorldTransforms() 에서 world transform 이 갱신된 노드 목록 (노드 인덱스 오름차순)
+  const std::vector<int> &getUpdatedNodes() const;
+
+  const glm::mat4 &getLocalTransform(int node) const;
+  const glm::mat4 &getWorldTransform(int node) const;
+  int getParent(int node) const;
+  const std::string &getName(int node) const;
+
+  // 이름으로 노드 인덱스 검색 (찾지 못하면 -1 반환)
+  int findNode(const std::string &name) const;
+
+  size_t getNodeCount() const;
+
+private:
+  // 노드별 속성은 성분별 배열(SoA)로 저장하여 transform 갱신 시 필요한 데이터만 연속적으로 읽도록 함
+  std::vector<std::string> names;
+  std::vector<int> parents;
+  std::vector<int> subtreeEnds; // 노드의 마지막 하위 노드 다음 인덱스
+  std::vector<glm::mat4> localTransforms;
+  std::vector<glm::mat4> worldTransforms;
+
+  // dirty 목록에 중복으로 추가되지 않도록 노드별 dirty 여부를 함께 기록
+  std::vector<std::uint8_t> dirtyFlags;
+  std::vector<int> dirtyNodes;
+
+  std::vector<int> updatedNodes;
+};
+
+#endif /* SCENE_GRAPH_HPP */
@@ -0,0 +1,57 @@
+#ifndef PBR_SHADER_VARIANTS_HPP
+#define PBR_SHADER_VARIANTS_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <shader/shader_variant_cache.hpp>
+
+/**
+ * PbrShaderVariants 클래스
+ *
+ * pbr.vs, pbr.fs 로부터 생성되는 쉐이더 변형들을 관리하는 클래스.
+ *
+ * 쉐이더에서 런타임에 분기하던 값들을 #define 으로 컴파일 타임에 결정하여,
+ * 사용하지 않는 IBL 텍스쳐 샘플링이나 꺼진 광원에 대한 반복문이 변형 코드에서 아예 제거되도록 함.
+ *
+ *  - IBL_ENABLED       : IBL 로 ambient 를 계산할지 여부 (IBLFeature 가 iblVisibility 파라미터로 설정)
+ *  - LIGHT_COUNT n     : 계산할 광원 개수 (LightFeature 가 intensity 가 0 이 아닌 광원 개수로 설정)
+ *  - INSTANCED_MATERIAL: material 을 per-instance attribute 로 읽을지 uniform 으로 읽을지 (그리는 Feature 가 선택)
+ *
+ * -> IBL 및 광원 설정은 프레임 전체에 공통이므로 여기에 보관하고, 그리는 Feature 들은 acquire() 로 현재 설정에 맞는 변형을 가져감.
+ * -> 기본 설정에 해당하는 변형들은 생성자에서 컴파일 및 링크를 제출해두므로, 이후의 초기화 작업과 겹쳐서 컴파일됨.
+ */
+class PbrShaderVariants
+{
+public:
+  PbrShaderVariants();
+
+  void setIBLEnabled(bool iblEnabled);
+  void setLightCount(unsigned int lightCount);
+
+  // 현재 IBL 및 광원 설정과 material 입력 방식에 해당하는 변형 반환 (처음 요청된 조합이면 컴파일)
+  ShaderVariant &acquire(bool instancedMaterial);
+
+  // 현재 IBL 및 광원 설정과 material 입력 방식에 해당하는 변형의 컴파일 및 링크를 제출만 해둠
+  void prepare(bool instancedMaterial);
+
+  ShaderVariantCache &getCache();
+
+private:
+  ShaderVariantCache cache;
+
+  bool iblEnabled;
+  unsigned int lightCount;
+
+  // | light count (8) | instanced material (1) | IBL (1) |
+  static std::uint32_t makeKey(bool iblEnabled, unsigned int lightCount, bool instancedMaterial);
+  static std::vector<std::string> makeDefines(bool iblEnabled, unsigned int lightCount, bool instancedMaterial);
+  static std::string makeLabel(bool iblEnabled, unsigned int lightCount, bool instancedMaterial);
+};
+
+#endif /* PBR_SHADER_VARIANTS_HPP */
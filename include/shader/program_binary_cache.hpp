@@ -0,0 +1,88 @@
+#ifndef PROGRAM_BINARY_CACHE_HPP
+#define PROGRAM_BINARY_CACHE_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <glad/glad.h>
+#include <string>
+#include <string_view>
+#include <cstdint>
+
+// 프로세스 시작 후 쉐이더 프로그램을 캐시에서 읽거나 소스로부터 컴파일한 횟수 및 소요 시간 (ms)
+struct ProgramBinaryCacheStats
+{
+  unsigned int loadedCount = 0;   // 캐시된 바이너리로 생성한 프로그램 개수
+  unsigned int compiledCount = 0; // 소스로부터 컴파일 및 링크한 프로그램 개수
+  unsigned int invalidCount = 0;  // 캐시 파일이 있었지만 손상되었거나 드라이버가 거부하여 다시 컴파일한 개수
+  float loadTimeMs = 0.0f;
+
+  /*
+    소스로부터 컴파일한 프로그램들이 main 스레드를 붙잡고 있던 시간
+
+    -> compileTimeMs 는 컴파일 및 링크 제출 시간과 링크 결과를 기다린 시간의 합이고, linkWaitTimeMs 는 그 중 기다린 시간.
+    -> overlapTimeMs 는 제출부터 링크 결과를 처음 조회하기까지 다른 초기화 작업이 진행된 시간으로,
+    그 동안 드라이버가 컴파일을 진행했다면 (= 순서대로 기다리던 이전 방식 대비) 절약된 시간의 상한이 됨.
+  */
+  float compileTimeMs = 0.0f;
+  float linkWaitTimeMs = 0.0f;
+  float overlapTimeMs = 0.0f;
+};
+
+/**
+ * ProgramBinaryCache 클래스
+ *
+ * 링크된 쉐이더 프로그램의 바이너리를 glGetProgramBinary() 로 꺼내서 디스크에 저장해두고,
+ * 다음 실행 시 같은 프로그램을 생성할 때 GLSL 컴파일 및 링크 대신 glProgramBinary() 로 바로 불러오는 프로세스 전체 공유 캐시.
+ *
+ * 캐시 key 는 vertex, fragment 쉐이더 소스와 드라이버의 vendor, renderer, version 문자열을 함께 hashing 하여 생성하므로,
+ * 쉐이더 소스를 수정하거나 드라이버가 바뀌면 다른 파일을 찾게 되어 이전 바이너리는 사용되지 않음.
+ *
+ * -> 같은 드라이버라도 바이너리를 거부할 수 있으므로 (glProgramBinary() 후 GL_LINK_STATUS 가 GL_FALSE),
+ * 이 경우 캐시 파일을 지우고 소스로부터 다시 컴파일하도록 load() 가 false 를 반환함.
+ * -> GL 4.1 또는 ARB_get_program_binary 를 지원하지 않거나 바이너리 포맷이 하나도 없으면 항상 소스로부터 컴파일함.
+ */
+class ProgramBinaryCache
+{
+public:
+  // 프로세스 전체에서 공유되는 캐시 인스턴스 반환
+  static ProgramBinaryCache &getInstance();
+
+  // 쉐이더 소스와 현재 컨텍스트의 드라이버 정보로 캐시 key 생성
+  std::uint64_t makeKey(std::string_view vertexSource, std::string_view fragmentSource);
+
+  /**
+   * key 에 해당하는 캐시 파일을 읽어서 program 에 바이너리를 로드
+   *
+   * @return 로드한 바이너리로 링크에 성공하면 true, 캐시 파일이 없거나 유효하지 않으면 false
+   */
+  bool load(std::uint64_t key, GLuint program);
+
+  // 링크되기 전의 program 에 바이너리를 꺼낼 수 있도록 GL_PROGRAM_BINARY_RETRIEVABLE_HINT 설정 (지원하지 않으면 무시)
+  void prepareForLink(GLuint program) const;
+
+  // 링크된 program 의 바이너리를 key 에 해당하는 캐시 파일에 저장 (지원하지 않으면 무시)
+  void store(std::uint64_t key, GLuint program);
+
+  // 소스로부터 컴파일 및 링크한 프로그램의 제출 시간, 링크 결과를 기다린 시간 및 그 사이에 다른 작업이 진행된 시간 기록
+  void recordCompile(float submitTimeMs, float linkWaitTimeMs, float overlapTimeMs);
+
+  const ProgramBinaryCacheStats &getStats() const;
+
+private:
+  ProgramBinaryCache() = default;
+  ProgramBinaryCache(const ProgramBinaryCache &) = delete;
+  ProgramBinaryCache &operator=(const ProgramBinaryCache &) = delete;
+
+  ProgramBinaryCacheStats stats;
+
+  // 드라이버 문자열을 hashing 한 값 (처음 makeKey() 호출 시 한번만 조회)
+  std::uint64_t driverHash = 0;
+  bool driverHashed = false;
+
+  std::string getCachePath(std::uint64_t key) const;
+};
+
+#endif /* PROGRAM_BINARY_CACHE_HPP */
@@ -8,11 +8,43 @@
 
 #include <glad/glad.h> // OpenGL 함수를 초기화하기 위한 헤더
 #include <string>      // std::string
+#include <string_view> // std::string_view
+#include <vector>      // std::vector
+#include <memory>      // std::unique_ptr
+#include <cstdint>     // std::uint64_t
+#include <chrono>      // std::chrono::steady_clock
 #include <fstream>     // 파일 입출력을 위한 헤더
 #include <sstream>     // 문자열 스트림
 #include <iostream>    // 콘솔 입출력을 위한 헤더
 #include <glm/glm.hpp> // glm 라이브러리
 
+/**
+ * 쉐이더 프로그램의 uniform location 을 전송할 값의 타입과 함께 보관하는 handle
+ *
+ * Shader::getUniformHandle() 로 한번 조회해두면 이후에는 Shader::set() 에 handle 을 전달하여
+ * 이름 문자열의 hashing 및 비교 없이 바로 uniform 을 전송할 수 있음.
+ * -> 타입이 다른 값을 전송하려고 하면 컴파일 에러가 발생하므로 glUniform* 함수를 잘못 고르는 실수를 막아줌.
+ */
+template <typename T>
+struct UniformHandle
+{
+  GLint location = -1; // 쉐이더에 없는 uniform 이면 -1 (glUniform* 에 -1 을 전달하면 아무것도 하지 않음)
+
+  bool isValid() const
+  {
+    return location != -1;
+  }
+};
+
+// Shader::pollReload() 의 결과
+enum class ShaderReloadResult
+{
+  None,    // 진행 중인 reload 가 없음
+  Pending, // 새 프로그램을 아직 컴파일 및 링크하는 중
+  Swapped, // 새 프로그램이 링크되어 기존 프로그램과 교체됨
+  Failed   // 새 프로그램의 컴파일 또는 링크에 실패하여 기존 프로그램을 계속 사용함
+};
+
 /*
   Shader 클래스
 
@@ -23,14 +55,28 @@
 
   즉, 기존 쉐이더 관련 코드들을 별도의 클래스로 추출하는
   리팩토링을 했다고 보면 됨!
+
+  -> 생성자는 컴파일 및 링크를 드라이버에 제출만 하고, 컴파일 에러 검사 및 uniform 조회처럼
+  링크 결과가 필요한 작업은 프로그램을 처음 사용할 때 수행함. (하단 필기 참고)
 */
 class Shader
 {
 public:
   unsigned int ID; // 생성된 ShaderProgram의 참조 ID
 
-  // Shader 클래스 생성자
-  Shader(const GLchar *vertexPath, const GLchar *fragmentPath);
+  /**
+   * Shader 클래스 생성자
+   *
+   * @param vertexName, fragmentName 쉐이더 소스 이름 (ex> "pbr.vs") -> ShaderSources::load() 로 조회함
+   */
+  Shader(const GLchar *vertexName, const GLchar *fragmentName);
+
+  /**
+   * 두 쉐이더 소스의 #version 지시문 바로 다음 줄에 #define 들을 삽입하여 컴파일하는 생성자
+   *
+   * @param defines "이름" 또는 "이름 값" 형태의 매크로 목록 (ex> "IBL_ENABLED", "LIGHT_COUNT 2")
+   */
+  Shader(const GLchar *vertexName, const GLchar *fragmentName, const std::vector<std::string> &defines);
 
   // Shader 클래스 소멸자
   ~Shader();
@@ -38,23 +84,150 @@ public:
   // ShaderProgram 객체 활성화
   void use();
 
-  // 유니폼 변수 관련 유틸리티
-  void setBool(const std::string &name, bool value) const;
-  void setInt(const std::string &name, int value) const;
-  void setFloat(const std::string &name, float value) const;
-  void setVec2(const std::string &name, const glm::vec2 &value) const;
-  void setVec2(const std::string &name, float x, float y) const;
-  void setVec3(const std::string &name, const glm::vec3 &value) const;
-  void setVec3(const std::string &name, float x, float y, float z) const;
-  void setVec4(const std::string &name, const glm::vec4 &value) const;
-  void setVec4(const std::string &name, float x, float y, float z, float w) const;
-  void setMat2(const std::string &name, const glm::mat2 &mat) const;
-  void setMat3(const std::string &name, const glm::mat3 &mat) const;
-  void setMat4(const std::string &name, const glm::mat4 &mat) const;
+  /*
+    제출해둔 컴파일 및 링크 결과를 기다리지 않고 조회할 수 있는지 여부
+
+    -> KHR_parallel_shader_compile 을 지원하지 않으면 끝났는지 알 수 없으므로 항상 true (조회 시 끝날 때까지 기다림)
+  */
+  bool isLinkComplete() const;
+
+  // 제출해둔 컴파일 및 링크가 끝날 때까지 기다린 뒤 결과 검사 (이미 끝났으면 아무것도 하지 않음)
+  void waitForLink() const
+  {
+    if (linkPending)
+    {
+      finishLink();
+    }
+  }
+
+  /**
+   * 프로그램 링크 시 조회해둔 uniform location 반환
+   *
+   * 쉐이더에 없는 uniform 이거나 uniform block 의 멤버이면 -1 반환.
+   * 배열 uniform 은 "name", "name[0]", "name[1]" ... 처럼 원소마다 조회할 수 있음.
+   */
+  GLint getUniformLocation(std::string_view name) const;
+
+  // 매 프레임 전송하는 uniform 은 초기화 시 handle 을 조회해두고 set() 으로 전송
+  template <typename T>
+  UniformHandle<T> getUniformHandle(std::string_view name) const
+  {
+    return {getUniformLocation(name)};
+  }
+
+  // 프로그램에서 사용되는 (location 을 가진) uniform 개수 (배열은 원소마다 집계)
+  size_t getActiveUniformCount() const;
+
+  // handle 로 uniform 변수에 값 전송 (호출 전에 use() 로 프로그램이 바인딩되어 있어야 함)
+  void set(UniformHandle<bool> handle, bool value) const;
+  void set(UniformHandle<int> handle, int value) const;
+  void set(UniformHandle<float> handle, float value) const;
+  void set(UniformHandle<glm::vec2> handle, const glm::vec2 &value) const;
+  void set(UniformHandle<glm::vec3> handle, const glm::vec3 &value) const;
+  void set(UniformHandle<glm::vec4> handle, const glm::vec4 &value) const;
+  void set(UniformHandle<glm::mat2> handle, const glm::mat2 &mat) const;
+  void set(UniformHandle<glm::mat3> handle, const glm::mat3 &mat) const;
+  void set(UniformHandle<glm::mat4> handle, const glm::mat4 &mat) const;
+
+  // 유니폼 변수 관련 유틸리티 (이름으로 location 을 조회하여 전송)
+  void setBool(std::string_view name, bool value) const;
+  void setInt(std::string_view name, int value) const;
+  void setFloat(std::string_view name, float value) const;
+  void setVec2(std::string_view name, const glm::vec2 &value) const;
+  void setVec2(std::string_view name, float x, float y) const;
+  void setVec3(std::string_view name, const glm::vec3 &value) const;
+  void setVec3(std::string_view name, float x, float y, float z) const;
+  void setVec4(std::string_view name, const glm::vec4 &value) const;
+  void setVec4(std::string_view name, float x, float y, float z, float w) const;
+  void setMat2(std::string_view name, const glm::mat2 &mat) const;
+  void setMat3(std::string_view name, const glm::mat3 &mat) const;
+  void setMat4(std::string_view name, const glm::mat4 &mat) const;
+
+  // uniform block 을 UBO 가 연결될 binding point 에 연결 (쉐이더에 해당 uniform block 이 없으면 무시)
+  void setUniformBlockBinding(const std::string &name, GLuint bindingPoint) const;
+
+  // fileName 이 이 프로그램의 vertex 또는 fragment 쉐이더 소스 이름인지 검사
+  bool usesSource(std::string_view fileName) const;
+
+  /**
+   * 같은 소스 경로 및 #define 들로 새 프로그램의 컴파일 및 링크를 제출 (기다리지 않음)
+   *
+   * 이미 진행 중인 reload 가 있으면 취소하고 다시 제출함.
+   */
+  void beginReload();
+
+  /**
+   * 제출해둔 reload 의 링크가 끝났으면 결과에 따라 프로그램 교체
+   *
+   * 링크에 성공하면 기존 프로그램의 uniform 값 및 uniform block binding 을 새 프로그램에 복사한 뒤 교체하므로,
+   * 초기화 시 한번만 전송한 sampler texture unit 같은 상태를 다시 설정할 필요가 없음.
+   * -> uniform location 은 바뀔 수 있으므로, handle 을 보관하는 쪽은 getRevision() 이 바뀌면 다시 조회해야 함.
+   * -> 링크에 실패하면 기존 프로그램을 그대로 사용함.
+   */
+  ShaderReloadResult pollReload();
+
+  // reload 로 프로그램이 교체될 때마다 증가하는 값
+  std::uint32_t getRevision() const;
 
 private:
+  /*
+    uniform 이름 -> location 을 저장하는 open addressing (linear probing) 해시 테이블의 slot
+
+    -> slot 들을 하나의 배열에 연속으로 저장하여, 조회 시 pointer chasing 없이 인접한 slot 들만 순회함.
+    -> 테이블 크기는 2의 거듭제곱이고 slot 의 절반 이하만 사용하므로 빈 slot 을 만나면 조회가 끝남.
+  */
+  struct UniformSlot
+  {
+    std::uint64_t hash = 0;
+    std::string name;
+    GLint location = -1;
+    GLenum type = GL_NONE;
+    bool occupied = false;
+  };
+
+  // 링크 결과가 필요한 시점에 채워지므로 const 멤버 함수에서도 갱신할 수 있도록 mutable 로 선언
+  mutable std::vector<UniformSlot> uniformSlots;
+  mutable size_t uniformCount = 0;
+
+  // 컴파일 및 링크를 제출만 하고 결과를 아직 조회하지 않은 프로그램의 쉐이더 객체 및 제출 정보
+  struct PendingLink
+  {
+    GLuint vertex = 0;
+    GLuint fragment = 0;
+    std::uint64_t cacheKey = 0;
+    float submitTimeMs = 0.0f;
+    std::chrono::steady_clock::time_point submitEnd;
+  };
+
+  mutable PendingLink pendingLink;
+  mutable bool linkPending = false;
+
+  // 제출해둔 링크 결과를 조회하여 에러 검사, 쉐이더 객체 삭제, 바이너리 캐시 저장 및 uniform 조회 수행
+  void finishLink() const;
+
+  // reload 시 같은 프로그램을 다시 생성하기 위한 소스 이름 및 #define 들
+  std::string vertexName;
+  std::string fragmentName;
+  std::vector<std::string> defines;
+
+  // reload 로 제출한 새 프로그램 (링크에 성공하면 내부 상태를 교체한 뒤 기존 프로그램과 함께 삭제됨)
+  std::unique_ptr<Shader> reloadCandidate;
+  std::uint32_t revision = 0;
+
+  // source 의 #version 지시문 다음 줄에 #define 들을 삽입한 소스 반환 (컴파일 에러의 줄 번호가 원본과 같도록 #line 으로 보정)
+  static std::string injectDefines(std::string_view source, const std::vector<std::string> &defines);
+
+  // 링크된 프로그램의 active uniform 들을 glGetActiveUniform() 으로 조회하여 해시 테이블 생성
+  void introspectUniforms() const;
+  void insertUniform(const std::string &name, GLint location, GLenum type) const;
+  const UniformSlot *findUniform(std::string_view name) const;
+
+  // 이 프로그램의 uniform 값 및 uniform block binding 을 target 프로그램의 같은 이름, 같은 타입의 uniform 에 복사
+  void copyProgramState(const Shader &target) const;
+  static std::uint64_t hashName(std::string_view name);
+
   // 쉐이더 객체 및 쉐이더 프로그램 객체의 컴파일 및 링킹 에러 대응
-  void checkCompileErrors(unsigned int shader, std::string type);
+  static void checkCompileErrors(unsigned int shader, std::string type);
 };
 
 #endif // SHADER_HPP
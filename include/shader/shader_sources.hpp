@@ -0,0 +1,32 @@
+#ifndef SHADER_SOURCES_HPP
+#define SHADER_SOURCES_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <string>
+#include <string_view>
+
+/**
+ * 쉐이더 소스 조회 함수들
+ *
+ * 쉐이더 소스는 빌드 시 cmake/embed_shaders.cmake 로 실행 파일에 포함되므로,
+ * 실행 위치와 무관하게 소스 이름 (ex> "pbr.fs") 만으로 조회할 수 있음.
+ */
+namespace ShaderSources
+{
+  // 실행 파일에 포함된 소스를 복사 없이 가리키는 view 반환 (없으면 빈 view)
+  std::string_view findEmbedded(std::string_view name);
+
+  /**
+   * name 에 해당하는 쉐이더 소스 반환
+   *
+   * ShaderConstants::SOURCE_OVERRIDE_ENABLED 가 켜져 있고 override 디렉토리에 같은 이름의 파일이 있으면
+   * 파일을 읽어서 storage 에 저장한 뒤 storage 를 가리키는 view 를 반환하고, 그 외에는 findEmbedded() 결과를 반환함.
+   */
+  std::string_view load(std::string_view name, std::string &storage);
+}
+
+#endif /* SHADER_SOURCES_HPP */
@@ -0,0 +1,137 @@
+#ifndef SHADER_VARIANT_CACHE_HPP
+#define SHADER_VARIANT_CACHE_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <array>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <memory>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <shader/shader.hpp>
+#include <gl_objects/query_object.hpp>
+#include <constants/shader_constants.hpp>
+
+// 같은 소스에 서로 다른 #define 들을 삽입하여 컴파일한 쉐이더 프로그램 하나
+struct ShaderVariant
+{
+  std::unique_ptr<Shader> shader;
+  std::uint32_t key;
+  std::string label; // 통계 출력용 이름
+
+  // 가장 최근에 측정된 프레임에서 이 변형으로 그린 구간들의 GPU 처리 시간 합 (ms)
+  float gpuTimeMs = 0.0f;
+
+  // 등록된 초기화 함수들이 적용되었는지 여부 (prepare() 로 제출만 해둔 변형은 처음 요청될 때 적용됨)
+  bool initialized = false;
+};
+
+// ShaderVariantCache::getVariantStats() 로 집계하는 변형별 통계 (label 은 캐시가 소유한 문자열을 가리킴)
+struct ShaderVariantStats
+{
+  const char *label;
+  float gpuTimeMs;
+};
+
+/**
+ * ShaderVariantCache 클래스
+ *
+ * 하나의 vertex / fragment 쉐이더 소스로부터 #define 조합마다 다른 쉐이더 프로그램(변형)을 생성하고,
+ * 호출하는 쪽에서 정한 정수 key 로 캐싱하는 클래스.
+ *
+ * 변형은 처음 요청될 때 한번만 컴파일되며 (ProgramBinaryCache 덕분에 다음 실행부터는 바이너리로 로드됨),
+ * 생성 직후 addProgramInitializer() 로 등록된 함수들을 호출하여 sampler texture unit, uniform block binding 처럼
+ * 프로그램마다 한번만 설정하면 되는 상태를 적용함.
+ *
+ * -> 각 변형으로 그린 구간을 beginGpuTimer() ~ endGpuTimer() 로 감싸면 GL_TIMESTAMP query 로 변형별 GPU 처리 시간을 측정함.
+ */
+class ShaderVariantCache
+{
+public:
+  ShaderVariantCache(const std::string &vertexName, const std::string &fragmentName);
+
+  /**
+   * 변형이 생성될 때마다 호출할 초기화 함수 등록
+   *
+   * 이미 생성된 변형들에도 곧바로 적용되므로, 등록 순서와 무관하게 모든 변형에 한번씩 적용됨.
+   * -> 단, prepare() 로 제출만 해둔 변형은 링크를 기다리지 않도록 처음 요청될 때 모아서 적용함.
+   */
+  void addProgramInitializer(std::function<void(Shader &)> initializer);
+
+  /**
+   * key 에 해당하는 변형 반환
+   *
+   * 캐시에 없으면 defines 를 삽입한 소스로 컴파일하여 생성함. (같은 key 에는 항상 같은 defines 를 전달해야 함)
+   */
+  ShaderVariant &acquire(std::uint32_t key, const std::vector<std::string> &defines, const std::string &label);
+
+  /**
+   * key 에 해당하는 변형의 컴파일 및 링크를 제출만 해둠
+   *
+   * 초기화 함수는 적용하지 않으므로 링크가 끝나기를 기다리지 않고 반환되며,
+   * 이후 acquire() 또는 find() 로 처음 요청될 때 링크 결과를 조회하고 초기화 함수들을 적용함.
+   */
+  void prepare(std::uint32_t key, const std::vector<std::string> &defines, const std::string &label);
+
+  // key 에 해당하는 변형이 이미 생성되어 있으면 반환, 없으면 nullptr (defines 를 만들지 않고 조회할 때 사용)
+  ShaderVariant *find(std::uint32_t key);
+
+  size_t size() const;
+
+  // fileName 이 이 캐시의 vertex 또는 fragment 쉐이더 소스이면 모든 변형의 reload 를 제출
+  void beginReload(std::string_view fileName);
+
+  // 제출해둔 변형들의 reload 결과를 확인하여 링크가 끝난 변형부터 교체 (기다리지 않음)
+  void pollReloads();
+
+  // 프레임 시작 시 호출하여, 가장 오래 전 프레임의 timestamp query 결과를 변형별 GPU 처리 시간으로 반영
+  void beginFrame();
+
+  // variant 로 그리는 구간의 시작 및 종료 시각 기록 (구간은 중첩될 수 없음)
+  void beginGpuTimer(ShaderVariant &variant);
+  void endGpuTimer();
+
+  // 생성된 순서대로 변형별 통계를 stats 에 추가
+  void getVariantStats(std::vector<ShaderVariantStats> &stats) const;
+
+private:
+  std::string vertexName;
+  std::string fragmentName;
+
+  std::vector<std::function<void(Shader &)>> programInitializers;
+
+  std::unordered_map<std::uint32_t, std::unique_ptr<ShaderVariant>> variants;
+  std::vector<ShaderVariant *> variantOrder; // 생성된 순서 (통계 출력 순서를 고정하기 위함)
+
+  // key 에 해당하는 변형을 찾고, 없으면 컴파일 및 링크를 제출하여 생성 (초기화 함수는 적용하지 않음)
+  ShaderVariant &findOrCreate(std::uint32_t key, const std::vector<std::string> &defines, const std::string &label);
+
+  // 아직 초기화 함수들이 적용되지 않은 변형이면 적용
+  void initialize(ShaderVariant &variant);
+
+  // 한 변형으로 그린 구간의 시작 및 종료 timestamp query
+  struct TimerSpan
+  {
+    std::unique_ptr<QueryObject> begin;
+    std::unique_ptr<QueryObject> end;
+    ShaderVariant *variant = nullptr;
+  };
+
+  // 한 프레임 동안 기록한 구간들 (query 객체는 재사용하므로 usedCount 만 초기화함)
+  struct FrameTimers
+  {
+    std::vector<TimerSpan> spans;
+    size_t usedCount = 0;
+  };
+
+  std::array<FrameTimers, ShaderConstants::VARIANT_TIMER_FRAMES> frameTimers;
+  size_t frameIndex = 0;
+};
+
+#endif /* SHADER_VARIANT_CACHE_HPP */
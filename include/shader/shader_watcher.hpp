@@ -0,0 +1,48 @@
+#ifndef SHADER_WATCHER_HPP
+#define SHADER_WATCHER_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <string>
+#include <vector>
+
+/**
+ * ShaderWatcher 클래스
+ *
+ * 쉐이더 소스 디렉토리의 파일 변경을 감시하여, 렌더링 루프에서 매 프레임 변경된 파일 이름들을 조회할 수 있도록 하는 클래스.
+ *
+ * Linux 에서는 inotify 를 non-blocking 모드로 사용하므로 poll() 은 변경이 없으면 바로 반환됨.
+ * 지원하지 않는 플랫폼에서는 watch() 가 false 를 반환하고 poll() 은 아무것도 하지 않음.
+ *
+ * -> 에디터는 파일을 직접 덮어쓰거나 임시 파일에 쓴 뒤 rename 하므로, 쓰기가 끝난 시점(IN_CLOSE_WRITE)과
+ * 다른 이름에서 옮겨진 시점(IN_MOVED_TO)을 모두 변경으로 처리함.
+ */
+class ShaderWatcher
+{
+public:
+  ShaderWatcher();
+  ~ShaderWatcher();
+
+  ShaderWatcher(const ShaderWatcher &) = delete;
+  ShaderWatcher &operator=(const ShaderWatcher &) = delete;
+
+  // directory 의 파일 변경 감시 시작 (이미 감시 중이면 이전 감시는 종료됨)
+  bool watch(const std::string &directory);
+
+  // 지난 호출 이후 변경된 파일 이름들을 changedFiles 에 추가 (한 번의 호출에서 같은 파일은 한번만 추가)
+  void poll(std::vector<std::string> &changedFiles);
+
+private:
+  int inotifyFd;
+  int watchDescriptor;
+
+  // inotify 이벤트를 읽어올 버퍼 (매 프레임 재할당하지 않도록 멤버로 유지)
+  std::vector<char> eventBuffer;
+
+  void close();
+};
+
+#endif /* SHADER_WATCHER_HPP */
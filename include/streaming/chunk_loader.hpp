@@ -0,0 +1,75 @@
+#ifndef CHUNK_LOADER_HPP
+#define CHUNK_LOADER_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include "streaming/chunked_mesh_file.hpp"
+
+// I/O 스레드가 읽기를 마친 chunk
+struct LoadedChunk
+{
+  size_t chunk = 0;
+  ChunkData data;
+  bool failed = false;
+};
+
+/**
+ * ChunkLoader 클래스
+ *
+ * 백그라운드 I/O 스레드들에서 chunk payload 를 읽어들이는 클래스
+ *
+ * 렌더링 스레드가 우선순위 순서로 요청 목록을 넘기면 I/O 스레드들이 앞에서부터 하나씩 가져가서 읽고,
+ * 읽기를 마친 chunk 는 렌더링 스레드가 poll() 로 가져가서 GPU 에 업로드함.
+ * -> 렌더링 스레드는 파일 읽기를 기다리지 않으며, GL 호출은 모두 렌더링 스레드에서만 수행됨.
+ */
+class ChunkLoader
+{
+public:
+  // file 은 ChunkLoader 보다 오래 유지되어야 함
+  ChunkLoader(const ChunkedMeshFile &file, size_t threadCount);
+
+  // 진행 중인 읽기가 끝나면 모든 I/O 스레드 종료
+  ~ChunkLoader();
+
+  ChunkLoader(const ChunkLoader &) = delete;
+  ChunkLoader &operator=(const ChunkLoader &) = delete;
+
+  // 아직 읽기 시작하지 않은 요청들을 모두 취소하고 cancelled 에 추가 (이미 읽고 있는 chunk 는 poll() 로 전달됨)
+  void cancelRequests(std::vector<size_t> &cancelled);
+
+  // 요청 목록 뒤에 chunks 를 순서대로 추가 (앞쪽에 있을수록 먼저 읽힘)
+  void addRequests(const std::vector<size_t> &chunks);
+
+  // 읽기를 마친 chunk 가 있으면 loaded 로 옮기고 true 반환
+  bool poll(LoadedChunk &loaded);
+
+  // 지금까지 파일에서 읽어들인 총 bytes
+  size_t getReadBytes() const;
+
+private:
+  const ChunkedMeshFile &file;
+
+  std::vector<std::thread> threads;
+
+  std::mutex mutex;
+  std::condition_variable requestAvailable;
+  std::deque<size_t> requests;
+  std::deque<LoadedChunk> completed;
+  bool stopping = false;
+
+  std::atomic<size_t> readBytes{0};
+
+  // I/O 스레드의 대기 및 읽기 루프
+  void ioLoop();
+};
+
+#endif /* CHUNK_LOADER_HPP */
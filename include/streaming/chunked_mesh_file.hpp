@@ -0,0 +1,116 @@
+#ifndef CHUNKED_MESH_FILE_HPP
+#define CHUNKED_MESH_FILE_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstdint>
+#include "mesh/mesh.hpp"
+#include "mesh/bounding_volume.hpp"
+
+/**
+ * chunk 파일에 저장되어 GPU 에 그대로 업로드되는 정점 구조체 타입
+ *
+ * chunk 마다 정점 개수가 16-bit 인덱스 범위 이내이고 chunk 별로 position 을 양자화하므로,
+ * 파일에서 읽은 데이터를 변환 없이 곧바로 GeometryArena 에 업로드할 수 있음.
+ */
+using ChunkVertexData = QuantizedVertexData;
+using ChunkIndexType = std::uint16_t;
+
+/**
+ * chunk 파일 헤더
+ *
+ * 파일 구조는 [헤더][chunk payload 들][ChunkNode 배열][ChunkRecord 배열] 순서이며,
+ * payload 를 먼저 순차적으로 기록하고 테이블 위치는 헤더에 기록함.
+ */
+struct ChunkedMeshHeader
+{
+  char magic[4];
+  std::uint32_t version;
+  std::uint32_t vertexStride; // sizeof(ChunkVertexData) (정점 포맷이 바뀌면 이전에 변환한 파일을 사용하지 않도록 함)
+  std::uint32_t nodeCount;
+  std::uint32_t chunkCount;
+  std::uint32_t reserved;
+  std::uint64_t tableOffset; // ChunkNode 배열이 시작하는 위치 (bytes)
+  BoundingBox bounds;
+};
+
+/**
+ * chunk 들의 공간 계층 구조를 이루는 노드 (전위 순회 순서로 저장)
+ *
+ * 노드 i 의 하위 노드들은 [i + 1, subtreeEnd) 범위에 위치하므로,
+ * 노드의 bounding box 가 카메라에서 멀리 있으면 subtreeEnd 로 건너뛰어 하위 chunk 들을 한번에 제외할 수 있음.
+ */
+struct ChunkNode
+{
+  BoundingBox bounds;
+  std::uint32_t subtreeEnd;
+  std::int32_t chunk; // leaf 노드가 가리키는 chunk 인덱스 (내부 노드는 -1)
+};
+
+// chunk 하나의 payload 위치 및 그리기에 필요한 정보
+struct ChunkRecord
+{
+  std::uint64_t offset; // payload 가 시작하는 위치 (bytes)
+  std::uint32_t vertexCount;
+  std::uint32_t indexCount;
+  PositionDequantization dequantization;
+  BoundingSphere sphere;
+
+  // payload 크기 (= GPU 에 업로드될 정점 및 인덱스 버퍼 크기)
+  size_t getByteSize() const
+  {
+    return vertexCount * sizeof(ChunkVertexData) + indexCount * sizeof(ChunkIndexType);
+  }
+};
+
+// 파일에서 읽어들인 chunk 하나의 정점 및 인덱스
+struct ChunkData
+{
+  std::vector<ChunkVertexData> vertices;
+  std::vector<ChunkIndexType> indices;
+};
+
+namespace ChunkedMeshFormat
+{
+  constexpr char MAGIC[4] = {'C', 'H', 'M', 'S'};
+  constexpr std::uint32_t VERSION = 1;
+}
+
+/**
+ * ChunkedMeshFile 클래스
+ *
+ * chunk 파일의 헤더, 노드 계층 구조 및 chunk 테이블만 메모리에 읽어두고,
+ * 각 chunk 의 payload 는 필요할 때 readChunk() 로 읽어들이는 클래스
+ *
+ * -> 여러 I/O 스레드가 동시에 읽을 수 있도록 파일 스트림은 스레드마다 openStream() 으로 따로 열어서 사용함.
+ */
+class ChunkedMeshFile
+{
+public:
+  // 헤더 및 테이블을 읽어들임 (파일이 없거나 형식이 맞지 않으면 std::runtime_error)
+  explicit ChunkedMeshFile(const std::string &path);
+
+  const ChunkedMeshHeader &getHeader() const;
+  const std::vector<ChunkNode> &getNodes() const;
+  const std::vector<ChunkRecord> &getChunks() const;
+
+  // chunk payload 를 읽을 새 파일 스트림 생성
+  std::ifstream openStream() const;
+
+  // stream 에서 chunk 번째 payload 를 읽어서 data 에 저장 (읽기에 실패하면 std::runtime_error)
+  void readChunk(std::ifstream &stream, size_t chunk, ChunkData &data) const;
+
+private:
+  std::string path;
+  ChunkedMeshHeader header;
+  std::vector<ChunkNode> nodes;
+  std::vector<ChunkRecord> chunks;
+};
+
+#endif /* CHUNKED_MESH_FILE_HPP */
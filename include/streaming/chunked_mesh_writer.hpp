@@ -0,0 +1,56 @@
+#ifndef CHUNKED_MESH_WRITER_HPP
+#define CHUNKED_MESH_WRITER_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include "mesh/mesh.hpp"
+
+/**
+ * ChunkedMeshWriter 네임스페이스
+ *
+ * mesh 를 공간적으로 인접한 삼각형들의 chunk 로 나눠서 chunk 파일로 기록하는 함수들
+ * (chunk 파일 형식은 ChunkedMeshFile 참고)
+ *
+ * -> 변환은 한번만 수행하는 단계이고 (StreamingFeature 는 백그라운드 스레드에서 수행),
+ * 변환된 파일을 보는 동안에는 StreamingMesh 가 메모리 예산 이내의 chunk 들만 읽어들임.
+ * -> 기록 중인 파일은 "<path>.partial" 에 쓰고 완료된 뒤에만 path 로 이름을 바꾸므로, 중간에 중단되어도 path 에는 완성된 파일만 남음.
+ */
+namespace ChunkedMeshWriter
+{
+  /**
+   * 메모리에 올린 삼각형들을 무게중심 기준으로 가장 긴 축의 중앙값에서 반복적으로 나눠서
+   * 삼각형 개수가 maxTrianglesPerChunk 이하인 chunk 들과 그 계층 구조를 path 에 기록
+   *
+   * 실패하면 std::runtime_error, maxTrianglesPerChunk 가 16-bit 인덱스로 그릴 수 없는 크기이면 std::invalid_argument 를 던짐.
+   */
+  void write(const std::string &path, const std::vector<VertexData> &vertices, const std::vector<unsigned int> &indices, size_t maxTrianglesPerChunk);
+
+  /**
+   * Assimp 로 읽을 수 있는 3D 모델 파일의 모든 mesh 를 노드 변환을 적용하여 합친 뒤 chunk 파일로 변환
+   *
+   * 변환된 정점 전체를 한번에 메모리에 올리지 않고, 아래 순서로 일정한 크기씩 나눠서 처리함.
+   *
+   *  1. Assimp Scene 의 삼각형들을 batchTriangles 개씩 임시 파일에 기록한 뒤 Scene 을 해제
+   *  2. 삼각형이 maxTrianglesInMemory 개보다 많은 임시 파일은 무게중심 histogram 으로 중앙값 근처의 분할 위치를 찾고,
+   *  batchTriangles 개씩 읽으면서 두 임시 파일로 나눠서 기록 (계층 구조의 상위 노드가 됨)
+   *  3. maxTrianglesInMemory 개 이하가 된 임시 파일만 메모리에 올려서 write() 와 같은 방식으로 chunk 들을 기록
+   *
+   * -> Assimp 는 원본 파일 전체를 한번에 import 하므로 1 단계의 최대 메모리 사용량은 원본 Scene 크기에 비례하지만,
+   * 이후 단계는 원본 크기와 관계없이 maxTrianglesInMemory 에 비례하는 메모리만 사용함.
+   * -> cancelRequested 가 true 가 되면 batch 사이에서 중단하고 임시 파일들을 지운 뒤 false 를 반환함. (완료되면 true)
+   */
+  bool convert(const std::string &modelPath,
+               const std::string &outputPath,
+               size_t maxTrianglesPerChunk,
+               size_t maxTrianglesInMemory,
+               size_t batchTriangles,
+               const std::atomic<bool> *cancelRequested = nullptr);
+}
+
+#endif /* CHUNKED_MESH_WRITER_HPP */
@@ -0,0 +1,163 @@
+#ifndef STREAMING_MESH_HPP
+#define STREAMING_MESH_HPP
+
+/*
+  #ifndef ~ #endif 전처리기는
+  헤더파일의 헤더가드를 처리하여 중복 include 방지해 줌!
+*/
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include "mesh/mesh.hpp"
+#include "mesh/geometry_arena.hpp"
+#include "camera/frustum.hpp"
+#include "gl_objects/fence_object.hpp"
+#include "streaming/chunked_mesh_file.hpp"
+#include "streaming/chunk_loader.hpp"
+
+// StreamingMesh 의 chunk 상주 현황
+struct StreamingStats
+{
+  size_t chunkCount = 0;
+  size_t residentChunkCount = 0;
+  size_t loadingChunkCount = 0;
+  size_t drawnChunkCount = 0;
+
+  // GPU 에 상주하는 chunk 크기 (내려졌지만 GPU 가 아직 사용 중일 수 있어서 해제를 기다리는 영역 포함) 및 읽기 중인 chunk 크기
+  size_t residentBytes = 0;
+  size_t loadingBytes = 0;
+
+  // 가장 최근의 update() 에서 업로드한 bytes 및 지금까지 파일에서 읽어들인 총 bytes
+  size_t uploadedBytes = 0;
+  size_t readBytes = 0;
+};
+
+/**
+ * StreamingMesh 클래스
+ *
+ * 메모리에 한번에 올릴 수 없는 크기의 mesh 를 chunk 파일(ChunkedMeshFile)로부터 필요한 chunk 만 읽어서 그리는 클래스
+ *
+ * 매 프레임 update() 에서 chunk 계층 구조를 따라 카메라로부터 stream radius 이내의 chunk 들을 가까운 순서로 모으고,
+ * 메모리 예산 안에 들어오는 chunk 들만 백그라운드 I/O 스레드에 요청하며, 예산 밖으로 밀려난 chunk 는 GPU 에서 내림.
+ *
+ * -> 읽기를 마친 chunk 는 프레임당 업로드 크기 상한 이내에서 GeometryArena 에 동기화 없이 매핑하여 업로드하고,
+ * 내린 chunk 의 버퍼 영역은 이를 읽던 GPU 명령들이 끝났음을 fence 로 확인한 뒤에 arena 에 반납하여 재사용함.
+ */
+class StreamingMesh
+{
+public:
+  StreamingMesh(const std::string &path, size_t memoryBudget, size_t ioThreadCount);
+
+  // I/O 스레드들을 먼저 종료한 뒤 버퍼 해제
+  ~StreamingMesh();
+
+  // 상주 및 읽기 중인 chunk 크기의 합이 넘지 않도록 할 상한 (bytes)
+  void setMemoryBudget(size_t memoryBudget);
+
+  // chunk 를 읽어들일 카메라로부터의 거리 (object space 기준)
+  void setStreamRadius(float streamRadius);
+
+  // chunk 파일 전체의 bounding box (object space 기준)
+  const BoundingBox &getBounds() const;
+
+  /**
+   * 카메라 위치를 기준으로 chunk 들을 요청, 업로드 및 해제하는 멤버 함수 (매 프레임 draw() 이전에 호출)
+   *
+   * @param cameraPosition object space 기준 카메라 위치
+   */
+  void update(const glm::vec3 &cameraPosition);
+
+  /**
+   * 상주 중인 chunk 들 중 절두체 안에 있는 chunk 들을 그리는 멤버 함수
+   *
+   * chunk 들은 텍스쳐가 없으므로 현재 쉐이더에 전송된 Material uniform 으로 그려짐.
+   *
+   * @param frustum object space 기준 카메라 절두체
+   * @return 실제로 호출된 draw call 개수
+   */
+  unsigned int draw(const Frustum &frustum);
+
+  const StreamingStats &getStats() const;
+
+private:
+  enum class ChunkState : std::uint8_t
+  {
+    UNLOADED,
+    LOADING,  // I/O 스레드에 요청되었거나 읽기를 마치고 업로드를 기다리는 상태
+    RESIDENT, // GPU 버퍼에 업로드된 상태
+    FAILED,   // 읽기에 실패하여 더 이상 요청하지 않는 상태
+  };
+
+  struct ChunkCandidate
+  {
+    float distance;
+    std::uint32_t chunk;
+  };
+
+  // 내린 chunk 들의 버퍼 영역과 그 영역을 읽던 GPU 명령들 뒤에 삽입한 fence
+  struct PendingFree
+  {
+    std::unique_ptr<FenceObject> fence;
+    std::vector<MeshGeometry> geometries;
+    size_t bytes;
+  };
+
+  ChunkedMeshFile file;
+  GeometryArena<ChunkVertexData, ChunkIndexType> arena;
+
+  size_t memoryBudget;
+  float streamRadius;
+
+  // chunk 별 상태 및 상주 중인 chunk 가 arena 에서 할당받은 버퍼 영역
+  std::vector<ChunkState> chunkStates;
+  std::vector<MeshGeometry> chunkGeometries;
+  std::vector<std::uint32_t> residentChunks;
+
+  // chunk 가 가장 최근에 메모리 예산 안에 선택된 update() 번호
+  std::vector<std::uint32_t> keepFrames;
+  std::uint32_t frame = 0;
+
+  // 해제를 기다리는 버퍼 영역들
+  std::deque<PendingFree> pendingFrees;
+
+  // 매 프레임 재할당하지 않도록 멤버로 유지하는 배열들
+  std::vector<ChunkCandidate> candidates;
+  std::vector<size_t> requests;
+  std::vector<size_t> cancelledRequests;
+  std::vector<MeshGeometry> evictedGeometries;
+  LoadedChunk loadedChunk;
+  BoundingSphereBatch residentSpheres;
+  std::vector<std::uint8_t> residentVisibility;
+  std::vector<DrawElementsIndirectCommand> drawCommands;
+  std::vector<MeshDrawData> drawData;
+
+  StreamingStats stats;
+
+  // file 과 arena 를 사용하므로 가장 마지막에 생성되고 가장 먼저 소멸되도록 마지막 멤버로 선언
+  std::unique_ptr<ChunkLoader> loader;
+
+  // GPU 명령들이 끝난 버퍼 영역들을 arena 에 반납
+  void retirePendingFrees();
+
+  // 카메라로부터 가까운 chunk 들을 모아서 메모리 예산 안에 들어오는 chunk 들을 표시
+  void selectChunks(const glm::vec3 &cameraPosition);
+
+  // 메모리 예산 밖으로 밀려난 상주 chunk 들을 내림
+  void evictChunks();
+
+  // 읽기를 마친 chunk 들을 프레임당 업로드 크기 상한 이내에서 GPU 에 업로드
+  void uploadChunks();
+
+  // 아직 읽기 시작하지 않은 요청들을 지금 선택된 chunk 들로 교체
+  void requestChunks();
+
+  // 메모리 예산만큼의 chunk 를 버퍼 확장 없이 담을 수 있도록 arena 에 미리 확보할 정점 및 인덱스 개수 (chunk 파일의 정점 : 인덱스 크기 비율 기준)
+  static size_t getInitialVertexCount(const ChunkedMeshFile &file, size_t memoryBudget);
+  static size_t getInitialIndexCount(const ChunkedMeshFile &file, size_t memoryBudget);
+};
+
+#endif /* STREAMING_MESH_HPP */
@@ -0,0 +1,31 @@
+#ifndef INSTANCING_UI_HPP
+#define INSTANCING_UI_HPP
+
+#include "features/instancing_feature.hpp"
+#include "ui_components/check_box.hpp"
+#include "ui_components/combo.hpp"
+
+/**
+ * InstancingUi 클래스
+ *
+ * instancing 관련 파라미터들의 UI 입력을 처리하는
+ * UiComponent 요소들을 관리하는 UI 컨테이너 클래스
+ */
+class InstancingUi : public IListener<InstancingParameter>
+{
+public:
+  InstancingUi();
+  ~InstancingUi();
+
+  bool onUiComponents();
+  void onChange(const InstancingParameter &param) override;
+
+  void getInstancingParam(InstancingParameter &param) const;
+
+private:
+  CheckBox enabled;
+  CheckBox useInstancing;
+  Combo gridSizeSelector;
+};
+
+#endif /* INSTANCING_UI_HPP */
@@ -4,6 +4,8 @@
 #include "features/model_feature.hpp"
 #include "ui_components/drag_float3.hpp"
 #include "ui_components/combo.hpp"
+#include "ui_components/check_box.hpp"
+#include "ui_components/drag_float.hpp"
 
 /**
  * ModelUi 클래스
@@ -27,6 +29,9 @@ private:
   DragFloat3 rotation;
   DragFloat3 scale;
   Combo modelSelector;
+  CheckBox animate;
+  DragFloat animationSpeed;
+  CheckBox sceneEnabled;
 };
 
 #endif /* MODEL_UI_HPP */
@@ -0,0 +1,23 @@
+#ifndef STATS_UI_HPP
+#define STATS_UI_HPP
+
+#include "common/render_stats.hpp"
+
+/**
+ * StatsUi 클래스
+ *
+ * App 에서 집계된 프로파일링 통계(RenderStats)를 출력하는 UI 컨테이너 클래스
+ *
+ * -> 다른 UI 컨테이너들과 달리 사용자 입력을 받지 않고 읽기 전용 텍스트만 출력하므로,
+ * Controller 의 리스너로 등록하지 않고 매 프레임 RenderStats 를 직접 전달받음.
+ */
+class StatsUi
+{
+public:
+  StatsUi();
+  ~StatsUi();
+
+  void onUiComponents(const RenderStats &stats);
+};
+
+#endif /* STATS_UI_HPP */
@@ -0,0 +1,32 @@
+#ifndef STREAMING_UI_HPP
+#define STREAMING_UI_HPP
+
+#include "features/streaming_feature.hpp"
+#include "ui_components/check_box.hpp"
+#include "ui_components/combo.hpp"
+#include "ui_components/drag_float.hpp"
+
+/**
+ * StreamingUi 클래스
+ *
+ * streaming 관련 파라미터들의 UI 입력을 처리하는
+ * UiComponent 요소들을 관리하는 UI 컨테이너 클래스
+ */
+class StreamingUi : public IListener<StreamingParameter>
+{
+public:
+  StreamingUi();
+  ~StreamingUi();
+
+  bool onUiComponents();
+  void onChange(const StreamingParameter &param) override;
+
+  void getStreamingParam(StreamingParameter &param) const;
+
+private:
+  CheckBox enabled;
+  Combo memoryBudgetSelector;
+  DragFloat streamRadius;
+};
+
+#endif /* STREAMING_UI_HPP */
@@ -13,6 +13,9 @@
 #include "ui_containers/light_ui.hpp"
 #include "ui_containers/ibl_ui.hpp"
 #include "ui_containers/model_ui.hpp"
+#include "ui_containers/instancing_ui.hpp"
+#include "ui_containers/streaming_ui.hpp"
+#include "ui_containers/stats_ui.hpp"
 #include <GLFW/glfw3.h> // 다른 모듈에서 glad.h 를 포함하고 있을 지 모르니, glfw3.h 는 가급적 맨 마지막에 include 할 것.
 
 /**
@@ -43,6 +46,9 @@ private:
   LightUi lightUi;
   IBLUi iblUi;
   ModelUi modelUi;
+  InstancingUi instancingUi;
+  StreamingUi streamingUi;
+  StatsUi statsUi;
 
   // ImGui 입력 변경 시 호출할 콜백 함수들
   void onChangeMaterialUi();
@@ -50,6 +56,8 @@ private:
   void onChangeLightUi();
   void onChangeIBLUi();
   void onChangeModelUi();
+  void onChangeInstancingUi();
+  void onChangeStreamingUi();
 };
 
 #endif // UI_MANAGER_HPP
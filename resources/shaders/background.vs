@@ -5,13 +5,16 @@ layout(location = 0) in vec3 aPos;
 /* fragment shader 단계로 출력할 출력 변수 선언 */
 out vec3 WorldPos;
 
-/* 변환 행렬을 전송받는 uniform 변수 선언 */
-
-// 투영 행렬
-uniform mat4 projection;
+/*
+  카메라 uniform block (FrameUniforms 가 매 프레임 한번 업로드하며, pbr.vs, pbr.fs, background.vs 에서 같은 정의로 공유함)
 
-// 뷰 행렬
-uniform mat4 view;
+  -> GLSL 330 에서는 layout(binding = N) 을 지정할 수 없으므로, Shader::setUniformBlockBinding() 으로 binding point 를 연결함.
+*/
+layout(std140) uniform Camera {
+  mat4 projection;     // 투영 행렬
+  mat4 view;           // 뷰 행렬
+  vec4 cameraPosition; // 카메라 위치 (w 는 사용 안함)
+};
 
 void main() {
   // 프래그먼트 쉐이더 단계로 보간하여 출력할 world space 위치값 할당
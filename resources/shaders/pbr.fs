@@ -1,5 +1,15 @@
 #version 330 core
 
+/*
+  PbrShaderVariants 가 #version 다음 줄에 삽입하는 변형 매크로 (삽입되지 않으면 아래 기본값 사용)
+
+  - IBL_ENABLED : 정의되어 있으면 IBL 로 ambient 계산, 아니면 상수 ambient 사용
+  - LIGHT_COUNT : 계산할 광원 개수 (Lights uniform block 앞쪽의 LIGHT_COUNT 개만 읽음)
+*/
+#ifndef LIGHT_COUNT
+#define LIGHT_COUNT 4
+#endif
+
 out vec4 FragColor;
 
 // vertex shader 단계에서 전달받는 입력 변수 선언
@@ -7,13 +17,19 @@ in vec2 TexCoords;
 in vec3 WorldPos;
 in vec3 Normal;
 
-/* OpenGL 에서 전송해 줄 uniform 변수들 선언 */
+// 버텍스 쉐이더로부터 전달받는 PBR Material 파라미터 (instancing 시 인스턴스마다 다름)
+flat in vec3 MaterialAlbedo;
+flat in float MaterialMetallic;
+flat in float MaterialRoughness;
+flat in float MaterialAo;
 
-// PBR Material 파라미터 값을 전송받는 uniform 변수 선언
-uniform vec3 albedo;
-uniform float metallic;
-uniform float roughness;
-uniform float ao;
+// main() 함수 시작 시 위 입력 변수들로 초기화되는 PBR Material 파라미터
+vec3 albedo;
+float metallic;
+float roughness;
+float ao;
+
+/* OpenGL 에서 전송해 줄 uniform 변수들 선언 */
 
 // diffuse term 에 대한 irradiance 계산 결과가 저장된 큐브맵 텍스쳐(= irradiance map) 선언
 uniform samplerCube irradianceMap;
@@ -24,19 +40,27 @@ uniform samplerCube prefilterMap;
 // specular term 에 대한 split-sum approximation 의 두 번째 적분식 계산 결과가 저장된 2D LUT 텍스쳐(= BRDF Integration map) 선언
 uniform sampler2D brdfLUT;
 
-// 광원 정보를 전송받는 uniform 변수 선언
-uniform vec3 lightPositions[4];
-uniform vec3 lightColors[4];
+// 광원 정보를 전송받는 uniform block (std140 에서 vec3 배열 원소는 16 bytes 로 정렬되므로 vec4 로 선언, LightConstants::NUM_LIGHTS 와 같아야 함)
+const int NUM_LIGHTS = 4;
+layout(std140) uniform Lights {
+  vec4 lightPositions[NUM_LIGHTS];
+  vec4 lightColors[NUM_LIGHTS];
+};
 
-// 카메라 위치값을 전송받는 uniform 변수 선언
-uniform vec3 camPos;
+// 카메라 위치값을 전송받는 uniform block (pbr.vs 와 같은 정의)
+layout(std140) uniform Camera {
+  mat4 projection;
+  mat4 view;
+  vec4 cameraPosition;
+};
 
 // Pi 상수 선언
 const float PI = 3.14159265359;
 
-// IBL 파라미터 값을 전송받는 uniform 변수 선언
-uniform bool iblVisibility;
-uniform float iblIntensity;
+// IBL 파라미터 값을 전송받는 uniform block (IBL 적용 여부는 IBL_ENABLED 변형으로 결정됨)
+layout(std140) uniform IBL {
+  float iblIntensity;
+};
 
 /* Cook-Torrance BRDF 의 Specular term 계산에 필요한 함수들 구현 */
 
@@ -184,13 +208,19 @@ vec3 fresnelSchlickRoughness(float cosTheta, vec3 F0, float roughness) {
 }
 
 void main() {
+  // 버텍스 쉐이더로부터 전달받은 PBR Material 파라미터 저장
+  albedo = MaterialAlbedo;
+  metallic = MaterialMetallic;
+  roughness = MaterialRoughness;
+  ao = MaterialAo;
+
   /* 일반적인 조명 알고리즘에 필수적인 방향 벡터들 계산 */
 
   // 버텍스 쉐이더에서 보간된 world space 노멀벡터를 정규화하여 계산해 둠.
   vec3 N = normalize(Normal);
 
   // world space 뷰 벡터 계산
-  vec3 V = normalize(camPos - WorldPos);
+  vec3 V = normalize(cameraPosition.xyz - WorldPos);
 
   /*
     카메라 view vector 방향으로 들어오는 빛 Wo 에 대한 
@@ -217,24 +247,25 @@ void main() {
     광원 개수만큼 반복문을 순회하며 반사율 방정식을 계산하여 
     현재 프래그먼트 지점(p) 에서 Wo 방향(뷰 벡터)으로 반사되는 surface radiance 의 총량(Lo) 누산
     -> direct lighting(직접광) 에서는 적분으로 계산하지 않는 이유 관련 하단 필기 참고
+    -> 반복 횟수가 컴파일 타임 상수이므로 꺼진 광원에 대한 계산은 변형 코드에 포함되지 않음.
   */
-  for(int i = 0; i < 4; i++) {
+  for(int i = 0; i < LIGHT_COUNT; i++) {
     /* 각 direct lighting(직접광)이 방출하는 radiance(즉, 렌더링 방정식의 Li) 근사 */
 
     // 각 광원으로부터 들어오는 조명 벡터(Wi) 계산
-    vec3 L = normalize(lightPositions[i] - WorldPos);
+    vec3 L = normalize(lightPositions[i].xyz - WorldPos);
 
     // 조명 벡터(Wi)와 뷰 벡터(Wo) 사이의 하프 벡터 계산
     vec3 H = normalize(V + L);
 
     // 각 직접광과 surface point(p) 사이의 거리 계산
-    float distance = length(lightPositions[i] - WorldPos);
+    float distance = length(lightPositions[i].xyz - WorldPos);
 
     // 각 직접광과의 거리의 제곱에 반비례하는 감쇄 성분 계산
     float attenuation = 1.0 / (distance * distance);
 
     // 각 직접광에서 방사되는 radiance 계산
-    vec3 radiance = lightColors[i] * attenuation;
+    vec3 radiance = lightColors[i].rgb * attenuation;
 
     /* Cook-Torrance BRDF 계산 */
 
@@ -284,6 +315,7 @@ void main() {
   // 환경광(ambient lighting) 계산 -> IBL 챕터에서 이 환경광이 environment lighting 으로 대체될 것임. -> 하단 필기 참고
   // vec3 ambient = vec3(0.03) * albedo * ao;
 
+#ifdef IBL_ENABLED
   /* 상수값을 사용하던 환경광(ambient lighting) 을 IBL 로 대체하여 계산 (하단 필기 참고) */
 
   /*
@@ -347,12 +379,13 @@ void main() {
     ambient occlusion factor 를 곱해서 환경광이 차폐되는 영역까지 고려하여
     IBL 을 사용한 최종 ambient lighting 계산 완료!
 
-    + iblVisibility 값에 따라 IBL 로 계산된 ambient 값을 사용할 지,
-    direct lighting 계산 시 사용했던 ambient 값을 사용할 지 결정(ambient 관련 하단 필기 참고)
-
     + PBR Material 파라미터와 무관한 iblIntensity 를 하여 IBL 의 비중을 계산함.
   */
-  vec3 ambient = iblVisibility ? (kD * diffuse + specular) * ao * iblIntensity : vec3(0.03) * albedo * ao;
+  vec3 ambient = (kD * diffuse + specular) * ao * iblIntensity;
+#else
+  // IBL 을 적용하지 않는 변형은 direct lighting 계산 시 사용했던 상수 ambient 값을 사용 (ambient 관련 하단 필기 참고)
+  vec3 ambient = vec3(0.03) * albedo * ao;
+#endif
 
   // 현재 surface point 지점에서 최종적으로 반사되는 조명값 계산
   vec3 color = ambient + Lo;
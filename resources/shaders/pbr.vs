@@ -1,21 +1,72 @@
 #version 330 core
 
+// PbrShaderVariants 가 삽입하는 변형 매크로 : INSTANCED_MATERIAL 이 정의되어 있으면 Material 파라미터를 per-instance attribute 로 읽음
+
 layout(location = 0) in vec3 aPos;
 layout(location = 1) in vec3 aNormal;
 layout(location = 2) in vec2 aTexCoords;
 
+// skinning 되는 mesh 의 정점마다 영향을 주는 bone palette 인덱스 및 weight (skinned 가 false 이면 읽지 않음)
+layout(location = 5) in uvec4 aBoneIds;
+layout(location = 6) in vec4 aBoneWeights;
+
+/*
+  양자화된 position 을 복원할 mesh 별 dequantization 변환 (양자화되지 않은 mesh 는 항등 변환이 전달됨)
+
+  -> multi draw indirect 로 여러 mesh 를 한번에 그릴 때는 mesh 마다 uniform 을 바꿀 수 없으므로,
+  per-draw instanced attribute 로 전달받음. (Mesh 를 하나씩 그릴 때는 glVertexAttrib3fv() 로 설정한 상수값이 사용됨)
+*/
+layout(location = 7) in vec3 aPositionScale;
+layout(location = 8) in vec3 aPositionOffset;
+
+/*
+  모델 행렬 앞에 적용할 local transform (mat4 attribute 는 location 4개(9 ~ 12)를 차지함)
+
+  -> hardware instancing 으로 그릴 때는 인스턴스마다 읽어들이는 per-instance 모델 행렬이고,
+  -> 그 외에는 mesh 가 속한 scene graph 노드의 world transform 으로,
+  multi draw indirect 로 그릴 때는 per-draw instanced attribute, Mesh 를 하나씩 그릴 때는 glVertexAttrib4fv() 로 설정한 상수값이 사용됨.
+*/
+layout(location = 9) in mat4 aInstanceModel;
+
+/*
+  aInstanceModel 의 노멀 행렬 (transpose(inverse(mat3(aInstanceModel))), mat3 attribute 는 location 3개(13 ~ 15)를 차지함)
+
+  -> 정점마다 inverse() 를 계산하지 않도록 인스턴스 데이터를 채우거나 노드 및 per-draw transform 이 바뀔 때 CPU 에서 계산되며,
+  aInstanceModel 과 같은 방식(per-instance, per-draw 또는 상수값)으로 전달됨.
+*/
+layout(location = 13) in mat3 aInstanceNormalMatrix;
+
+/*
+  hardware instancing 으로 그릴 때 인스턴스마다 읽어들이는 per-instance Material 파라미터 (INSTANCED_MATERIAL 변형에서만 읽음)
+
+  -> 사용 가능한 location 이 남아있지 않으므로 이 쉐이더가 읽지 않는 tangent, bitangent location 을 사용함. (mesh.hpp 참고)
+*/
+layout(location = 3) in vec4 aInstanceMaterial; // (metallic, roughness, ao, 사용 안함)
+layout(location = 4) in vec3 aInstanceAlbedo;
+
 /* fragment shader 단계로 출력할 출력 변수 선언 */
 out vec2 TexCoords;
 out vec3 WorldPos;
 out vec3 Normal;
 
-/* 변환 행렬을 전송받는 uniform 변수 선언 */ 
+// 인스턴스마다 다를 수 있는 PBR Material 파라미터 (삼각형 내에서는 보간할 필요가 없으므로 flat 으로 전달)
+flat out vec3 MaterialAlbedo;
+flat out float MaterialMetallic;
+flat out float MaterialRoughness;
+flat out float MaterialAo;
 
-// 투영 행렬
-uniform mat4 projection;
+/*
+  카메라 uniform block (FrameUniforms 가 매 프레임 한번 업로드하며, pbr.vs, pbr.fs, background.vs 에서 같은 정의로 공유함)
 
-// 뷰 행렬
-uniform mat4 view;
+  -> GLSL 330 에서는 layout(binding = N) 을 지정할 수 없으므로, Shader::setUniformBlockBinding() 으로 binding point 를 연결함.
+*/
+layout(std140) uniform Camera {
+  mat4 projection;     // 투영 행렬
+  mat4 view;           // 뷰 행렬
+  vec4 cameraPosition; // 카메라 위치 (w 는 사용 안함)
+};
+
+/* 변환 행렬을 전송받는 uniform 변수 선언 */
 
 // 모델 행렬
 uniform mat4 model;
@@ -23,11 +74,68 @@ uniform mat4 model;
 // 노멀 행렬
 uniform mat3 normalMatrix;
 
+// PBR Material 파라미터 값을 전송받는 uniform 변수 선언 (INSTANCED_MATERIAL 이 아닌 변형에서 적용됨)
+#ifndef INSTANCED_MATERIAL
+uniform vec3 albedo;
+uniform float metallic;
+uniform float roughness;
+uniform float ao;
+#endif
+
+/*
+  skinning 에 사용할 bone 별 skinning 행렬 및 그 노멀 행렬 (mesh space 정점을 model space 로 변환, AnimationConstants::MAX_BONES 와 같아야 함)
+
+  -> GLSL 330 에서는 layout(binding = N) 을 지정할 수 없으므로, Shader::setUniformBlockBinding() 으로 binding point 를 연결함.
+*/
+const int MAX_BONES = 128;
+layout(std140) uniform BonePalette {
+  mat4 bones[MAX_BONES];
+  mat3 boneNormals[MAX_BONES]; // CPU 에서 계산된 transpose(inverse(mat3(bones[i])))
+};
+
+// bone palette 로 정점을 skinning 할지 여부
+uniform bool skinned;
+
 void main() {
   // 프래그먼트 쉐이더 단계로 보간하여 출력할 값들을 World Space 로 변환하여 할당
   TexCoords = aTexCoords;
-  WorldPos = vec3(model * vec4(aPos, 1.0));
-  Normal = normalMatrix * aNormal;
+  vec3 localPos = aPos * aPositionScale + aPositionOffset;
+
+  /*
+    skinning 되는 mesh 는 정점에 영향을 주는 bone 들의 skinning 행렬을 weight 로 섞어서 local transform 으로 사용
+
+    -> skinning 행렬에 joint 들의 transform 이 이미 반영되어 있으므로, 이 경우 aInstanceModel 은 단위 행렬이 전달됨.
+    -> bone 이 하나도 연결되지 않은 정점(weight 합이 0)은 skinning 을 적용하지 않음.
+    -> 노멀 행렬도 CPU 에서 bone 마다 계산된 노멀 행렬을 같은 weight 로 섞어서 사용함.
+  */
+  mat4 localTransform = aInstanceModel;
+  mat3 localNormalMatrix = aInstanceNormalMatrix;
+  if (skinned && dot(aBoneWeights, vec4(1.0)) > 0.0) {
+    localTransform = bones[aBoneIds.x] * aBoneWeights.x
+                   + bones[aBoneIds.y] * aBoneWeights.y
+                   + bones[aBoneIds.z] * aBoneWeights.z
+                   + bones[aBoneIds.w] * aBoneWeights.w;
+    localNormalMatrix = boneNormals[aBoneIds.x] * aBoneWeights.x
+                      + boneNormals[aBoneIds.y] * aBoneWeights.y
+                      + boneNormals[aBoneIds.z] * aBoneWeights.z
+                      + boneNormals[aBoneIds.w] * aBoneWeights.w;
+  }
+
+  // local transform 을 공통 모델 행렬 앞에 적용하고, 노멀 행렬도 local transform 의 노멀 행렬을 반영
+  WorldPos = vec3(model * localTransform * vec4(localPos, 1.0));
+  Normal = normalMatrix * (localNormalMatrix * aNormal);
+
+#ifdef INSTANCED_MATERIAL
+  MaterialAlbedo = aInstanceAlbedo;
+  MaterialMetallic = aInstanceMaterial.x;
+  MaterialRoughness = aInstanceMaterial.y;
+  MaterialAo = aInstanceMaterial.z;
+#else
+  MaterialAlbedo = albedo;
+  MaterialMetallic = metallic;
+  MaterialRoughness = roughness;
+  MaterialAo = ao;
+#endif
 
   // World Space 좌표에 뷰 행렬 > 투영 행렬 순으로 곱해서 좌표계를 변환시킴.
   gl_Position = projection * view * vec4(WorldPos, 1.0);
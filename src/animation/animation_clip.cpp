@@ -0,0 +1,169 @@
+#include "animation/animation_clip.hpp"
+#include "constants/animation_constants.hpp"
+
+#include <assimp/scene.h>
+#include <algorithm>
+
+namespace
+{
+  /*
+    times 에서 time 을 감싸는 두 키프레임 위치(cursor, cursor + 1)를 찾고 그 사이의 보간 비율을 반환
+
+    -> 이전 프레임에서 사용한 cursor 부터 앞으로만 찾으므로 대부분 한두 번의 비교로 끝나고,
+    시간이 되감긴 경우(clip 반복 등)에만 처음부터 다시 찾음.
+    -> 키프레임이 하나뿐이면 보간 비율 0 으로 첫 번째 키프레임을 사용함.
+  */
+  float findKeyframes(const std::vector<float> &times, float time, size_t &cursor)
+  {
+    if (times.size() < 2)
+    {
+      cursor = 0;
+      return 0.0f;
+    }
+
+    if (cursor + 1 >= times.size() || times[cursor] > time)
+    {
+      cursor = 0;
+    }
+
+    while (cursor + 2 < times.size() && times[cursor + 1] <= time)
+    {
+      cursor++;
+    }
+
+    const float span = times[cursor + 1] - times[cursor];
+    return span > 0.0f ? std::clamp((time - times[cursor]) / span, 0.0f, 1.0f) : 0.0f;
+  }
+} // namespace
+
+AnimationClip::AnimationClip(const aiAnimation *animation, const Skeleton &skeleton)
+    : name(animation->mName.C_Str())
+{
+  // 키프레임 시간은 tick 단위로 저장되어 있으므로 초 단위로 변환
+  const float ticksPerSecond = animation->mTicksPerSecond > 0.0 ? static_cast<float>(animation->mTicksPerSecond) : AnimationConstants::DEFAULT_TICKS_PER_SECOND;
+  duration = static_cast<float>(animation->mDuration) / ticksPerSecond;
+
+  channels.reserve(animation->mNumChannels);
+  for (unsigned int i = 0; i < animation->mNumChannels; i++)
+  {
+    const aiNodeAnim *nodeAnim = animation->mChannels[i];
+
+    const int joint = skeleton.findJoint(nodeAnim->mNodeName.C_Str());
+    if (joint < 0)
+    {
+      continue;
+    }
+
+    JointChannel channel;
+    channel.joint = joint;
+
+    channel.translationTimes.reserve(nodeAnim->mNumPositionKeys);
+    channel.translations.reserve(nodeAnim->mNumPositionKeys);
+    for (unsigned int k = 0; k < nodeAnim->mNumPositionKeys; k++)
+    {
+      const aiVectorKey &key = nodeAnim->mPositionKeys[k];
+      channel.translationTimes.push_back(static_cast<float>(key.mTime) / ticksPerSecond);
+      channel.translations.push_back(glm::vec3(key.mValue.x, key.mValue.y, key.mValue.z));
+    }
+
+    // aiQuaternion 과 glm::quat 생성자는 모두 (w, x, y, z) 순서
+    channel.rotationTimes.reserve(nodeAnim->mNumRotationKeys);
+    channel.rotations.reserve(nodeAnim->mNumRotationKeys);
+    for (unsigned int k = 0; k < nodeAnim->mNumRotationKeys; k++)
+    {
+      const aiQuatKey &key = nodeAnim->mRotationKeys[k];
+      channel.rotationTimes.push_back(static_cast<float>(key.mTime) / ticksPerSecond);
+      channel.rotations.push_back(glm::quat(key.mValue.w, key.mValue.x, key.mValue.y, key.mValue.z));
+    }
+
+    channel.scaleTimes.reserve(nodeAnim->mNumScalingKeys);
+    channel.scales.reserve(nodeAnim->mNumScalingKeys);
+    for (unsigned int k = 0; k < nodeAnim->mNumScalingKeys; k++)
+    {
+      const aiVectorKey &key = nodeAnim->mScalingKeys[k];
+      channel.scaleTimes.push_back(static_cast<float>(key.mTime) / ticksPerSecond);
+      channel.scales.push_back(glm::vec3(key.mValue.x, key.mValue.y, key.mValue.z));
+    }
+
+    channels.push_back(std::move(channel));
+  }
+}
+
+void AnimationClip::resetSampler(const Skeleton &skeleton, AnimationSampler &sampler) const
+{
+  // 배열 크기가 같으면 assign() 은 재할당 없이 값만 복사하므로, clip 전환 시에도 heap 할당이 발생하지 않음
+  sampler.from = skeleton.getBindPose();
+  sampler.to = skeleton.getBindPose();
+  sampler.weights.resize(skeleton.getBindPose().paddedSize());
+
+  sampler.translationCursors.assign(channels.size(), 0);
+  sampler.rotationCursors.assign(channels.size(), 0);
+  sampler.scaleCursors.assign(channels.size(), 0);
+}
+
+void AnimationClip::sample(float time, AnimationSampler &sampler) const
+{
+  for (size_t i = 0; i < channels.size(); i++)
+  {
+    const JointChannel &channel = channels[i];
+    const size_t joint = static_cast<size_t>(channel.joint);
+
+    // 성분마다 키프레임 쌍을 찾아 from, to 에 기록 (키프레임이 없는 성분은 bind pose 값을 유지)
+    if (!channel.translations.empty())
+    {
+      size_t &cursor = sampler.translationCursors[i];
+      sampler.weights.translation[joint] = findKeyframes(channel.translationTimes, time, cursor);
+
+      const glm::vec3 &from = channel.translations[cursor];
+      const glm::vec3 &to = channel.translations[std::min(cursor + 1, channel.translations.size() - 1)];
+      sampler.from.translationX[joint] = from.x;
+      sampler.from.translationY[joint] = from.y;
+      sampler.from.translationZ[joint] = from.z;
+      sampler.to.translationX[joint] = to.x;
+      sampler.to.translationY[joint] = to.y;
+      sampler.to.translationZ[joint] = to.z;
+    }
+
+    if (!channel.rotations.empty())
+    {
+      size_t &cursor = sampler.rotationCursors[i];
+      sampler.weights.rotation[joint] = findKeyframes(channel.rotationTimes, time, cursor);
+
+      const glm::quat &from = channel.rotations[cursor];
+      const glm::quat &to = channel.rotations[std::min(cursor + 1, channel.rotations.size() - 1)];
+      sampler.from.rotationX[joint] = from.x;
+      sampler.from.rotationY[joint] = from.y;
+      sampler.from.rotationZ[joint] = from.z;
+      sampler.from.rotationW[joint] = from.w;
+      sampler.to.rotationX[joint] = to.x;
+      sampler.to.rotationY[joint] = to.y;
+      sampler.to.rotationZ[joint] = to.z;
+      sampler.to.rotationW[joint] = to.w;
+    }
+
+    if (!channel.scales.empty())
+    {
+      size_t &cursor = sampler.scaleCursors[i];
+      sampler.weights.scale[joint] = findKeyframes(channel.scaleTimes, time, cursor);
+
+      const glm::vec3 &from = channel.scales[cursor];
+      const glm::vec3 &to = channel.scales[std::min(cursor + 1, channel.scales.size() - 1)];
+      sampler.from.scaleX[joint] = from.x;
+      sampler.from.scaleY[joint] = from.y;
+      sampler.from.scaleZ[joint] = from.z;
+      sampler.to.scaleX[joint] = to.x;
+      sampler.to.scaleY[joint] = to.y;
+      sampler.to.scaleZ[joint] = to.z;
+    }
+  }
+}
+
+const std::string &AnimationClip::getName() const
+{
+  return name;
+}
+
+float AnimationClip::getDuration() const
+{
+  return duration;
+}
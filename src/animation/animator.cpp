@@ -0,0 +1,121 @@
+#include "animation/animator.hpp"
+
+#include <cmath>
+#include <utility>
+#include <algorithm>
+
+Animator::Animator(const Skeleton &skeleton, const std::vector<AnimationClip> &clips)
+    : skeleton(skeleton), clips(clips)
+{
+  pose = skeleton.getBindPose();
+  current.pose = skeleton.getBindPose();
+  previous.pose = skeleton.getBindPose();
+  jointTransforms.resize(skeleton.getJointCount());
+  bonePalette.resize(skeleton.getBoneCount(), glm::mat4(1.0f));
+  boneNormalPalette.resize(skeleton.getBoneCount(), glm::mat3x4(1.0f));
+
+  if (!clips.empty())
+  {
+    clips[0].resetSampler(skeleton, current.sampler);
+    clips[0].resetSampler(skeleton, previous.sampler);
+  }
+}
+
+void Animator::play(size_t clipIndex, float fadeDuration)
+{
+  if (clipIndex >= clips.size())
+  {
+    return;
+  }
+
+  // 현재 layer 를 이전 layer 로 넘겨서 cross-fade 가 끝날 때까지 계속 샘플링함 (배열을 교환하므로 재할당이 없음)
+  std::swap(previous, current);
+  fading = fadeDuration > 0.0f;
+  this->fadeDuration = fadeDuration;
+  fadeTime = 0.0f;
+
+  current.clip = clipIndex;
+  current.time = 0.0f;
+  clips[clipIndex].resetSampler(skeleton, current.sampler);
+}
+
+size_t Animator::update(float deltaTime)
+{
+  size_t processedJointCount = skeleton.getJointCount();
+
+  if (clips.empty())
+  {
+    // 재생할 clip 이 없으면 bind pose 그대로 palette 계산
+    pose = skeleton.getBindPose();
+  }
+  else
+  {
+    sampleLayer(current, deltaTime);
+
+    if (fading)
+    {
+      sampleLayer(previous, deltaTime);
+      processedJointCount += skeleton.getJointCount();
+
+      // 이전 clip 의 포즈에서 현재 clip 의 포즈로 fadeDuration 동안 선형으로 비율을 늘려가며 섞음
+      fadeTime += deltaTime;
+      const float weight = std::min(fadeTime / fadeDuration, 1.0f);
+      PoseBlending::blend(previous.pose, current.pose, weight, pose);
+      fading = weight < 1.0f;
+    }
+    else
+    {
+      pose = current.pose;
+    }
+  }
+
+  PoseBlending::computeModelTransforms(skeleton.getParents(), pose, jointTransforms);
+
+  // joint 의 model space transform 에 inverse bind matrix 를 곱하여 mesh space 정점을 변환할 skinning 행렬 생성
+  const std::vector<int> &boneJoints = skeleton.getBoneJoints();
+  const std::vector<glm::mat4> &boneOffsets = skeleton.getBoneOffsets();
+  for (size_t bone = 0; bone < bonePalette.size(); bone++)
+  {
+    bonePalette[bone] = jointTransforms[boneJoints[bone]] * boneOffsets[bone];
+
+    // joint 에 non-uniform scale 이 있어도 노멀이 올바르게 변환되도록 skinning 행렬의 역전치 행렬을 bone 마다 한번만 계산
+    boneNormalPalette[bone] = glm::mat3x4(glm::transpose(glm::inverse(glm::mat3(bonePalette[bone]))));
+  }
+
+  return processedJointCount;
+}
+
+const std::vector<glm::mat4> &Animator::getBonePalette() const
+{
+  return bonePalette;
+}
+
+const std::vector<glm::mat3x4> &Animator::getBoneNormalPalette() const
+{
+  return boneNormalPalette;
+}
+
+size_t Animator::getClipCount() const
+{
+  return clips.size();
+}
+
+size_t Animator::getCurrentClip() const
+{
+  return current.clip;
+}
+
+void Animator::sampleLayer(Layer &layer, float deltaTime)
+{
+  const AnimationClip &clip = clips[layer.clip];
+
+  // clip 끝에 도달하면 처음부터 반복 재생
+  layer.time += deltaTime;
+  if (clip.getDuration() > 0.0f)
+  {
+    layer.time = std::fmod(layer.time, clip.getDuration());
+  }
+
+  clip.sample(layer.time, layer.sampler);
+  PoseBlending::interpolate(layer.sampler.from, layer.sampler.to, layer.sampler.weights, layer.pose);
+}
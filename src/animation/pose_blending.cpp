@@ -0,0 +1,171 @@
+#include "animation/pose_blending.hpp"
+
+#include <cmath>
+
+// x86 계열에서 SSE2 명령어를 사용할 수 있으면 SIMD 경로로 컴파일
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define POSE_BLENDING_USE_SSE 1
+#include <emmintrin.h>
+#else
+#define POSE_BLENDING_USE_SSE 0
+#endif
+
+void JointBlendWeights::resize(size_t paddedSize)
+{
+  translation.assign(paddedSize, 0.0f);
+  rotation.assign(paddedSize, 0.0f);
+  scale.assign(paddedSize, 0.0f);
+}
+
+namespace
+{
+  // joint 마다 성분별 비율 배열에서 보간 비율을 읽음 (component 0 : translation, 1 : rotation, 2 : scale)
+  struct PerJointWeights
+  {
+    const float *components[3];
+
+    float scalar(int component, size_t i) const
+    {
+      return components[component][i];
+    }
+
+#if POSE_BLENDING_USE_SSE
+    __m128 vector(int component, size_t i) const
+    {
+      return _mm_loadu_ps(&components[component][i]);
+    }
+#endif
+  };
+
+  // 모든 joint 와 성분에 같은 비율을 사용
+  struct UniformWeight
+  {
+    float weight;
+
+    float scalar(int, size_t) const
+    {
+      return weight;
+    }
+
+#if POSE_BLENDING_USE_SSE
+    __m128 vector(int, size_t) const
+    {
+      return _mm_set1_ps(weight);
+    }
+#endif
+  };
+
+  // 보간 비율을 읽어오는 방식(WeightSource)만 다른 interpolate(), blend() 의 공통 구현
+  template <typename WeightSource>
+  void blendPoses(const JointPose &from, const JointPose &to, const WeightSource &weights, JointPose &out)
+  {
+    const size_t count = from.paddedSize();
+    size_t i = 0;
+
+#if POSE_BLENDING_USE_SSE
+    // joint 4개씩 묶어서 처리 (JointPose 배열은 4의 배수 크기로 할당되어 있으므로 나머지 joint 가 남지 않음)
+    const __m128 signBit = _mm_set1_ps(-0.0f);
+    for (; i + 4 <= count; i += 4)
+    {
+      // translation, scale 선형 보간 : from + (to - from) * t
+      const __m128 tw = weights.vector(0, i);
+      _mm_storeu_ps(&out.translationX[i], _mm_add_ps(_mm_loadu_ps(&from.translationX[i]), _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&to.translationX[i]), _mm_loadu_ps(&from.translationX[i])), tw)));
+      _mm_storeu_ps(&out.translationY[i], _mm_add_ps(_mm_loadu_ps(&from.translationY[i]), _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&to.translationY[i]), _mm_loadu_ps(&from.translationY[i])), tw)));
+      _mm_storeu_ps(&out.translationZ[i], _mm_add_ps(_mm_loadu_ps(&from.translationZ[i]), _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&to.translationZ[i]), _mm_loadu_ps(&from.translationZ[i])), tw)));
+
+      const __m128 sw = weights.vector(2, i);
+      _mm_storeu_ps(&out.scaleX[i], _mm_add_ps(_mm_loadu_ps(&from.scaleX[i]), _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&to.scaleX[i]), _mm_loadu_ps(&from.scaleX[i])), sw)));
+      _mm_storeu_ps(&out.scaleY[i], _mm_add_ps(_mm_loadu_ps(&from.scaleY[i]), _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&to.scaleY[i]), _mm_loadu_ps(&from.scaleY[i])), sw)));
+      _mm_storeu_ps(&out.scaleZ[i], _mm_add_ps(_mm_loadu_ps(&from.scaleZ[i]), _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&to.scaleZ[i]), _mm_loadu_ps(&from.scaleZ[i])), sw)));
+
+      /*
+        rotation nlerp
+
+        -> q 와 -q 는 같은 회전이므로, 두 quaternion 의 내적이 음수이면 to 의 부호를 뒤집어 짧은 경로로 보간함.
+        (내적의 부호 비트만 추출하여 to 의 각 성분과 xor 하면 분기 없이 lane 별로 부호를 뒤집을 수 있음)
+      */
+      const __m128 ax = _mm_loadu_ps(&from.rotationX[i]);
+      const __m128 ay = _mm_loadu_ps(&from.rotationY[i]);
+      const __m128 az = _mm_loadu_ps(&from.rotationZ[i]);
+      const __m128 aw = _mm_loadu_ps(&from.rotationW[i]);
+      __m128 bx = _mm_loadu_ps(&to.rotationX[i]);
+      __m128 by = _mm_loadu_ps(&to.rotationY[i]);
+      __m128 bz = _mm_loadu_ps(&to.rotationZ[i]);
+      __m128 bw = _mm_loadu_ps(&to.rotationW[i]);
+
+      const __m128 dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)), _mm_add_ps(_mm_mul_ps(az, bz), _mm_mul_ps(aw, bw)));
+      const __m128 flip = _mm_and_ps(dot, signBit);
+      bx = _mm_xor_ps(bx, flip);
+      by = _mm_xor_ps(by, flip);
+      bz = _mm_xor_ps(bz, flip);
+      bw = _mm_xor_ps(bw, flip);
+
+      const __m128 rw = weights.vector(1, i);
+      const __m128 rx = _mm_add_ps(ax, _mm_mul_ps(_mm_sub_ps(bx, ax), rw));
+      const __m128 ry = _mm_add_ps(ay, _mm_mul_ps(_mm_sub_ps(by, ay), rw));
+      const __m128 rz = _mm_add_ps(az, _mm_mul_ps(_mm_sub_ps(bz, az), rw));
+      const __m128 rq = _mm_add_ps(aw, _mm_mul_ps(_mm_sub_ps(bw, aw), rw));
+
+      // 같은 방향(부호 보정 후)의 단위 quaternion 사이를 보간하므로 길이가 0 이 되지 않음
+      const __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(rx, rx), _mm_mul_ps(ry, ry)), _mm_add_ps(_mm_mul_ps(rz, rz), _mm_mul_ps(rq, rq))));
+      _mm_storeu_ps(&out.rotationX[i], _mm_div_ps(rx, length));
+      _mm_storeu_ps(&out.rotationY[i], _mm_div_ps(ry, length));
+      _mm_storeu_ps(&out.rotationZ[i], _mm_div_ps(rz, length));
+      _mm_storeu_ps(&out.rotationW[i], _mm_div_ps(rq, length));
+    }
+#endif
+
+    // SSE 미지원 환경에서는 모든 joint 를 scalar 로 처리
+    for (; i < count; i++)
+    {
+      const float tw = weights.scalar(0, i);
+      out.translationX[i] = from.translationX[i] + (to.translationX[i] - from.translationX[i]) * tw;
+      out.translationY[i] = from.translationY[i] + (to.translationY[i] - from.translationY[i]) * tw;
+      out.translationZ[i] = from.translationZ[i] + (to.translationZ[i] - from.translationZ[i]) * tw;
+
+      const float sw = weights.scalar(2, i);
+      out.scaleX[i] = from.scaleX[i] + (to.scaleX[i] - from.scaleX[i]) * sw;
+      out.scaleY[i] = from.scaleY[i] + (to.scaleY[i] - from.scaleY[i]) * sw;
+      out.scaleZ[i] = from.scaleZ[i] + (to.scaleZ[i] - from.scaleZ[i]) * sw;
+
+      const float dot = from.rotationX[i] * to.rotationX[i] + from.rotationY[i] * to.rotationY[i] + from.rotationZ[i] * to.rotationZ[i] + from.rotationW[i] * to.rotationW[i];
+      const float sign = dot < 0.0f ? -1.0f : 1.0f;
+      const float rw = weights.scalar(1, i);
+      const float rx = from.rotationX[i] + (to.rotationX[i] * sign - from.rotationX[i]) * rw;
+      const float ry = from.rotationY[i] + (to.rotationY[i] * sign - from.rotationY[i]) * rw;
+      const float rz = from.rotationZ[i] + (to.rotationZ[i] * sign - from.rotationZ[i]) * rw;
+      const float rq = from.rotationW[i] + (to.rotationW[i] * sign - from.rotationW[i]) * rw;
+
+      const float length = std::sqrt(rx * rx + ry * ry + rz * rz + rq * rq);
+      out.rotationX[i] = rx / length;
+      out.rotationY[i] = ry / length;
+      out.rotationZ[i] = rz / length;
+      out.rotationW[i] = rq / length;
+    }
+  }
+} // namespace
+
+namespace PoseBlending
+{
+  void interpolate(const JointPose &from, const JointPose &to, const JointBlendWeights &weights, JointPose &out)
+  {
+    blendPoses(from, to, PerJointWeights{{weights.translation.data(), weights.rotation.data(), weights.scale.data()}}, out);
+  }
+
+  void blend(const JointPose &from, const JointPose &to, float weight, JointPose &out)
+  {
+    blendPoses(from, to, UniformWeight{weight}, out);
+  }
+
+  void computeModelTransforms(const std::vector<int> &parents, const JointPose &pose, std::vector<glm::mat4> &transforms)
+  {
+    transforms.resize(pose.size());
+
+    // 부모 joint 가 항상 앞에 있으므로 앞에서부터 순회하면 부모의 model space transform 이 먼저 계산되어 있음
+    for (size_t joint = 0; joint < pose.size(); joint++)
+    {
+      const glm::mat4 local = pose.getMatrix(joint);
+      transforms[joint] = parents[joint] >= 0 ? transforms[parents[joint]] * local : local;
+    }
+  }
+} // namespace PoseBlending
@@ -0,0 +1,147 @@
+#include "animation/skeleton.hpp"
+
+void JointPose::resize(size_t jointCount)
+{
+  this->jointCount = jointCount;
+
+  // SIMD 처리 단위(4)의 배수로 올려서 할당하고, 모든 lane 을 항등 변환으로 초기화
+  const size_t padded = (jointCount + 3) & ~size_t(3);
+  translationX.assign(padded, 0.0f);
+  translationY.assign(padded, 0.0f);
+  translationZ.assign(padded, 0.0f);
+  rotationX.assign(padded, 0.0f);
+  rotationY.assign(padded, 0.0f);
+  rotationZ.assign(padded, 0.0f);
+  rotationW.assign(padded, 1.0f);
+  scaleX.assign(padded, 1.0f);
+  scaleY.assign(padded, 1.0f);
+  scaleZ.assign(padded, 1.0f);
+}
+
+void JointPose::set(size_t joint, const glm::vec3 &translation, const glm::quat &rotation, const glm::vec3 &scale)
+{
+  translationX[joint] = translation.x;
+  translationY[joint] = translation.y;
+  translationZ[joint] = translation.z;
+  rotationX[joint] = rotation.x;
+  rotationY[joint] = rotation.y;
+  rotationZ[joint] = rotation.z;
+  rotationW[joint] = rotation.w;
+  scaleX[joint] = scale.x;
+  scaleY[joint] = scale.y;
+  scaleZ[joint] = scale.z;
+}
+
+glm::mat4 JointPose::getMatrix(size_t joint) const
+{
+  // glm::quat 생성자는 (w, x, y, z) 순서로 성분을 전달받음
+  const glm::quat rotation(rotationW[joint], rotationX[joint], rotationY[joint], rotationZ[joint]);
+  glm::mat4 matrix = glm::mat4_cast(rotation);
+
+  // 회전 행렬의 각 열(column)에 scale 을 곱하고, 마지막 열에 translation 을 기록
+  matrix[0] *= scaleX[joint];
+  matrix[1] *= scaleY[joint];
+  matrix[2] *= scaleZ[joint];
+  matrix[3] = glm::vec4(translationX[joint], translationY[joint], translationZ[joint], 1.0f);
+  return matrix;
+}
+
+size_t JointPose::size() const
+{
+  return jointCount;
+}
+
+size_t JointPose::paddedSize() const
+{
+  return translationX.size();
+}
+
+void Skeleton::build(const SceneGraph &sceneGraph)
+{
+  const size_t jointCount = sceneGraph.getNodeCount();
+  parents.resize(jointCount);
+  bindPose.resize(jointCount);
+  jointIndices.clear();
+
+  for (size_t joint = 0; joint < jointCount; joint++)
+  {
+    parents[joint] = sceneGraph.getParent(static_cast<int>(joint));
+    jointIndices.emplace(sceneGraph.getName(static_cast<int>(joint)), static_cast<int>(joint));
+
+    /*
+      노드의 local transform 을 translation, rotation, scale 로 분해
+
+      -> 각 열(column)의 길이가 scale 이고, scale 로 나눈 3x3 부분이 회전 행렬이 됨.
+      (shear 가 포함된 변환은 정확히 분해되지 않지만, 3D 모델 파일의 노드 transform 은 대부분 TRS 로 구성됨)
+    */
+    const glm::mat4 &local = sceneGraph.getLocalTransform(static_cast<int>(joint));
+    const glm::vec3 translation(local[3]);
+    const glm::vec3 scale(glm::length(glm::vec3(local[0])), glm::length(glm::vec3(local[1])), glm::length(glm::vec3(local[2])));
+
+    glm::mat3 rotationMatrix(glm::vec3(local[0]) / scale.x, glm::vec3(local[1]) / scale.y, glm::vec3(local[2]) / scale.z);
+    bindPose.set(joint, translation, glm::normalize(glm::quat_cast(rotationMatrix)), scale);
+  }
+}
+
+int Skeleton::addBone(const std::string &name, const glm::mat4 &offsetMatrix)
+{
+  auto found = boneIndices.find(name);
+  if (found != boneIndices.end())
+  {
+    return found->second;
+  }
+
+  const int joint = findJoint(name);
+  if (joint < 0)
+  {
+    return -1;
+  }
+
+  const int bone = static_cast<int>(boneJoints.size());
+  boneJoints.push_back(joint);
+  boneOffsets.push_back(offsetMatrix);
+  boneIndices.emplace(name, bone);
+  return bone;
+}
+
+int Skeleton::findBone(const std::string &name) const
+{
+  auto found = boneIndices.find(name);
+  return found != boneIndices.end() ? found->second : -1;
+}
+
+int Skeleton::findJoint(const std::string &name) const
+{
+  auto found = jointIndices.find(name);
+  return found != jointIndices.end() ? found->second : -1;
+}
+
+size_t Skeleton::getJointCount() const
+{
+  return parents.size();
+}
+
+size_t Skeleton::getBoneCount() const
+{
+  return boneJoints.size();
+}
+
+const std::vector<int> &Skeleton::getParents() const
+{
+  return parents;
+}
+
+const JointPose &Skeleton::getBindPose() const
+{
+  return bindPose;
+}
+
+const std::vector<int> &Skeleton::getBoneJoints() const
+{
+  return boneJoints;
+}
+
+const std::vector<glm::mat4> &Skeleton::getBoneOffsets() const
+{
+  return boneOffsets;
+}
@@ -1,7 +1,17 @@
 #include "app/app.hpp"
+#include "common/allocation_counter.hpp"
+#include "common/gl_call_counter.hpp"
+#include "gl_context/gl_extensions.hpp"
+#include <spdlog/spdlog.h>
+#include <chrono>
 
-App::App() : pbrShader(nullptr)
+App::App()
+    : constructionStart(std::chrono::steady_clock::now()),
+      backgroundShader(std::make_shared<Shader>("background.vs", "background.fs")),
+      startupTimeMs(0.0f),
+      startupGLCallCount(0)
 {
+  renderStats.reset();
 }
 
 App::~App()
@@ -13,6 +23,8 @@ App::~App()
   offscreenRenderingFeature.finalize();
   iblFeature.finalize();
   modelFeature.finalize();
+  instancingFeature.finalize();
+  streamingFeature.finalize();
 }
 
 void App::initialize()
@@ -20,17 +32,80 @@ void App::initialize()
   initializeShaders();
   initializeFeatures();
   initializeControllers();
+
+  /*
+    시작 시간 및 쉐이더 프로그램 생성 방식 기록
+
+    -> 한 프로그램이라도 소스로부터 컴파일했으면 cold start, 모두 캐시된 바이너리로 생성했으면 warm start.
+    -> 컴파일한 프로그램은 main 스레드가 붙잡혀 있던 시간 중 링크 결과를 기다린 시간과,
+    제출 후 결과를 조회하기까지 다른 초기화 작업과 겹쳐서 진행된 시간을 함께 기록함.
+  */
+  startupTimeMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - constructionStart).count();
+  startupProgramStats = ProgramBinaryCache::getInstance().getStats();
+  spdlog::info("Startup ({}) : {:.1f} ms, shader programs {} cached ({:.1f} ms), {} compiled ({:.1f} ms, {:.1f} ms waiting for link, {:.1f} ms overlapped), {} invalid",
+               startupProgramStats.compiledCount > 0 ? "cold" : "warm",
+               startupTimeMs,
+               startupProgramStats.loadedCount,
+               startupProgramStats.loadTimeMs,
+               startupProgramStats.compiledCount,
+               startupProgramStats.compileTimeMs,
+               startupProgramStats.linkWaitTimeMs,
+               startupProgramStats.overlapTimeMs,
+               startupProgramStats.invalidCount);
+
+  // App 생성 이전에는 래퍼 클래스로 GL 객체를 생성하지 않으므로, 지금까지의 호출 횟수가 곧 시작 시의 호출 횟수임
+  startupGLCallCount = GLCallCounter::getCount();
+  spdlog::info("Startup GL calls ({}) : {}", GLExtensions::hasDirectStateAccess() ? "direct state access" : "bind / unbind", startupGLCallCount);
 }
 
 void App::process()
 {
-  /* 각 Feature 클래스들의 렌더링 루프 작업 수행 */
-  materialFeature.process();
+  // 이번 프레임에서 집계할 프로파일링 통계 초기화
+  renderStats.reset();
+  renderStats.startupTimeMs = startupTimeMs;
+  renderStats.startupProgramLoadedCount = startupProgramStats.loadedCount;
+  renderStats.startupProgramCompiledCount = startupProgramStats.compiledCount;
+  renderStats.startupProgramLoadTimeMs = startupProgramStats.loadTimeMs;
+  renderStats.startupProgramCompileTimeMs = startupProgramStats.compileTimeMs;
+  renderStats.startupProgramLinkWaitTimeMs = startupProgramStats.linkWaitTimeMs;
+  renderStats.startupProgramOverlapTimeMs = startupProgramStats.overlapTimeMs;
+  renderStats.startupGLCallCount = static_cast<unsigned int>(startupGLCallCount);
+  renderStats.directStateAccess = GLExtensions::hasDirectStateAccess();
+
+  // 렌더링 루프에서 발생하는 heap 할당 및 GL 호출 횟수를 집계하기 위해 시작 시점의 횟수 기록
+  const size_t allocationCountBefore = AllocationCounter::getCount();
+  const size_t glCallCountBefore = GLCallCounter::getCount();
+
+  // 쉐이더 소스가 바뀌었으면 다시 컴파일하고, 링크가 끝난 쉐이더는 이번 프레임을 그리기 전에 교체
+  reloadShaders();
+
+  // 이전 프레임들에서 측정된 pbr 쉐이더 변형별 GPU 처리 시간 수집
+  pbrShaders.getCache().beginFrame();
+
+  /*
+    각 Feature 클래스들의 렌더링 루프 작업 수행
+
+    -> LightFeature 가 켜진 광원 개수로 이번 프레임의 pbr 쉐이더 변형을 결정하므로,
+    변형에 material uniform 을 전송하는 MaterialFeature 보다 먼저 처리함.
+  */
   cameraFeature.process();
   lightFeature.process();
+  materialFeature.process();
+
+  // 카메라 및 광원 Feature 가 기록한 uniform block 들을 그리기 전에 한번에 업로드 (IBL block 은 파라미터 setter 에서 기록됨)
+  frameUniforms.upload();
+
   offscreenRenderingFeature.process();
   iblFeature.process();
   modelFeature.process();
+  instancingFeature.process();
+  streamingFeature.process();
+
+  // 생성된 pbr 쉐이더 변형별 GPU 처리 시간 집계
+  pbrShaders.getCache().getVariantStats(renderStats.shaderVariants);
+
+  renderStats.heapAllocationCount = static_cast<unsigned int>(AllocationCounter::getCount() - allocationCountBefore);
+  renderStats.glCallCount = static_cast<unsigned int>(GLCallCounter::getCount() - glCallCountBefore);
 }
 
 Controller<MaterialParameter> &App::getMaterialController()
@@ -58,15 +133,81 @@ Controller<ModelParameter> &App::getModelController()
   return modelController;
 }
 
+Controller<InstancingParameter> &App::getInstancingController()
+{
+  return instancingController;
+}
+
+Controller<StreamingParameter> &App::getStreamingController()
+{
+  return streamingController;
+}
+
+void App::pickModel(float x, float y)
+{
+  modelFeature.pick(x, y);
+}
+
+const RenderStats &App::getRenderStats() const
+{
+  return renderStats;
+}
+
 void App::initializeShaders()
 {
-  /* PBR 구현에 필요한 쉐이더 객체 생성 및 컴파일 */
+  /*
+    PBR 구현에 필요한 쉐이더 객체 초기화
+
+    -> skybox 를 렌더링하는 backgroundShader 및 기본 설정의 pbr 쉐이더 변형들은 App 생성 시 컴파일 및 링크를 제출해두었으므로,
+    Feature 생성자의 초기화 작업이 끝난 지금 처음으로 링크 결과를 조회함.
+  */
+
+  // 두 쉐이더의 Camera, Lights, IBL uniform block 을 FrameUniforms 의 UBO 영역이 연결된 binding point 에 연결 (pbr 쉐이더는 변형이 생성될 때마다 연결)
+  frameUniforms.initialize();
+  frameUniforms.attachShader(*backgroundShader);
+  pbrShaders.getCache().addProgramInitializer([this](Shader &pbrShader)
+                                              { frameUniforms.attachShader(pbrShader); });
+
+  /*
+    구체 및 모델 렌더링 시 적용할 PBR 쉐이더 변형 중 제출해둔 기본 설정 변형들에 초기화 함수 적용
+
+    -> 나머지 조합은 Feature 파라미터가 바뀌어 처음 요청될 때 컴파일됨.
+  */
+  pbrShaders.acquire(false);
+  pbrShaders.acquire(true);
+
+  // 실행 중에 override 디렉토리의 쉐이더 소스를 수정하면 재시작하지 않고 반영되도록 디렉토리 감시 시작
+  if (ShaderConstants::SOURCE_OVERRIDE_ENABLED && ShaderConstants::HOT_RELOAD_ENABLED)
+  {
+    shaderWatcher.watch(ShaderConstants::SHADER_SOURCE_DIRECTORY);
+  }
+}
+
+void App::reloadShaders()
+{
+  changedShaderFiles.clear();
+  shaderWatcher.poll(changedShaderFiles);
+
+  /*
+    변경된 파일을 소스로 사용하는 쉐이더들의 reload 만 제출
 
-  // 구체 렌더링 시 적용할 PBR 쉐이더 객체 생성
-  pbrShader = std::make_shared<Shader>("resources/shaders/pbr.vs", "resources/shaders/pbr.fs");
+    -> 새 프로그램은 드라이버에서 컴파일되는 동안 기존 프로그램으로 계속 그리고, 링크에 성공한 경우에만 교체됨.
+    -> offscreen rendering 쉐이더들은 OffscreenRenderingFeature::process() 에서 교체 후 필요한 텍스쳐 버퍼만 다시 렌더링함.
+  */
+  for (const std::string &fileName : changedShaderFiles)
+  {
+    spdlog::info("Shader source changed : {}", fileName);
 
-  // 배경에 적용할 skybox 를 렌더링하는 쉐이더 객체 생성
-  backgroundShader = std::make_shared<Shader>("resources/shaders/background.vs", "resources/shaders/background.fs");
+    pbrShaders.getCache().beginReload(fileName);
+    if (backgroundShader->usesSource(fileName))
+    {
+      backgroundShader->beginReload();
+    }
+    offscreenRenderingFeature.beginShaderReload(fileName);
+  }
+
+  pbrShaders.getCache().pollReloads();
+  backgroundShader->pollReload();
 }
 
 void App::initializeFeatures()
@@ -74,32 +215,46 @@ void App::initializeFeatures()
   /* Feature 객체 초기화 */
 
   // materialFeature 초기화
-  materialFeature.setPbrShader(pbrShader);
+  materialFeature.setPbrShaders(&pbrShaders);
   materialFeature.initialize();
 
   // cameraFeature 초기화
-  cameraFeature.setPbrShader(pbrShader);
-  cameraFeature.setBackgroundShader(backgroundShader);
+  cameraFeature.setFrameUniforms(&frameUniforms);
   cameraFeature.initialize();
 
   // lightFeature 초기화
-  lightFeature.setPbrShader(pbrShader);
+  lightFeature.setFrameUniforms(&frameUniforms);
+  lightFeature.setPbrShaders(&pbrShaders);
   lightFeature.initialize();
 
   // offscreenRenderingFeature 초기화
-  offscreenRenderingFeature.setPbrShader(pbrShader);
+  offscreenRenderingFeature.setPbrShaders(&pbrShaders);
   offscreenRenderingFeature.setBackgroundShader(backgroundShader);
   offscreenRenderingFeature.initialize();
 
   // iblFeature 초기화
-  iblFeature.setPbrShader(pbrShader);
+  iblFeature.setFrameUniforms(&frameUniforms);
+  iblFeature.setPbrShaders(&pbrShaders);
   iblFeature.setBackgroundShader(backgroundShader);
   iblFeature.setOffscreenRenderingFeature(&offscreenRenderingFeature);
   iblFeature.initialize();
 
   // modelFeature 초기화
-  modelFeature.setPbrShader(pbrShader);
+  modelFeature.setPbrShaders(&pbrShaders);
+  modelFeature.setCameraFeature(&cameraFeature);
+  modelFeature.setRenderStats(&renderStats);
   modelFeature.initialize();
+
+  // instancingFeature 초기화
+  instancingFeature.setPbrShaders(&pbrShaders);
+  instancingFeature.setRenderStats(&renderStats);
+  instancingFeature.initialize();
+
+  // streamingFeature 초기화
+  streamingFeature.setPbrShaders(&pbrShaders);
+  streamingFeature.setCameraFeature(&cameraFeature);
+  streamingFeature.setRenderStats(&renderStats);
+  streamingFeature.initialize();
 }
 
 void App::initializeControllers()
@@ -135,4 +290,16 @@ void App::initializeControllers()
   modelFeature.getModelParameter(modelParameter);
   modelController.addListener(modelFeature);
   modelController.setValue(modelParameter);
+
+  // instancingController 객체의 파라미터 값 초기화 및 리스너 등록
+  InstancingParameter instancingParameter;
+  instancingFeature.getInstancingParameter(instancingParameter);
+  instancingController.addListener(instancingFeature);
+  instancingController.setValue(instancingParameter);
+
+  // streamingController 객체의 파라미터 값 초기화 및 리스너 등록
+  StreamingParameter streamingParameter;
+  streamingFeature.getStreamingParameter(streamingParameter);
+  streamingController.addListener(streamingFeature);
+  streamingController.setValue(streamingParameter);
 }
@@ -0,0 +1,125 @@
+#include "camera/frustum.hpp"
+
+// x86 계열에서 SSE2 명령어를 사용할 수 있으면 SIMD 경로로 컴파일
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FRUSTUM_USE_SSE 1
+#include <emmintrin.h>
+#else
+#define FRUSTUM_USE_SSE 0
+#endif
+
+Frustum::Frustum()
+{
+  // 기본 절두체는 모든 것을 포함하도록 (normal 은 0, distance 는 양수) 설정
+  planes.fill(glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+}
+
+Frustum::Frustum(const glm::mat4 &viewProjection)
+{
+  // glm 은 열 우선(column-major) 행렬이므로 각 행을 직접 조립
+  glm::vec4 row0(viewProjection[0][0], viewProjection[1][0], viewProjection[2][0], viewProjection[3][0]);
+  glm::vec4 row1(viewProjection[0][1], viewProjection[1][1], viewProjection[2][1], viewProjection[3][1]);
+  glm::vec4 row2(viewProjection[0][2], viewProjection[1][2], viewProjection[2][2], viewProjection[3][2]);
+  glm::vec4 row3(viewProjection[0][3], viewProjection[1][3], viewProjection[2][3], viewProjection[3][3]);
+
+  // OpenGL 의 clip space 는 -w <= x, y, z <= w 이므로 row3 ± rowN 이 각 평면이 됨
+  planes[0] = row3 + row0; // left
+  planes[1] = row3 - row0; // right
+  planes[2] = row3 + row1; // bottom
+  planes[3] = row3 - row1; // top
+  planes[4] = row3 + row2; // near
+  planes[5] = row3 - row2; // far
+
+  // 평면까지의 부호 있는 거리를 world space 거리 단위로 비교할 수 있도록 normal 길이로 정규화
+  for (glm::vec4 &plane : planes)
+  {
+    float length = glm::length(glm::vec3(plane));
+    if (length > 0.0f)
+    {
+      plane /= length;
+    }
+  }
+}
+
+bool Frustum::intersects(const BoundingBox &box) const
+{
+  for (const glm::vec4 &plane : planes)
+  {
+    // 평면의 normal 방향으로 가장 멀리 있는 꼭짓점(positive vertex)이 평면 뒤에 있으면 AABB 전체가 바깥에 있음
+    glm::vec3 positiveVertex(plane.x >= 0.0f ? box.max.x : box.min.x,
+                             plane.y >= 0.0f ? box.max.y : box.min.y,
+                             plane.z >= 0.0f ? box.max.z : box.min.z);
+    if (glm::dot(glm::vec3(plane), positiveVertex) + plane.w < 0.0f)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool Frustum::intersects(const BoundingSphere &sphere) const
+{
+  for (const glm::vec4 &plane : planes)
+  {
+    if (glm::dot(glm::vec3(plane), sphere.center) + plane.w < -sphere.radius)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void Frustum::cullSpheres(const BoundingSphereBatch &spheres, std::vector<std::uint8_t> &visible) const
+{
+  visible.resize(spheres.size());
+  cullSpheres(spheres, 0, spheres.size(), visible.data());
+}
+
+void Frustum::cullSpheres(const BoundingSphereBatch &spheres, size_t begin, size_t end, std::uint8_t *visible) const
+{
+  size_t i = begin;
+
+#if FRUSTUM_USE_SSE
+  // sphere 4개씩 묶어서 6개 평면과의 부호 있는 거리를 동시에 계산
+  for (; i + 4 <= end; i += 4)
+  {
+    __m128 centerX = _mm_loadu_ps(&spheres.centerX[i]);
+    __m128 centerY = _mm_loadu_ps(&spheres.centerY[i]);
+    __m128 centerZ = _mm_loadu_ps(&spheres.centerZ[i]);
+    __m128 negativeRadius = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(&spheres.radius[i]));
+
+    // 모든 평면에 대해 (거리 >= -radius) 인 lane 만 남기도록 비트 마스크를 누적
+    __m128 insideMask = _mm_castsi128_ps(_mm_set1_epi32(-1));
+    for (const glm::vec4 &plane : planes)
+    {
+      __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(centerX, _mm_set1_ps(plane.x)),
+                                              _mm_mul_ps(centerY, _mm_set1_ps(plane.y))),
+                                   _mm_add_ps(_mm_mul_ps(centerZ, _mm_set1_ps(plane.z)),
+                                              _mm_set1_ps(plane.w)));
+      insideMask = _mm_and_ps(insideMask, _mm_cmpge_ps(distance, negativeRadius));
+    }
+
+    int mask = _mm_movemask_ps(insideMask);
+    visible[i + 0] = static_cast<std::uint8_t>((mask >> 0) & 1);
+    visible[i + 1] = static_cast<std::uint8_t>((mask >> 1) & 1);
+    visible[i + 2] = static_cast<std::uint8_t>((mask >> 2) & 1);
+    visible[i + 3] = static_cast<std::uint8_t>((mask >> 3) & 1);
+  }
+#endif
+
+  // SIMD 로 처리하고 남은 sphere (또는 SSE 미지원 환경의 모든 sphere) 는 scalar 로 검사
+  for (; i < end; i++)
+  {
+    BoundingSphere sphere;
+    sphere.center = glm::vec3(spheres.centerX[i], spheres.centerY[i], spheres.centerZ[i]);
+    sphere.radius = spheres.radius[i];
+    visible[i] = intersects(sphere) ? 1 : 0;
+  }
+}
+
+const std::array<glm::vec4, Frustum::NUM_PLANES> &Frustum::getPlanes() const
+{
+  return planes;
+}
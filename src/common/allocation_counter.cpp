@@ -0,0 +1,47 @@
+#include "common/allocation_counter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+  // 여러 스레드에서 동시에 할당할 수 있으므로 atomic 으로 집계 (횟수만 필요하므로 memory order 는 relaxed)
+  std::atomic<size_t> allocationCount{0};
+} // namespace
+
+namespace AllocationCounter
+{
+  size_t getCount()
+  {
+    return allocationCount.load(std::memory_order_relaxed);
+  }
+} // namespace AllocationCounter
+
+/*
+  전역 operator new / delete 교체
+
+  -> 배열 버전(new[]) 및 nothrow 버전의 기본 구현은 내부적으로 operator new(size_t) 를 호출하므로,
+  기본 버전만 교체해도 대부분의 할당이 집계됨. (정렬된 할당(align_val_t)은 집계하지 않음)
+*/
+void *operator new(std::size_t size)
+{
+  allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+  // 크기가 0 인 할당도 유일한 주소값을 반환해야 하므로 최소 1 byte 할당
+  if (void *ptr = std::malloc(size == 0 ? 1 : size))
+  {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
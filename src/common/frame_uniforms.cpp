@@ -0,0 +1,48 @@
+#include "common/frame_uniforms.hpp"
+#include "constants/frame_uniform_constants.hpp"
+#include <cstring>
+
+namespace
+{
+  // size 를 alignment 의 배수로 올림
+  GLintptr alignUp(GLintptr size, GLintptr alignment)
+  {
+    return (size + alignment - 1) / alignment * alignment;
+  }
+} // namespace
+
+void FrameUniforms::initialize()
+{
+  // glBindBufferRange() 로 연결할 영역의 시작 위치는 구현마다 다른 정렬 단위의 배수여야 함
+  GLint alignment = 0;
+  glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+  alignment = alignment > 0 ? alignment : 256;
+
+  cameraOffset = 0;
+  lightsOffset = alignUp(cameraOffset + sizeof(CameraUniformBlock), alignment);
+  iblOffset = alignUp(lightsOffset + sizeof(LightsUniformBlock), alignment);
+  staging.assign(static_cast<size_t>(iblOffset + sizeof(IblUniformBlock)), 0);
+
+  // 매 프레임 내용 전체를 다시 쓰므로 GL_DYNAMIC_DRAW 로 할당
+  ubo.setData(nullptr, static_cast<GLsizeiptr>(staging.size()), GL_DYNAMIC_DRAW);
+
+  ubo.bindRange(FrameUniformConstants::CAMERA_BINDING, cameraOffset, sizeof(CameraUniformBlock));
+  ubo.bindRange(FrameUniformConstants::LIGHTS_BINDING, lightsOffset, sizeof(LightsUniformBlock));
+  ubo.bindRange(FrameUniformConstants::IBL_BINDING, iblOffset, sizeof(IblUniformBlock));
+}
+
+void FrameUniforms::attachShader(const Shader &shader) const
+{
+  shader.setUniformBlockBinding(FrameUniformConstants::CAMERA_BLOCK_NAME, FrameUniformConstants::CAMERA_BINDING);
+  shader.setUniformBlockBinding(FrameUniformConstants::LIGHTS_BLOCK_NAME, FrameUniformConstants::LIGHTS_BINDING);
+  shader.setUniformBlockBinding(FrameUniformConstants::IBL_BLOCK_NAME, FrameUniformConstants::IBL_BINDING);
+}
+
+void FrameUniforms::upload()
+{
+  std::memcpy(staging.data() + cameraOffset, &camera, sizeof(CameraUniformBlock));
+  std::memcpy(staging.data() + lightsOffset, &lights, sizeof(LightsUniformBlock));
+  std::memcpy(staging.data() + iblOffset, &ibl, sizeof(IblUniformBlock));
+
+  ubo.setSubData(0, staging.data(), static_cast<GLsizeiptr>(staging.size()));
+}
@@ -0,0 +1,19 @@
+#include "common/gl_call_counter.hpp"
+
+namespace
+{
+  size_t callCount = 0;
+} // namespace
+
+namespace GLCallCounter
+{
+  void add(size_t count)
+  {
+    callCount += count;
+  }
+
+  size_t getCount()
+  {
+    return callCount;
+  }
+} // namespace GLCallCounter
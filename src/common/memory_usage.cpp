@@ -0,0 +1,46 @@
+#include "common/memory_usage.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace
+{
+  // /proc/self/status 에서 "field: <값> kB" 형식의 항목을 찾아 bytes 단위로 반환
+  size_t readProcStatusField(const std::string &field)
+  {
+#if defined(__linux__)
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+      if (line.compare(0, field.size(), field) != 0 || line.size() <= field.size() || line[field.size()] != ':')
+      {
+        continue;
+      }
+
+      std::istringstream stream(line.substr(field.size() + 1));
+      size_t kilobytes = 0;
+      stream >> kilobytes;
+      return kilobytes * 1024;
+    }
+#else
+    (void)field;
+#endif
+    return 0;
+  }
+} // namespace
+
+namespace MemoryUsage
+{
+  size_t getCurrentRss()
+  {
+    return readProcStatusField("VmRSS");
+  }
+
+  size_t getPeakRss()
+  {
+    // VmHWM(High Water Mark) 은 프로세스 시작 이후 RSS 의 최대값
+    return readProcStatusField("VmHWM");
+  }
+} // namespace MemoryUsage
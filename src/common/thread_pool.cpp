@@ -0,0 +1,118 @@
+#include "common/thread_pool.hpp"
+#include <algorithm>
+
+ThreadPool::ThreadPool(size_t workerCount)
+{
+  workers.reserve(workerCount);
+  for (size_t i = 0; i < workerCount; i++)
+  {
+    workers.emplace_back(&ThreadPool::workerLoop, this);
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+  workAvailable.notify_all();
+
+  for (std::thread &worker : workers)
+  {
+    worker.join();
+  }
+}
+
+size_t ThreadPool::getWorkerCount() const
+{
+  return workers.size();
+}
+
+size_t ThreadPool::getDefaultWorkerCount()
+{
+  // hardware_concurrency() 는 값을 알 수 없으면 0 을 반환함
+  const unsigned int hardwareThreads = std::thread::hardware_concurrency();
+  return hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+}
+
+void ThreadPool::run(size_t count, size_t grainSize, RangeFunction function, void *context)
+{
+  grainSize = std::max<size_t>(grainSize, 1);
+
+  // 구간이 하나뿐이거나 worker 가 없으면 스레드 간 동기화 비용 없이 곧바로 실행
+  if (workers.empty() || count <= grainSize)
+  {
+    if (count > 0)
+    {
+      function(context, 0, count);
+    }
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    rangeFunction = function;
+    rangeContext = context;
+    rangeCount = count;
+    rangeGrainSize = grainSize;
+    nextIndex.store(0, std::memory_order_relaxed);
+    activeWorkers = workers.size();
+    generation++;
+  }
+  workAvailable.notify_all();
+
+  // 호출한 스레드도 구간 처리에 참여
+  processRanges();
+
+  // 모든 worker 가 자신이 가져간 구간을 끝낼 때까지 대기
+  std::unique_lock<std::mutex> lock(mutex);
+  workFinished.wait(lock, [this]()
+                    { return activeWorkers == 0; });
+}
+
+void ThreadPool::workerLoop()
+{
+  size_t seenGeneration = 0;
+
+  while (true)
+  {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      workAvailable.wait(lock, [this, seenGeneration]()
+                         { return stopping || generation != seenGeneration; });
+
+      if (stopping)
+      {
+        return;
+      }
+
+      seenGeneration = generation;
+    }
+
+    processRanges();
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      activeWorkers--;
+      if (activeWorkers == 0)
+      {
+        workFinished.notify_one();
+      }
+    }
+  }
+}
+
+void ThreadPool::processRanges()
+{
+  while (true)
+  {
+    const size_t begin = nextIndex.fetch_add(rangeGrainSize, std::memory_order_relaxed);
+    if (begin >= rangeCount)
+    {
+      return;
+    }
+
+    rangeFunction(rangeContext, begin, std::min(begin + rangeGrainSize, rangeCount));
+  }
+}
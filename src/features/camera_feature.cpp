@@ -4,8 +4,9 @@
 
 CameraFeature::CameraFeature()
     : camera(Camera()),
-      pbrShaderPtr(nullptr),
-      backgroundShaderPtr(nullptr)
+      frameUniformsPtr(nullptr),
+      projection(glm::mat4(1.0f)),
+      view(glm::mat4(1.0f))
 {
 }
 
@@ -21,29 +22,28 @@ void CameraFeature::initialize()
 void CameraFeature::process()
 {
   // 카메라의 zoom 값으로부터 투영 행렬 계산
-  glm::mat4 projection = glm::perspective(glm::radians(camera.getCameraZoom()), static_cast<float>(LayoutConstants::WINDOW_WIDTH_DEFAULT) / static_cast<float>(LayoutConstants::WINDOW_HEIGHT_DEFAULT), 0.1f, 100.0f);
+  projection = glm::perspective(glm::radians(camera.getCameraZoom()), static_cast<float>(LayoutConstants::WINDOW_WIDTH_DEFAULT) / static_cast<float>(LayoutConstants::WINDOW_HEIGHT_DEFAULT), 0.1f, 100.0f);
 
   // 카메라 클래스로부터 뷰 행렬(= LookAt 행렬) 가져오기
-  glm::mat4 view = camera.getViewMatrix();
+  view = camera.getViewMatrix();
 
-  // pbrShader 쉐이더 프로그램 바인딩 및 현재 카메라의 projection 및 view 행렬 전송
-  pbrShaderPtr->use();
-  pbrShaderPtr->setMat4("projection", projection);
-  pbrShaderPtr->setMat4("view", view);
+  // view-projection 행렬로부터 world space 절두체 평면 추출
+  frustum = Frustum(projection * view);
 
-  // pbrShader 쉐이더 프로그램에 카메라 위치값 전송
-  pbrShaderPtr->setVec3("camPos", camera.getCameraPosition());
+  /*
+    현재 카메라의 projection, view 행렬 및 카메라 위치를 Camera uniform block 에 기록
 
-  // skybox 쉐이더 프로그램 바인딩 및 현재 카메라의 projection 및 view 행렬 전송
-  backgroundShaderPtr->use();
-  backgroundShaderPtr->setMat4("projection", projection);
-  backgroundShaderPtr->setMat4("view", view);
+    -> pbr 및 skybox 쉐이더가 같은 block 을 공유하므로 쉐이더 프로그램을 바꿔가며 따로 전송하지 않고,
+    App 이 그리기 전에 다른 block 들과 함께 한번에 업로드함.
+  */
+  frameUniformsPtr->camera.projection = projection;
+  frameUniformsPtr->camera.view = view;
+  frameUniformsPtr->camera.position = glm::vec4(camera.getCameraPosition(), 1.0f);
 }
 
 void CameraFeature::finalize()
 {
-  pbrShaderPtr = nullptr;
-  backgroundShaderPtr = nullptr;
+  frameUniformsPtr = nullptr;
 }
 
 void CameraFeature::onChange(const CameraParameter &param)
@@ -71,19 +71,34 @@ void CameraFeature::onChange(const CameraParameter &param)
   cameraParameter = param;
 }
 
-void CameraFeature::setPbrShader(std::shared_ptr<Shader> pbrShader)
+void CameraFeature::setFrameUniforms(FrameUniforms *frameUniforms)
 {
-  pbrShaderPtr = pbrShader;
+  frameUniformsPtr = frameUniforms;
 }
 
-void CameraFeature::setBackgroundShader(std::shared_ptr<Shader> backgroundShader)
+void CameraFeature::getCameraParameter(CameraParameter &param) const
 {
-  backgroundShaderPtr = backgroundShader;
+  param = cameraParameter;
 }
 
-void CameraFeature::getCameraParameter(CameraParameter &param) const
+const glm::mat4 &CameraFeature::getProjectionMatrix() const
 {
-  param = cameraParameter;
+  return projection;
+}
+
+const glm::mat4 &CameraFeature::getViewMatrix() const
+{
+  return view;
+}
+
+glm::vec3 CameraFeature::getCameraPosition() const
+{
+  return camera.getCameraPosition();
+}
+
+const Frustum &CameraFeature::getFrustum() const
+{
+  return frustum;
 }
 
 void CameraFeature::setYaw(const float yaw)
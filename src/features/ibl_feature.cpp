@@ -2,7 +2,8 @@
 #include "constants/ibl_constants.hpp"
 
 IBLFeature::IBLFeature()
-    : pbrShaderPtr(nullptr),
+    : frameUniformsPtr(nullptr),
+      pbrShadersPtr(nullptr),
       backgroundShaderPtr(nullptr),
       offscreenRenderingFeaturePtr(nullptr)
 {
@@ -19,10 +20,7 @@ void IBLFeature::initialize()
 
 void IBLFeature::process()
 {
-  pbrShaderPtr->use();
-
-  pbrShaderPtr->setBool("iblVisibility", iblVisibility);
-  pbrShaderPtr->setFloat("iblIntensity", iblIntensity);
+  // IBL 파라미터는 setter 에서 IBL uniform block 에 기록되므로, 여기서는 텍스쳐만 바인딩함
 
   // hdrImageIndex 에 따른 offscreen buffer 바인딩
   offscreenRenderingFeaturePtr->useIrradianceMap(hdrImageIndex);
@@ -45,7 +43,8 @@ void IBLFeature::process()
 
 void IBLFeature::finalize()
 {
-  pbrShaderPtr = nullptr;
+  frameUniformsPtr = nullptr;
+  pbrShadersPtr = nullptr;
   backgroundShaderPtr = nullptr;
   offscreenRenderingFeaturePtr = nullptr;
 }
@@ -75,9 +74,14 @@ void IBLFeature::onChange(const IBLParameter &param)
   iblParameter = param;
 }
 
-void IBLFeature::setPbrShader(std::shared_ptr<Shader> pbrShader)
+void IBLFeature::setFrameUniforms(FrameUniforms *frameUniforms)
+{
+  frameUniformsPtr = frameUniforms;
+}
+
+void IBLFeature::setPbrShaders(PbrShaderVariants *pbrShaders)
 {
-  pbrShaderPtr = pbrShader;
+  pbrShadersPtr = pbrShaders;
 }
 
 void IBLFeature::setBackgroundShader(std::shared_ptr<Shader> backgroundShader)
@@ -98,6 +102,7 @@ void IBLFeature::getIBLParameter(IBLParameter &param) const
 void IBLFeature::setIBLVisibility(const bool iblVisibility)
 {
   this->iblVisibility = iblVisibility;
+  pbrShadersPtr->setIBLEnabled(iblVisibility);
 }
 
 void IBLFeature::setSkyboxVisibility(const bool skyboxVisibility)
@@ -108,6 +113,7 @@ void IBLFeature::setSkyboxVisibility(const bool skyboxVisibility)
 void IBLFeature::setIBLIntensity(const float iblIntensity)
 {
   this->iblIntensity = iblIntensity;
+  frameUniformsPtr->ibl.intensity = iblIntensity;
 }
 
 void IBLFeature::setHDRImageIndex(const int hdrImageIndex)
@@ -0,0 +1,231 @@
+#include "features/instancing_feature.hpp"
+#include <glm/gtc/matrix_transform.hpp> // 행렬 변환 관련 함수
+#include <chrono>
+
+InstancingFeature::InstancingFeature()
+    : pbrShadersPtr(nullptr),
+      renderStatsPtr(nullptr),
+      enabled(InstancingConstants::ENABLED_DEFAULT),
+      useInstancing(InstancingConstants::USE_INSTANCING_DEFAULT),
+      gridSizeIndex(InstancingConstants::GRID_SIZE_INDEX_DEFAULT),
+      instancesDirty(true),
+      uniformShader(nullptr),
+      uniformShaderRevision(0),
+      timerQueryIndex(0),
+      gpuTimeMs(0.0f)
+{
+  // 구체 mesh 의 VAO 에 인스턴스별 데이터를 읽어들일 instanced VBO 연결
+  sphere.linkInstanceBuffer(instanceVbo);
+
+  for (auto &timerQuery : timerQueries)
+  {
+    timerQuery = std::make_unique<QueryObject>(GL_TIME_ELAPSED);
+  }
+}
+
+void InstancingFeature::initialize()
+{
+  // InstancingUi 에서 관리되는 각 ImGui 요소에 입력할 초기값 설정
+  instancingParameter.enabled = InstancingConstants::ENABLED_DEFAULT;
+  instancingParameter.useInstancing = InstancingConstants::USE_INSTANCING_DEFAULT;
+  instancingParameter.gridSizeIndex = InstancingConstants::GRID_SIZE_INDEX_DEFAULT;
+}
+
+void InstancingFeature::process()
+{
+  if (!enabled)
+  {
+    return;
+  }
+
+  if (instancesDirty)
+  {
+    updateInstances();
+  }
+
+  /*
+    이전 프레임들에서 실행된 timer query 중 결과가 준비된 것이 있으면 GPU 처리 시간 갱신
+
+    -> 가장 오래 전에 실행된 query 를 이번 프레임에 재사용하므로, 재사용하기 직전에 결과를 확인함.
+  */
+  QueryObject &timerQuery = *timerQueries[timerQueryIndex];
+  if (timerQuery.isResultAvailable())
+  {
+    gpuTimeMs = static_cast<float>(timerQuery.getResult()) * 1e-6f;
+  }
+
+  // hardware instancing 은 Material 파라미터를 per-instance attribute 로 읽는 변형, 그 외에는 uniform 으로 읽는 변형 사용
+  ShaderVariant &pbrVariant = pbrShadersPtr->acquire(useInstancing);
+  Shader &pbrShader = *pbrVariant.shader;
+  if (&pbrShader != uniformShader || pbrShader.getRevision() != uniformShaderRevision)
+  {
+    updateUniformHandles(pbrShader);
+  }
+
+  pbrShader.use();
+
+  // grid 의 위치는 인스턴스별 모델 행렬에 모두 포함되어 있으므로 공통 모델 행렬은 단위 행렬로 설정
+  pbrShader.set(modelUniform, glm::mat4(1.0f));
+  pbrShader.set(normalMatrixUniform, glm::mat3(1.0f));
+
+  auto cpuStart = std::chrono::steady_clock::now();
+  timerQuery.bind();
+  pbrShadersPtr->getCache().beginGpuTimer(pbrVariant);
+
+  unsigned int drawCallCount = 0;
+  if (useInstancing)
+  {
+    drawInstanced(pbrShader);
+    drawCallCount = 1;
+  }
+  else
+  {
+    drawPerInstance(pbrShader);
+    drawCallCount = static_cast<unsigned int>(instances.size());
+  }
+
+  pbrShadersPtr->getCache().endGpuTimer();
+  timerQuery.unbind();
+  auto cpuEnd = std::chrono::steady_clock::now();
+
+  timerQueryIndex = (timerQueryIndex + 1) % InstancingConstants::NUM_TIMER_QUERIES;
+
+  // 인스턴스 개수, draw call 개수, CPU 제출 시간 및 GPU 처리 시간 집계
+  renderStatsPtr->instanceCount = static_cast<unsigned int>(instances.size());
+  renderStatsPtr->instancingDrawCallCount = drawCallCount;
+  renderStatsPtr->instancingCpuTimeMs = std::chrono::duration<float, std::milli>(cpuEnd - cpuStart).count();
+  renderStatsPtr->instancingGpuTimeMs = gpuTimeMs;
+  renderStatsPtr->drawCallCount += drawCallCount;
+}
+
+void InstancingFeature::finalize()
+{
+  pbrShadersPtr = nullptr;
+  renderStatsPtr = nullptr;
+}
+
+void InstancingFeature::onChange(const InstancingParameter &param)
+{
+  if (enabled != param.enabled)
+  {
+    setEnabled(param.enabled);
+  }
+
+  if (useInstancing != param.useInstancing)
+  {
+    setUseInstancing(param.useInstancing);
+  }
+
+  if (gridSizeIndex != param.gridSizeIndex)
+  {
+    setGridSizeIndex(param.gridSizeIndex);
+  }
+
+  instancingParameter = param;
+}
+
+void InstancingFeature::setPbrShaders(PbrShaderVariants *pbrShaders)
+{
+  pbrShadersPtr = pbrShaders;
+}
+
+void InstancingFeature::setRenderStats(RenderStats *renderStats)
+{
+  renderStatsPtr = renderStats;
+}
+
+void InstancingFeature::getInstancingParameter(InstancingParameter &param) const
+{
+  param = instancingParameter;
+}
+
+void InstancingFeature::updateInstances()
+{
+  const int gridSize = InstancingConstants::GRID_SIZES[gridSizeIndex].size;
+  const float cellSize = InstancingConstants::GRID_EXTENT / static_cast<float>(gridSize);
+  const float radius = cellSize * InstancingConstants::SPHERE_RADIUS_RATIO;
+
+  instances.resize(static_cast<size_t>(gridSize) * gridSize);
+
+  for (int row = 0; row < gridSize; row++)
+  {
+    // 각 행은 아래에서 위로 갈수록 metallic 이 증가
+    float metallic = gridSize > 1 ? static_cast<float>(row) / static_cast<float>(gridSize - 1) : 0.0f;
+
+    for (int col = 0; col < gridSize; col++)
+    {
+      // 각 열은 왼쪽에서 오른쪽으로 갈수록 roughness 가 증가
+      float roughness = gridSize > 1 ? static_cast<float>(col) / static_cast<float>(gridSize - 1) : 1.0f;
+      roughness = glm::clamp(roughness, InstancingConstants::ROUGHNESS_MIN, 1.0f);
+
+      // grid 중심이 (0, 0, GRID_DEPTH) 에 오도록 배치
+      glm::vec3 position((col + 0.5f) * cellSize - InstancingConstants::GRID_EXTENT * 0.5f,
+                         (row + 0.5f) * cellSize - InstancingConstants::GRID_EXTENT * 0.5f,
+                         InstancingConstants::GRID_DEPTH);
+
+      InstanceData &instance = instances[static_cast<size_t>(row) * gridSize + col];
+      instance.model = glm::scale(glm::translate(glm::mat4(1.0f), position), glm::vec3(radius));
+      instance.normalMatrix = glm::transpose(glm::inverse(glm::mat3(instance.model)));
+      instance.material = glm::vec4(metallic, roughness, InstancingConstants::AMBIENT_OCCLUSION, 0.0f);
+      instance.albedo = glm::vec4(InstancingConstants::ALBEDO, 0.0f);
+    }
+  }
+
+  instanceVbo.setData(instances.data(), instances.size() * sizeof(InstanceData), GL_STATIC_DRAW);
+  instancesDirty = false;
+}
+
+void InstancingFeature::updateUniformHandles(const Shader &pbrShader)
+{
+  uniformShader = &pbrShader;
+  uniformShaderRevision = pbrShader.getRevision();
+  modelUniform = pbrShader.getUniformHandle<glm::mat4>("model");
+  normalMatrixUniform = pbrShader.getUniformHandle<glm::mat3>("normalMatrix");
+  metallicUniform = pbrShader.getUniformHandle<float>("metallic");
+  roughnessUniform = pbrShader.getUniformHandle<float>("roughness");
+  aoUniform = pbrShader.getUniformHandle<float>("ao");
+  albedoUniform = pbrShader.getUniformHandle<glm::vec3>("albedo");
+}
+
+void InstancingFeature::drawInstanced(Shader &pbrShader)
+{
+  // INSTANCED_MATERIAL 변형은 uniform 대신 per-instance attribute 로 Material 파라미터를 읽음
+  sphere.drawInstanced(pbrShader, static_cast<GLsizei>(instances.size()));
+}
+
+void InstancingFeature::drawPerInstance(Shader &pbrShader)
+{
+  /*
+    instancing 을 사용하지 않는 일반적인 방식과 비교하기 위해
+    인스턴스마다 모델 행렬, 노멀 행렬, Material 파라미터 uniform 을 전송하고 draw call 을 호출함.
+
+    -> MaterialFeature 가 전송한 Material uniform 은 덮어쓰여지지만,
+    매 프레임 시작 시 MaterialFeature::process() 에서 다시 전송되므로 다른 Feature 에 영향을 주지 않음.
+  */
+  for (const InstanceData &instance : instances)
+  {
+    pbrShader.set(modelUniform, instance.model);
+    pbrShader.set(normalMatrixUniform, instance.normalMatrix);
+    pbrShader.set(metallicUniform, instance.material.x);
+    pbrShader.set(roughnessUniform, instance.material.y);
+    pbrShader.set(aoUniform, instance.material.z);
+    pbrShader.set(albedoUniform, glm::vec3(instance.albedo));
+    perInstanceSphere.draw(pbrShader);
+  }
+}
+
+void InstancingFeature::setEnabled(const bool enabled)
+{
+  this->enabled = enabled;
+}
+
+void InstancingFeature::setUseInstancing(const bool useInstancing)
+{
+  this->useInstancing = useInstancing;
+}
+
+void InstancingFeature::setGridSizeIndex(const int gridSizeIndex)
+{
+  this->gridSizeIndex = gridSizeIndex;
+  instancesDirty = true;
+}
@@ -1,7 +1,8 @@
 #include "features/light_feature.hpp"
 
 LightFeature::LightFeature()
-    : pbrShaderPtr(nullptr)
+    : frameUniformsPtr(nullptr),
+      pbrShadersPtr(nullptr)
 {
 }
 
@@ -18,23 +19,32 @@ void LightFeature::initialize()
 
 void LightFeature::process()
 {
-  /* 광원 정보 쉐이더 전송 */
+  /*
+    광원 정보를 Lights uniform block 에 기록 (App 이 그리기 전에 한번에 업로드하므로 쉐이더 프로그램을 바인딩하지 않음)
 
-  // pbrShader 바인딩
-  pbrShaderPtr->use();
-
-  // 광원 데이터 개수만큼 for-loop 순회
+    -> intensity 가 0 인 광원은 radiance 에 기여하지 않으므로 건너뛰고, 켜진 광원들만 배열 앞쪽에 모아서
+    켜진 광원 개수만큼만 반복하는 쉐이더 변형이 사용되도록 함.
+  */
+  unsigned int lightCount = 0;
   for (unsigned int i = 0; i < lights.size(); ++i)
   {
-    // 광원 위치 및 색상 데이터를 쉐이더 프로그램에 전송
-    pbrShaderPtr->setVec3("lightPositions[" + std::to_string(i) + "]", lights[i].getPosition());
-    pbrShaderPtr->setVec3("lightColors[" + std::to_string(i) + "]", lights[i].getColor() * lights[i].getIntensity());
+    if (lights[i].getIntensity() <= 0.0f)
+    {
+      continue;
+    }
+
+    frameUniformsPtr->lights.positions[lightCount] = glm::vec4(lights[i].getPosition(), 1.0f);
+    frameUniformsPtr->lights.colors[lightCount] = glm::vec4(lights[i].getColor() * lights[i].getIntensity(), 1.0f);
+    lightCount++;
   }
+
+  pbrShadersPtr->setLightCount(lightCount);
 }
 
 void LightFeature::finalize()
 {
-  pbrShaderPtr = nullptr;
+  frameUniformsPtr = nullptr;
+  pbrShadersPtr = nullptr;
 }
 
 void LightFeature::onChange(const LightParameter &param)
@@ -65,9 +75,14 @@ void LightFeature::onChange(const LightParameter &param)
   lightParameter = param;
 }
 
-void LightFeature::setPbrShader(std::shared_ptr<Shader> pbrShader)
+void LightFeature::setFrameUniforms(FrameUniforms *frameUniforms)
+{
+  frameUniformsPtr = frameUniforms;
+}
+
+void LightFeature::setPbrShaders(PbrShaderVariants *pbrShaders)
 {
-  pbrShaderPtr = pbrShader;
+  pbrShadersPtr = pbrShaders;
 }
 
 void LightFeature::getLightParameter(LightParameter &param) const
@@ -2,7 +2,7 @@
 #include "constants/material_constansts.hpp"
 
 MaterialFeature::MaterialFeature()
-    : pbrShaderPtr(nullptr)
+    : pbrShadersPtr(nullptr)
 {
 }
 
@@ -17,17 +17,29 @@ void MaterialFeature::initialize()
 
 void MaterialFeature::process()
 {
-  pbrShaderPtr->use();
+  // 이번 프레임에 uniform material 로 그리는 Feature 들이 사용할 변형에 material 파라미터 전송
+  Shader &pbrShader = *pbrShadersPtr->acquire(false).shader;
+  if (&pbrShader != uniformShader || pbrShader.getRevision() != uniformShaderRevision)
+  {
+    uniformShader = &pbrShader;
+    uniformShaderRevision = pbrShader.getRevision();
+    roughnessUniform = pbrShader.getUniformHandle<float>("roughness");
+    metallicUniform = pbrShader.getUniformHandle<float>("metallic");
+    aoUniform = pbrShader.getUniformHandle<float>("ao");
+    albedoUniform = pbrShader.getUniformHandle<glm::vec3>("albedo");
+  }
+
+  pbrShader.use();
 
-  pbrShaderPtr->setFloat("roughness", glm::clamp(roughness, MaterialConstants::ROUGHNESS_MIN, MaterialConstants::ROUGHNESS_MAX));
-  pbrShaderPtr->setFloat("metallic", metallic);
-  pbrShaderPtr->setFloat("ao", ambientOcclusion);
-  pbrShaderPtr->setVec3("albedo", albedo); // 표면 밖으로 빠져나온 diffuse light 색상값을 쉐이더 프로그램에 전송
+  pbrShader.set(roughnessUniform, glm::clamp(roughness, MaterialConstants::ROUGHNESS_MIN, MaterialConstants::ROUGHNESS_MAX));
+  pbrShader.set(metallicUniform, metallic);
+  pbrShader.set(aoUniform, ambientOcclusion);
+  pbrShader.set(albedoUniform, albedo); // 표면 밖으로 빠져나온 diffuse light 색상값을 쉐이더 프로그램에 전송
 }
 
 void MaterialFeature::finalize()
 {
-  pbrShaderPtr = nullptr;
+  pbrShadersPtr = nullptr;
 }
 
 void MaterialFeature::onChange(const MaterialParameter &param)
@@ -55,9 +67,9 @@ void MaterialFeature::onChange(const MaterialParameter &param)
   materialParameter = param;
 }
 
-void MaterialFeature::setPbrShader(std::shared_ptr<Shader> pbrShader)
+void MaterialFeature::setPbrShaders(PbrShaderVariants *pbrShaders)
 {
-  pbrShaderPtr = pbrShader;
+  pbrShadersPtr = pbrShaders;
 }
 
 void MaterialFeature::getMaterialParameter(MaterialParameter &param) const
@@ -1,12 +1,124 @@
 #include "features/model_feature.hpp"
+#include "constants/layout_constants.hpp"
+#include "gl_objects/texture_cache.hpp"
+#include "common/memory_usage.hpp"
+#include "constants/animation_constants.hpp"
+#include "constants/scene_constants.hpp"
+#include <spdlog/spdlog.h>
+#include <chrono>
+#include <random>
+#include <limits>
 #include <glm/gtc/matrix_transform.hpp> // 행렬 변환 관련 함수
 #include <glm/gtc/quaternion.hpp>       // 쿼터니언 정의 및 관련 함수
 #include <glm/gtx/quaternion.hpp>       // 쿼터니언에 대한 추가 함수
 
+namespace
+{
+  // BVH 광선 처리량 측정 결과 (Mrays/s)
+  struct BvhThroughput
+  {
+    float closestHitMrays = 0.0f;
+    float anyHitMrays = 0.0f;
+  };
+
+  /*
+    Model 의 각 Mesh BVH 에 광선들을 쏴서 단일 스레드 기준 초당 처리 광선 수 측정
+
+    -> Mesh 의 bounding sphere 바깥(반지름 2배 거리)의 임의의 점에서 sphere 내부의 임의의 점을 향하는 광선들을
+    object space 로 미리 생성해두고, 광선 생성 비용을 제외한 BVH 순회 시간만 측정함.
+    -> seed 가 고정되어 있으므로 같은 모델이면 매 실행마다 같은 광선들로 측정됨.
+  */
+  BvhThroughput measureBvhThroughput(const Model &model)
+  {
+    std::vector<const Mesh<ModelVertexData> *> bvhMeshes;
+    for (const auto &mesh : model.meshes)
+    {
+      if (mesh->getBvh())
+      {
+        bvhMeshes.push_back(mesh.get());
+      }
+    }
+
+    BvhThroughput throughput;
+    if (bvhMeshes.empty())
+    {
+      return throughput;
+    }
+
+    std::mt19937 rng(BvhConstants::BENCHMARK_SEED);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+    // 단위 구 내부의 임의의 점 (rejection sampling)
+    auto randomInUnitSphere = [&]()
+    {
+      glm::vec3 point;
+      do
+      {
+        point = glm::vec3(distribution(rng), distribution(rng), distribution(rng));
+      } while (glm::dot(point, point) > 1.0f || glm::dot(point, point) < 1e-6f);
+      return point;
+    };
+
+    std::vector<BvhRay> rays(BvhConstants::BENCHMARK_RAY_COUNT);
+    for (size_t i = 0; i < rays.size(); i++)
+    {
+      const BoundingSphere &sphere = bvhMeshes[i % bvhMeshes.size()]->getBoundingSphere();
+      rays[i].origin = sphere.center + glm::normalize(randomInUnitSphere()) * sphere.radius * 2.0f;
+      rays[i].direction = sphere.center + randomInUnitSphere() * sphere.radius - rays[i].origin;
+    }
+
+    size_t hitCount = 0;
+    auto closestHitStart = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < rays.size(); i++)
+    {
+      BvhHit hit;
+      hitCount += bvhMeshes[i % bvhMeshes.size()]->getBvh()->intersect(rays[i], std::numeric_limits<float>::max(), hit) ? 1 : 0;
+    }
+    float closestHitMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - closestHitStart).count();
+
+    size_t occludedCount = 0;
+    auto anyHitStart = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < rays.size(); i++)
+    {
+      occludedCount += bvhMeshes[i % bvhMeshes.size()]->getBvh()->occluded(rays[i], std::numeric_limits<float>::max()) ? 1 : 0;
+    }
+    float anyHitMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - anyHitStart).count();
+
+    // 두 검사는 같은 광선들에 대해 교차 여부가 항상 같아야 함
+    if (hitCount != occludedCount)
+    {
+      spdlog::warn("BVH closest-hit and any-hit disagree ({} vs {} hits)", hitCount, occludedCount);
+    }
+
+    throughput.closestHitMrays = closestHitMs > 0.0f ? rays.size() / (closestHitMs * 1e3f) : 0.0f;
+    throughput.anyHitMrays = anyHitMs > 0.0f ? rays.size() / (anyHitMs * 1e3f) : 0.0f;
+
+    spdlog::info("BVH traversal : {:.2f} Mrays/s closest-hit, {:.2f} Mrays/s any-hit ({} rays, {:.1f}% hit, 1 thread)",
+                 throughput.closestHitMrays,
+                 throughput.anyHitMrays,
+                 rays.size(),
+                 100.0 * hitCount / rays.size());
+
+    return throughput;
+  }
+} // namespace
+
 ModelFeature::ModelFeature()
-    : pbrShaderPtr(nullptr),
-      transform(glm::mat4(1.0f))
+    : pbrShadersPtr(nullptr),
+      cameraFeaturePtr(nullptr),
+      renderStatsPtr(nullptr),
+      transform(glm::mat4(1.0f)),
+      pickTimeMs(0.0f)
 {
+  /*
+    multi draw indirect 를 지원하면 모든 Model 의 Mesh 들을 공유 버퍼에 업로드하여
+    Model 하나를 최소한의 draw call 로 그리고, 지원하지 않으면 기존처럼 Mesh 마다 그림.
+  */
+  if (GLExtensions::hasMultiDrawIndirect())
+  {
+    geometryArenas = std::make_shared<ModelGeometryArenas>();
+  }
+
   /** Model 관련 정적 배열 컨테이너들 초기화 */
   for (int i = 0; i < ModelConstants::NUM_MODELS; i++)
   {
@@ -14,8 +126,32 @@ ModelFeature::ModelFeature()
     modelUrls[i] = ModelConstants::models[i].path;
 
     /** 모델링 파일을 로드하여 Model 객체 생성 */
-    models[i] = std::make_unique<Model>(modelUrls[i]);
+    // 모델 로드 전후의 RSS 및 로드 중의 최대 RSS 를 기록하여 import 과정의 메모리 사용량 확인
+    // aiMesh 변환 작업은 스레드 풀로 병렬 처리되므로, worker 개수와 함께 import 소요 시간을 기록
+    size_t rssBefore = MemoryUsage::getCurrentRss();
+    auto loadStart = std::chrono::steady_clock::now();
+    models[i] = std::make_unique<Model>(modelUrls[i], ModelLoadOptions(), geometryArenas, &threadPool);
+    float loadTimeMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - loadStart).count();
+
+    spdlog::info("Model <{}> loaded in {:.1f} ms with {} workers (RSS {:.1f} MB -> {:.1f} MB, peak {:.1f} MB)",
+                 modelUrls[i],
+                 loadTimeMs,
+                 threadPool.getWorkerCount() + 1,
+                 rssBefore / (1024.0 * 1024.0),
+                 MemoryUsage::getCurrentRss() / (1024.0 * 1024.0),
+                 MemoryUsage::getPeakRss() / (1024.0 * 1024.0));
+
+    // 로드 시 생성된 BVH 의 광선 처리량 측정 (측정하지 않으면 0 으로 두어 StatsUi 에 표시하지 않음)
+    BvhThroughput throughput;
+    if (BvhConstants::BENCHMARK_ENABLED)
+    {
+      throughput = measureBvhThroughput(*models[i]);
+    }
+    bvhClosestHitMrays[i] = throughput.closestHitMrays;
+    bvhAnyHitMrays[i] = throughput.anyHitMrays;
   }
+
+  buildScene();
 }
 
 void ModelFeature::initialize()
@@ -25,11 +161,23 @@ void ModelFeature::initialize()
   modelParameter.rotation = ModelConstants::ROTATION_DEFAULT;
   modelParameter.scale = ModelConstants::SCALE_DEFAULT;
   modelParameter.modelIndex = ModelConstants::MODEL_INDEX_DEFAULT;
+  modelParameter.animate = AnimationConstants::ANIMATE_DEFAULT;
+  modelParameter.animationSpeed = AnimationConstants::SPEED_DEFAULT;
+  modelParameter.sceneEnabled = SceneConstants::ENABLED_DEFAULT;
+
+  // pbr 쉐이더 변형들의 BonePalette uniform block 을 Model 들이 bone palette UBO 를 연결할 binding point 에 연결
+  pbrShadersPtr->getCache().addProgramInitializer([](Shader &pbrShader)
+                                                  { pbrShader.setUniformBlockBinding("BonePalette", AnimationConstants::BONE_PALETTE_BINDING); });
+
+  lastFrameTime = std::chrono::steady_clock::now();
 }
 
 void ModelFeature::process()
 {
-  pbrShaderPtr->use();
+  // 현재 IBL 및 광원 설정에 맞는 uniform material 변형 사용
+  ShaderVariant &pbrVariant = pbrShadersPtr->acquire(false);
+  Shader &pbrShader = *pbrVariant.shader;
+  pbrShader.use();
 
   // 모델 행렬을 단위 행렬로 초기화
   transform = glm::mat4(1.0f);
@@ -50,22 +198,263 @@ void ModelFeature::process()
   transform = glm::scale(transform, scale);
 
   // 계산된 모델 행렬을 쉐이더 프로그램에 전송
-  pbrShaderPtr->setMat4("model", transform);
+  pbrShader.setMat4("model", transform);
 
   /*
     쉐이더 코드에서 노멀벡터를 World Space 로 변환할 때
     사용할 노멀행렬을 각 구체의 계산된 모델행렬로부터 계산 후,
     쉐이더 코드에 전송
   */
-  pbrShaderPtr->setMat3("normalMatrix", glm::transpose(glm::inverse(glm::mat3(transform))));
+  pbrShader.setMat3("normalMatrix", glm::transpose(glm::inverse(glm::mat3(transform))));
+
+  // 이전 프레임으로부터 흐른 시간만큼 애니메이션 진행 (scene 을 그리는 동안에도 시각을 갱신하여 다시 전환했을 때 애니메이션이 튀지 않도록 함)
+  auto frameTime = std::chrono::steady_clock::now();
+  float deltaTime = std::chrono::duration<float>(frameTime - lastFrameTime).count();
+  lastFrameTime = frameTime;
+
+  pbrShadersPtr->getCache().beginGpuTimer(pbrVariant);
+  if (sceneEnabled)
+  {
+    processScene(pbrShader);
+  }
+  else
+  {
+    processModel(deltaTime, pbrShader);
+  }
+  pbrShadersPtr->getCache().endGpuTimer();
+
+  // 텍스쳐 캐시에 상주하는 텍스쳐 개수 및 메모리 크기 집계
+  renderStatsPtr->cachedTextureCount = static_cast<unsigned int>(TextureCache::getInstance().getTextureCount());
+  renderStatsPtr->cachedTextureBytes = TextureCache::getInstance().getResidentBytes();
+}
+
+void ModelFeature::processModel(float deltaTime, Shader &pbrShader)
+{
+  // 애니메이션을 진행하고, bone palette 계산에 걸린 시간 측정
+  if (models[modelIndex]->isAnimated())
+  {
+    auto animationStart = std::chrono::steady_clock::now();
+    if (animate)
+    {
+      renderStatsPtr->animatedJointCount = static_cast<unsigned int>(models[modelIndex]->updateAnimation(deltaTime * animationSpeed));
+    }
+    renderStatsPtr->animationTimeMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - animationStart).count();
+    renderStatsPtr->skinnedVertexCount = static_cast<unsigned int>(models[modelIndex]->getSkinnedVertexCount());
+  }
+
+  // local transform 이 바뀐 scene graph 노드들의 world transform 을 Mesh 들에 반영
+  renderStatsPtr->updatedSceneNodeCount += static_cast<unsigned int>(models[modelIndex]->updateTransforms());
+  renderStatsPtr->sceneNodeCount += static_cast<unsigned int>(models[modelIndex]->getSceneGraph().getNodeCount());
+
+  // 카메라 절두체 바깥에 있는 Mesh 들은 그리지 않도록 frustum culling 수행
+  models[modelIndex]->cull(transform, cameraFeaturePtr->getFrustum());
+
+  /*
+    카메라 투영 행렬로부터 거리 1 만큼 떨어진 물체의 크기를 pixel 단위로 변환하는 값을 계산하여
+    선택된 Model 의 각 Mesh 가 화면에 투영된 크기에 따라 그릴 LOD 선택
+  */
+  const glm::mat4 &projection = cameraFeaturePtr->getProjectionMatrix();
+  float projectionScale = projection[1][1] * static_cast<float>(LayoutConstants::WINDOW_HEIGHT_DEFAULT) * 0.5f;
+  models[modelIndex]->selectLods(transform, cameraFeaturePtr->getCameraPosition(), projectionScale);
+
+  // LOD 0 으로 그려질 Mesh 들은 meshlet 단위로 한번 더 frustum 및 backface culling 을 수행하고 소요 시간 측정
+  auto meshletCullStart = std::chrono::steady_clock::now();
+  MeshletCullStats meshletStats = models[modelIndex]->cullMeshlets(projection * cameraFeaturePtr->getViewMatrix(),
+                                                                    transform,
+                                                                    cameraFeaturePtr->getCameraPosition(),
+                                                                    threadPool);
+  renderStatsPtr->meshletCullTimeMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - meshletCullStart).count();
+  renderStatsPtr->meshletCount = static_cast<unsigned int>(meshletStats.meshletCount);
+  renderStatsPtr->culledMeshletCount = static_cast<unsigned int>(meshletStats.culledMeshletCount);
+  renderStatsPtr->meshletCulledTriangleCount = static_cast<unsigned int>(meshletStats.culledTriangleCount);
 
   // 선택된 Model 렌더링
-  models[modelIndex]->draw(*pbrShaderPtr);
+  renderStatsPtr->drawCallCount += models[modelIndex]->draw(pbrShader);
+
+  // 선택된 Model 의 BVH 통계 및 마지막 picking 결과
+  renderStatsPtr->bvhNodeCount = static_cast<unsigned int>(models[modelIndex]->getBvhNodeCount());
+  renderStatsPtr->bvhBuildTimeMs = models[modelIndex]->getBvhBuildTimeMs();
+  renderStatsPtr->bvhClosestHitMrays = bvhClosestHitMrays[modelIndex];
+  renderStatsPtr->bvhAnyHitMrays = bvhAnyHitMrays[modelIndex];
+  renderStatsPtr->pickedMeshIndex = pickResult.meshIndex;
+  renderStatsPtr->pickTimeMs = pickTimeMs;
+
+  // culling 결과 및 LOD 별로 그려진 mesh 및 삼각형 개수 집계
+  const auto &meshes = models[modelIndex]->meshes;
+  for (size_t i = 0; i < meshes.size(); i++)
+  {
+    if (!models[modelIndex]->isMeshVisible(i))
+    {
+      renderStatsPtr->culledMeshCount += 1;
+      continue;
+    }
+
+    const auto &mesh = meshes[i];
+    renderStatsPtr->submittedMeshCount += 1;
+
+    size_t lod = mesh->getCurrentLod();
+    renderStatsPtr->lodMeshCounts[lod] += 1;
+    renderStatsPtr->lodTriangleCounts[lod] += static_cast<unsigned int>(mesh->getDrawnTriangleCount());
+  }
+}
+
+void ModelFeature::processScene(Shader &pbrShader)
+{
+  const Frustum &frustum = cameraFeaturePtr->getFrustum();
+  const glm::vec3 &cameraPosition = cameraFeaturePtr->getCameraPosition();
+  const glm::mat4 &projection = cameraFeaturePtr->getProjectionMatrix();
+  float projectionScale = projection[1][1] * static_cast<float>(LayoutConstants::WINDOW_HEIGHT_DEFAULT) * 0.5f;
+
+  // 여러 오브젝트가 같은 Model 을 참조하므로, 노드 world transform 은 Model 마다 한번만 갱신
+  for (const auto &model : models)
+  {
+    renderStatsPtr->updatedSceneNodeCount += static_cast<unsigned int>(model->updateTransforms());
+  }
+
+  renderQueue.clear();
+  for (const SceneObject &object : sceneObjects)
+  {
+    const Model &model = *models[object.modelIndex];
+
+    /*
+      UI 로 입력받은 모델 행렬은 scene 전체에 적용
+
+      -> UI 의 scale 및 노드 transform 은 non-uniform scale 일 수 있으므로 노멀 행렬은 역전치 행렬로 구하되,
+      오브젝트마다 한번만 계산하고 Mesh 마다 미리 계산된 노드 노멀 행렬을 곱함. (역전치 행렬의 곱 = 곱의 역전치 행렬)
+    */
+    const glm::mat4 objectTransform = transform * object.transform;
+    const glm::mat3 objectNormalMatrix = glm::transpose(glm::inverse(glm::mat3(objectTransform)));
+
+    for (size_t i = 0; i < model.meshes.size(); i++)
+    {
+      // skinning Mesh 는 Model 의 bone palette UBO 를 연결하여 그려야 하므로 scene 에서는 그리지 않음
+      const Mesh<ModelVertexData> &mesh = *model.meshes[i];
+      if (mesh.isSkinned())
+      {
+        continue;
+      }
+
+      const glm::mat4 worldTransform = objectTransform * mesh.getNodeTransform();
+      if (!frustum.intersects(transformBoundingBox(mesh.getBoundingBox(), worldTransform)))
+      {
+        renderStatsPtr->culledMeshCount += 1;
+        continue;
+      }
+
+      /*
+        화면에 투영된 크기로 LOD 선택
+
+        -> 같은 Mesh 를 여러 오브젝트가 서로 다른 거리에서 그리므로 Mesh 에 이전 LOD 를 저장해둘 수 없어서
+        Model::selectLods() 와 달리 hysteresis 없이 경계값만으로 선택함.
+      */
+      BoundingSphere sphere = transformBoundingSphere(mesh.getBoundingSphere(), worldTransform);
+      float distance = glm::length(sphere.center - cameraPosition);
+      const std::vector<MeshLod> &lods = mesh.getLods();
+      size_t lod = 0;
+      if (distance > sphere.radius)
+      {
+        float screenSize = 2.0f * sphere.radius * projectionScale / distance;
+        while (lod + 1 < lods.size() && screenSize < ModelConstants::LOD_SCREEN_SIZES[lod + 1])
+        {
+          lod++;
+        }
+      }
+
+      const std::uint64_t key = RenderQueue::makeKey(0,
+                                                     object.material,
+                                                     RenderQueue::getTextureSetKey(mesh),
+                                                     meshIdOffsets[object.modelIndex] + static_cast<std::uint32_t>(i),
+                                                     distance / SceneConstants::SORT_DEPTH_RANGE);
+      renderQueue.submit(key, {&pbrShader, &mesh, lod, object.material, worldTransform, objectNormalMatrix * mesh.getNodeNormalMatrix()});
+
+      renderStatsPtr->submittedMeshCount += 1;
+      renderStatsPtr->lodMeshCounts[lod] += 1;
+      renderStatsPtr->lodTriangleCounts[lod] += static_cast<unsigned int>(lods[lod].indexCount / 3);
+    }
+  }
+
+  // 정렬에 걸린 CPU 시간 측정 후, 정렬된 순서대로 상태 변경을 최소화하며 그림
+  auto sortStart = std::chrono::steady_clock::now();
+  renderQueue.sort();
+  renderStatsPtr->renderQueueSortTimeMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - sortStart).count();
+
+  RenderQueueStats queueStats = renderQueue.flush(sceneMaterials, geometryArenas.get());
+  renderStatsPtr->sceneObjectCount = static_cast<unsigned int>(sceneObjects.size());
+  renderStatsPtr->renderQueueCommandCount = queueStats.commandCount;
+  renderStatsPtr->programBindCount = queueStats.programBindCount;
+  renderStatsPtr->materialBindCount = queueStats.materialBindCount;
+  renderStatsPtr->textureBindCount = queueStats.textureBindCount;
+  renderStatsPtr->drawCallCount += queueStats.drawCallCount;
+}
+
+void ModelFeature::buildScene()
+{
+  for (const auto &material : SceneConstants::materials)
+  {
+    sceneMaterials.push_back({material.albedo, material.metallic, material.roughness, material.ao});
+  }
+
+  /*
+    Model 마다 Mesh 들의 노드 transform 이 적용된 AABB 를 합쳐서 Model 전체의 AABB 를 구하고,
+    AABB 중심이 원점에 오고 AABB 를 감싸는 구의 반지름이 OBJECT_RADIUS 가 되도록 맞추는 행렬 계산
+  */
+  std::array<glm::mat4, ModelConstants::NUM_MODELS> normalizeTransforms;
+  std::uint32_t meshCount = 0;
+  for (int i = 0; i < ModelConstants::NUM_MODELS; i++)
+  {
+    meshIdOffsets[i] = meshCount;
+    meshCount += static_cast<std::uint32_t>(models[i]->meshes.size());
+
+    BoundingBox bounds;
+    bounds.min = glm::vec3(std::numeric_limits<float>::max());
+    bounds.max = glm::vec3(std::numeric_limits<float>::lowest());
+    for (const auto &mesh : models[i]->meshes)
+    {
+      BoundingBox box = transformBoundingBox(mesh->getBoundingBox(), mesh->getNodeTransform());
+      bounds.min = glm::min(bounds.min, box.min);
+      bounds.max = glm::max(bounds.max, box.max);
+    }
+
+    float radius = models[i]->meshes.empty() ? 0.0f : glm::length(bounds.max - bounds.min) * 0.5f;
+    float normalizeScale = radius > 0.0f ? SceneConstants::OBJECT_RADIUS / radius : 1.0f;
+    glm::vec3 center = models[i]->meshes.empty() ? glm::vec3(0.0f) : (bounds.min + bounds.max) * 0.5f;
+    normalizeTransforms[i] = glm::scale(glm::mat4(1.0f), glm::vec3(normalizeScale)) * glm::translate(glm::mat4(1.0f), -center);
+  }
+
+  /*
+    xz 평면 grid 의 각 칸에 오브젝트 배치
+
+    -> Model 과 material 을 서로 다른 주기로 돌려가며 배정하여, 제출 순서대로 그리면 인접한 오브젝트끼리
+    상태가 계속 바뀌도록 함 (정렬 전후의 상태 변경 횟수 차이를 확인하기 위함).
+  */
+  for (int row = 0; row < SceneConstants::GRID_ROWS; row++)
+  {
+    for (int column = 0; column < SceneConstants::GRID_COLUMNS; column++)
+    {
+      const int index = row * SceneConstants::GRID_COLUMNS + column;
+
+      glm::vec3 position((column - (SceneConstants::GRID_COLUMNS - 1) * 0.5f) * SceneConstants::GRID_SPACING,
+                         SceneConstants::GRID_HEIGHT,
+                         SceneConstants::GRID_FRONT_Z - row * SceneConstants::GRID_SPACING);
+
+      SceneObject object;
+      object.modelIndex = (row + column) % ModelConstants::NUM_MODELS;
+      object.material = static_cast<std::uint32_t>((column * 5 + row * 3) % SceneConstants::NUM_MATERIALS);
+      object.transform = glm::translate(glm::mat4(1.0f), position) *
+                         glm::rotate(glm::mat4(1.0f), glm::radians(SceneConstants::OBJECT_YAW_STEP * index), glm::vec3(0.0f, 1.0f, 0.0f)) *
+                         normalizeTransforms[object.modelIndex];
+      sceneObjects.push_back(object);
+    }
+  }
+
+  spdlog::info("Scene built with {} objects, {} materials, {} meshes", sceneObjects.size(), sceneMaterials.size(), meshCount);
 }
 
 void ModelFeature::finalize()
 {
-  pbrShaderPtr = nullptr;
+  pbrShadersPtr = nullptr;
+  cameraFeaturePtr = nullptr;
+  renderStatsPtr = nullptr;
 }
 
 void ModelFeature::onChange(const ModelParameter &param)
@@ -90,12 +479,37 @@ void ModelFeature::onChange(const ModelParameter &param)
     setModelIndex(param.modelIndex);
   }
 
+  if (animate != param.animate)
+  {
+    setAnimate(param.animate);
+  }
+
+  if (animationSpeed != param.animationSpeed)
+  {
+    setAnimationSpeed(param.animationSpeed);
+  }
+
+  if (sceneEnabled != param.sceneEnabled)
+  {
+    setSceneEnabled(param.sceneEnabled);
+  }
+
   modelParameter = param;
 }
 
-void ModelFeature::setPbrShader(std::shared_ptr<Shader> pbrShader)
+void ModelFeature::setPbrShaders(PbrShaderVariants *pbrShaders)
+{
+  pbrShadersPtr = pbrShaders;
+}
+
+void ModelFeature::setCameraFeature(CameraFeature *cameraFeature)
+{
+  cameraFeaturePtr = cameraFeature;
+}
+
+void ModelFeature::setRenderStats(RenderStats *renderStats)
 {
-  pbrShaderPtr = pbrShader;
+  renderStatsPtr = renderStats;
 }
 
 void ModelFeature::getModelParameter(ModelParameter &param) const
@@ -103,6 +517,45 @@ void ModelFeature::getModelParameter(ModelParameter &param) const
   param = modelParameter;
 }
 
+void ModelFeature::pick(float x, float y)
+{
+  // picking 은 선택된 Model 하나를 대상으로 하므로 scene 을 그리는 중에는 수행하지 않음
+  if (sceneEnabled)
+  {
+    return;
+  }
+
+  /*
+    커서 위치를 NDC 로 변환한 뒤 near plane 과 far plane 위의 두 점을 world space 로 역변환하여 카메라 광선 생성
+
+    -> 윈도우 좌표는 y 축이 아래를 향하므로 NDC 로 변환할 때 뒤집음.
+    -> 가장 최근 process() 에서 계산된 카메라 행렬 및 모델 행렬을 사용함.
+  */
+  const glm::mat4 inverseViewProjection = glm::inverse(cameraFeaturePtr->getProjectionMatrix() * cameraFeaturePtr->getViewMatrix());
+  const glm::vec2 ndc(x * 2.0f - 1.0f, 1.0f - y * 2.0f);
+  const glm::vec4 nearPoint = inverseViewProjection * glm::vec4(ndc, -1.0f, 1.0f);
+  const glm::vec4 farPoint = inverseViewProjection * glm::vec4(ndc, 1.0f, 1.0f);
+
+  BvhRay ray;
+  ray.origin = glm::vec3(nearPoint) / nearPoint.w;
+  ray.direction = glm::vec3(farPoint) / farPoint.w - ray.origin;
+
+  auto pickStart = std::chrono::steady_clock::now();
+  bool picked = models[modelIndex]->pick(ray, transform, pickResult);
+  pickTimeMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - pickStart).count();
+
+  if (picked)
+  {
+    spdlog::info("Picked mesh <{}> triangle {} at ({:.3f}, {:.3f}, {:.3f}) in {:.3f} ms",
+                 models[modelIndex]->meshes[pickResult.meshIndex]->getName(),
+                 pickResult.triangle,
+                 pickResult.position.x,
+                 pickResult.position.y,
+                 pickResult.position.z,
+                 pickTimeMs);
+  }
+}
+
 void ModelFeature::setPosition(const glm::vec3 &position)
 {
   this->position = position;
@@ -121,4 +574,22 @@ void ModelFeature::setScale(const glm::vec3 &scale)
 void ModelFeature::setModelIndex(const int modelIndex)
 {
   this->modelIndex = modelIndex;
+
+  // 이전 Model 의 Mesh 인덱스를 가리키는 picking 결과 초기화
+  pickResult = ModelPickResult();
+}
+
+void ModelFeature::setAnimate(const bool animate)
+{
+  this->animate = animate;
+}
+
+void ModelFeature::setAnimationSpeed(const float animationSpeed)
+{
+  this->animationSpeed = animationSpeed;
+}
+
+void ModelFeature::setSceneEnabled(const bool sceneEnabled)
+{
+  this->sceneEnabled = sceneEnabled;
 }
@@ -1,5 +1,7 @@
 #include <stdexcept>
 #include <string>
+#include <chrono>
+#include <spdlog/spdlog.h>
 
 // 행렬 및 벡터 계산에서 사용할 Header Only 라이브러리 include
 #include <glm/gtc/matrix_transform.hpp>
@@ -10,8 +12,16 @@
 #include "gl_context/gl_context.hpp"
 
 OffscreenRenderingFeature::OffscreenRenderingFeature()
-    : pbrShaderPtr(nullptr),
-      backgroundShaderPtr(nullptr)
+    : pbrShadersPtr(nullptr),
+      backgroundShaderPtr(nullptr),
+      equirectangularToCubemapShaderPtr(std::make_unique<Shader>("cubemap.vs", "equirectangular_to_cubemap.fs")),
+      irradianceShaderPtr(std::make_unique<Shader>("cubemap.vs", "irradiance_convolution.fs")),
+      prefilterShaderPtr(std::make_unique<Shader>("cubemap.vs", "prefilter.fs")),
+      brdfShaderPtr(std::make_unique<Shader>("brdf.vs", "brdf.fs")),
+      envCubemapsDirty(false),
+      irradianceMapsDirty(false),
+      prefilterMapsDirty(false),
+      brdfLUTTextureDirty(false)
 {
   /** 각 offscreen rendering 텍스쳐 버퍼 객체 초기화 */
   for (int i = 0; i < OffscreenRenderingConstants::NUM_HDR_IMAGES; i++)
@@ -23,7 +33,7 @@ OffscreenRenderingFeature::OffscreenRenderingFeature()
     hdrTextures[i] = std::make_unique<Texture>(hdrImages[i], GL_RGB16F, GL_RGB);
 
     /** HDR 이미지 텍스쳐를 Cubemap 형태로 변환할 color buffer 로써 Cubemap 텍스쳐 객체 생성 */
-    envCubemaps[i] = std::make_unique<CubeTexture>(512, 512, GL_RGB16F, GL_RGB);
+    envCubemaps[i] = std::make_unique<CubeTexture>(512, 512, GL_RGB16F, GL_RGB, OffscreenRenderingConstants::ENV_CUBEMAP_MIP_LEVELS);
     envCubemaps[i]->setMinFilter(GL_LINEAR_MIPMAP_LINEAR);
 
     /**  diffuse term 적분식의 결과값(= irradiance)를 렌더링할 color buffer 로써 Cubemap 텍스쳐 객체 생성 */
@@ -33,10 +43,11 @@ OffscreenRenderingFeature::OffscreenRenderingFeature()
      * split-sum approximation(= specular term 적분식)에서
      * 첫 번째 적분식의 결과값(= pre-filtered environment map)를 렌더링할 color buffer 로써
      * Cubemap 텍스쳐 객체 생성
+     *
+     * -> roughness 단계별로 렌더링할 mip level 메모리까지 생성 시 할당되므로, 렌더링 전에 generateMipmap() 을 호출하지 않음.
      */
-    prefilterMaps[i] = std::make_unique<CubeTexture>(128, 128, GL_RGB16F, GL_RGB);
+    prefilterMaps[i] = std::make_unique<CubeTexture>(128, 128, GL_RGB16F, GL_RGB, OffscreenRenderingConstants::PREFILTER_MAP_MIP_LEVELS);
     prefilterMaps[i]->setMinFilter(GL_LINEAR_MIPMAP_LINEAR);
-    prefilterMaps[i]->generateMipmap();
   }
 
   /**
@@ -77,19 +88,20 @@ void OffscreenRenderingFeature::initialize()
   // Cubemap 의 각 face 사이의 seam line 방지 활성화 (하단 필기 참고)
   glContext.enable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
 
-  /* 각 구체에 공통으로 적용할 PBR Parameter 들을 쉐이더 프로그램에 전송 */
+  /* 각 구체에 공통으로 적용할 PBR Parameter 들을 쉐이더 프로그램에 전송 (이후에 생성되는 pbr 쉐이더 변형에도 적용됨) */
+  pbrShadersPtr->getCache().addProgramInitializer([](Shader &pbrShader)
+                                                  {
+    // PBR 쉐이더 프로그램 바인딩
+    pbrShader.use();
 
-  // PBR 쉐이더 프로그램 바인딩
-  pbrShaderPtr->use();
+    // irradiance map 큐브맵 텍스쳐를 바인딩할 0번 texture unit 위치값 전송
+    pbrShader.setInt("irradianceMap", OffscreenRenderingConstants::PBRShader::IRRADIANCE_MAP_UNIT);
 
-  // irradiance map 큐브맵 텍스쳐를 바인딩할 0번 texture unit 위치값 전송
-  pbrShaderPtr->setInt("irradianceMap", OffscreenRenderingConstants::PBRShader::IRRADIANCE_MAP_UNIT);
+    // pre-filtered env map 큐브맵 텍스쳐를 바인딩할 1번 texture unit 위치값 전송
+    pbrShader.setInt("prefilterMap", OffscreenRenderingConstants::PBRShader::PREFILTER_MAP_UNIT);
 
-  // pre-filtered env map 큐브맵 텍스쳐를 바인딩할 1번 texture unit 위치값 전송
-  pbrShaderPtr->setInt("prefilterMap", OffscreenRenderingConstants::PBRShader::PREFILTER_MAP_UNIT);
-
-  // BRDF Integration map 텍스쳐를 바인딩할 2번 texture unit 위치값 전송
-  pbrShaderPtr->setInt("brdfLUT", OffscreenRenderingConstants::PBRShader::BRDF_LUT_UNIT);
+    // BRDF Integration map 텍스쳐를 바인딩할 2번 texture unit 위치값 전송
+    pbrShader.setInt("brdfLUT", OffscreenRenderingConstants::PBRShader::BRDF_LUT_UNIT); });
 
   /* skybox 에 적용할 uniform 변수들을 쉐이더 프로그램에 전송 */
 
@@ -109,17 +121,44 @@ void OffscreenRenderingFeature::initialize()
 
 void OffscreenRenderingFeature::process()
 {
+  /*
+    reload 가 끝난 쉐이더를 사용하는 텍스쳐 버퍼와, 그 텍스쳐 버퍼를 입력으로 사용하는 이후 단계들을 다시 렌더링하도록 표시
+
+    -> irradiance map 과 pre-filtered env map 은 env cubemap 을 샘플링하므로 env cubemap 이 바뀌면 함께 다시 렌더링함.
+  */
+  const ShaderReloadResult envCubemapResult = equirectangularToCubemapShaderPtr->pollReload();
+  const ShaderReloadResult irradianceMapResult = irradianceShaderPtr->pollReload();
+  const ShaderReloadResult prefilterMapResult = prefilterShaderPtr->pollReload();
+  const ShaderReloadResult brdfLUTTextureResult = brdfShaderPtr->pollReload();
+
+  if (envCubemapResult == ShaderReloadResult::Swapped)
+  {
+    envCubemapsDirty = irradianceMapsDirty = prefilterMapsDirty = true;
+  }
+  irradianceMapsDirty = irradianceMapsDirty || irradianceMapResult == ShaderReloadResult::Swapped;
+  prefilterMapsDirty = prefilterMapsDirty || prefilterMapResult == ShaderReloadResult::Swapped;
+  brdfLUTTextureDirty = brdfLUTTextureDirty || brdfLUTTextureResult == ShaderReloadResult::Swapped;
+
+  // cubemap.vs 처럼 여러 쉐이더가 공유하는 소스가 바뀌면, 모든 reload 가 끝난 뒤 한번만 다시 렌더링
+  const bool reloadPending = envCubemapResult == ShaderReloadResult::Pending ||
+                             irradianceMapResult == ShaderReloadResult::Pending ||
+                             prefilterMapResult == ShaderReloadResult::Pending ||
+                             brdfLUTTextureResult == ShaderReloadResult::Pending;
+  if (!reloadPending)
+  {
+    regenerateDirtyTextures();
+  }
 }
 
 void OffscreenRenderingFeature::finalize()
 {
-  pbrShaderPtr = nullptr;
+  pbrShadersPtr = nullptr;
   backgroundShaderPtr = nullptr;
 }
 
-void OffscreenRenderingFeature::setPbrShader(std::shared_ptr<Shader> pbrShader)
+void OffscreenRenderingFeature::setPbrShaders(PbrShaderVariants *pbrShaders)
 {
-  pbrShaderPtr = pbrShader;
+  pbrShadersPtr = pbrShaders;
 }
 
 void OffscreenRenderingFeature::setBackgroundShader(std::shared_ptr<Shader> backgroundShader)
@@ -127,6 +166,17 @@ void OffscreenRenderingFeature::setBackgroundShader(std::shared_ptr<Shader> back
   backgroundShaderPtr = backgroundShader;
 }
 
+void OffscreenRenderingFeature::beginShaderReload(std::string_view fileName)
+{
+  for (Shader *shader : {equirectangularToCubemapShaderPtr.get(), irradianceShaderPtr.get(), prefilterShaderPtr.get(), brdfShaderPtr.get()})
+  {
+    if (shader->usesSource(fileName))
+    {
+      shader->beginReload();
+    }
+  }
+}
+
 void OffscreenRenderingFeature::useEnvCubemap(const int index)
 {
   // envCubemaps 컨테이너에 유효한 인덱스가 아닌 경우 예외 처리
@@ -179,6 +229,50 @@ Quad &OffscreenRenderingFeature::getQuad()
   return quad;
 }
 
+void OffscreenRenderingFeature::regenerateDirtyTextures()
+{
+  if (!envCubemapsDirty && !irradianceMapsDirty && !prefilterMapsDirty && !brdfLUTTextureDirty)
+  {
+    return;
+  }
+
+  auto regenerateStart = std::chrono::steady_clock::now();
+
+  // 렌더링 루프 도중이므로, 각 단계가 변경하는 viewport 를 다시 렌더링을 마친 뒤 원래 해상도로 복원
+  GLint viewport[4];
+  glGetIntegerv(GL_VIEWPORT, viewport);
+
+  std::string regenerated;
+  if (envCubemapsDirty)
+  {
+    generateEnvCubemap();
+    regenerated += "env cubemap ";
+  }
+  if (irradianceMapsDirty)
+  {
+    generateIrradianceMap();
+    regenerated += "irradiance map ";
+  }
+  if (prefilterMapsDirty)
+  {
+    generatePrefilterMap();
+    regenerated += "pre-filtered env map ";
+  }
+  if (brdfLUTTextureDirty)
+  {
+    generateBRDFLUTTexture();
+    regenerated += "BRDF LUT ";
+  }
+
+  GLContext::getInstance().resize(viewport[2], viewport[3]);
+
+  envCubemapsDirty = irradianceMapsDirty = prefilterMapsDirty = brdfLUTTextureDirty = false;
+
+  spdlog::info("IBL textures regenerated : {}({:.1f} ms)",
+               regenerated,
+               std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - regenerateStart).count());
+}
+
 void OffscreenRenderingFeature::generateEnvCubemap()
 {
   // GLContext 싱글턴 인스턴스 접근
@@ -196,8 +290,8 @@ void OffscreenRenderingFeature::generateEnvCubemap()
   // FBO 객체에 생성한 RBO 객체 attach
   captureFBO.attachRenderBuffer(captureRBO.getID());
 
-  // 단위 큐브에 적용한 HDR 이미지를 Cubemap 버퍼에 렌더링하는 쉐이더 객체 생성
-  Shader equirectangularToCubemapShader("resources/shaders/cubemap.vs", "resources/shaders/equirectangular_to_cubemap.fs");
+  // 단위 큐브에 적용한 HDR 이미지를 Cubemap 버퍼에 렌더링하는 쉐이더 객체 (생성자에서 컴파일 및 링크를 제출해 둠)
+  Shader &equirectangularToCubemapShader = *equirectangularToCubemapShaderPtr;
 
   /* equirectangularToCubemapShader 에 텍스쳐 및 행렬 전달 */
 
@@ -260,8 +354,8 @@ void OffscreenRenderingFeature::generateIrradianceMap()
   // Renderbuffer 해상도를 Cubemap 각 면의 해상도인 32 * 32 로 맞춤.
   captureRBO.setStorage(32, 32);
 
-  // HDR 큐브맵을 샘플링하여 계산한 diffuse term 적분식의 결과값(= irradiance)을 새로운 Cubemap 버퍼에 렌더링하는 쉐이더 객체 생성
-  Shader irradianceShader("resources/shaders/cubemap.vs", "resources/shaders/irradiance_convolution.fs");
+  // HDR 큐브맵을 샘플링하여 계산한 diffuse term 적분식의 결과값(= irradiance)을 새로운 Cubemap 버퍼에 렌더링하는 쉐이더 객체 (생성자에서 컴파일 및 링크를 제출해 둠)
+  Shader &irradianceShader = *irradianceShaderPtr;
 
   /* irradianceShader 에 텍스쳐 및 행렬 전달 */
 
@@ -314,9 +408,9 @@ void OffscreenRenderingFeature::generatePrefilterMap()
 
   /*
     HDR 큐브맵을 샘플링하여 계산한 split sum approximation 의 첫 번째 적분식의 결과값(= pre-filtered env map)을
-    roughness level 에 따라 5단계의 mipmap 메모리 공간이 할당된 Cubemap 버퍼에 렌더링하는 쉐이더 객체 생성
+    roughness level 에 따라 5단계의 mipmap 메모리 공간이 할당된 Cubemap 버퍼에 렌더링하는 쉐이더 객체 (생성자에서 컴파일 및 링크를 제출해 둠)
   */
-  Shader prefilterShader("resources/shaders/cubemap.vs", "resources/shaders/prefilter.fs");
+  Shader &prefilterShader = *prefilterShaderPtr;
 
   /* prefilterShader 에 텍스쳐 및 행렬 전달 */
 
@@ -338,8 +432,8 @@ void OffscreenRenderingFeature::generatePrefilterMap()
     // HDR 큐브맵 텍스쳐를 0번 texture unit 에 바인딩하여 사용
     envCubemaps[textureIndex]->use(GL_TEXTURE0 + OffscreenRenderingConstants::PrefilterShader::ENVIRONMENT_MAP_UNIT);
 
-    // 최대 mip level 변수 초기화
-    unsigned int maxMipLevels = 5;
+    // 최대 mip level 변수 초기화 (생성자에서 할당한 mip level 개수와 같음)
+    unsigned int maxMipLevels = OffscreenRenderingConstants::PREFILTER_MAP_MIP_LEVELS;
 
     // 각 mip level 을 순회하며 Cubemap 버퍼에 pre-filtered env map 렌더링
     for (unsigned int mip = 0; mip < maxMipLevels; mip++)
@@ -413,8 +507,8 @@ void OffscreenRenderingFeature::generateBRDFLUTTexture()
   // BRDF Integration map 의 해상도에 맞춰 viewport 해상도 설정
   glContext.resize(512, 512);
 
-  // split sum approximation 의 두 번째 적분식의 결과값(= BRDF Integration map)을 LUTTexture 버퍼에 렌더링하는 쉐이더 객체 생성
-  Shader brdfShader("resources/shaders/brdf.vs", "resources/shaders/brdf.fs");
+  // split sum approximation 의 두 번째 적분식의 결과값(= BRDF Integration map)을 LUTTexture 버퍼에 렌더링하는 쉐이더 객체 (생성자에서 컴파일 및 링크를 제출해 둠)
+  Shader &brdfShader = *brdfShaderPtr;
 
   // brdfShader 쉐이더 바인딩
   brdfShader.use();
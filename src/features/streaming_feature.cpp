@@ -0,0 +1,242 @@
+#include "features/streaming_feature.hpp"
+#include "streaming/chunked_mesh_writer.hpp"
+#include <spdlog/spdlog.h>
+#include <glm/gtc/matrix_transform.hpp> // 행렬 변환 관련 함수
+#include <filesystem>
+#include <stdexcept>
+
+StreamingFeature::StreamingFeature()
+    : pbrShadersPtr(nullptr),
+      cameraFeaturePtr(nullptr),
+      renderStatsPtr(nullptr),
+      enabled(StreamingConstants::ENABLED_DEFAULT),
+      memoryBudgetIndex(StreamingConstants::MEMORY_BUDGET_INDEX_DEFAULT),
+      streamRadius(StreamingConstants::STREAM_RADIUS_DEFAULT),
+      transform(glm::translate(glm::mat4(1.0f), StreamingConstants::POSITION)),
+      openFailed(false),
+      conversionRunning(false),
+      conversionSucceeded(false),
+      conversionCancelRequested(false)
+{
+}
+
+StreamingFeature::~StreamingFeature()
+{
+  stopConversion();
+}
+
+void StreamingFeature::initialize()
+{
+  // StreamingUi 에서 관리되는 각 ImGui 요소에 입력할 초기값 설정
+  streamingParameter.enabled = StreamingConstants::ENABLED_DEFAULT;
+  streamingParameter.memoryBudgetIndex = StreamingConstants::MEMORY_BUDGET_INDEX_DEFAULT;
+  streamingParameter.streamRadius = StreamingConstants::STREAM_RADIUS_DEFAULT;
+}
+
+void StreamingFeature::process()
+{
+  if (!enabled)
+  {
+    return;
+  }
+
+  if (!streamingMesh && !openFailed)
+  {
+    openStreamingMesh();
+  }
+
+  if (!streamingMesh)
+  {
+    return;
+  }
+
+  /*
+    chunk 의 bounding volume 은 object space 기준이므로,
+    카메라 위치와 절두체를 object space 로 변환하여 chunk 선택 및 culling 에 사용함.
+  */
+  const glm::mat4 viewProjection = cameraFeaturePtr->getProjectionMatrix() * cameraFeaturePtr->getViewMatrix();
+  const glm::vec3 localCameraPosition = glm::vec3(glm::inverse(transform) * glm::vec4(cameraFeaturePtr->getCameraPosition(), 1.0f));
+
+  streamingMesh->update(localCameraPosition);
+
+  ShaderVariant &pbrVariant = pbrShadersPtr->acquire(false);
+  Shader &pbrShader = *pbrVariant.shader;
+  pbrShader.use();
+  pbrShader.setMat4("model", transform);
+  pbrShader.setMat3("normalMatrix", glm::transpose(glm::inverse(glm::mat3(transform))));
+
+  pbrShadersPtr->getCache().beginGpuTimer(pbrVariant);
+  renderStatsPtr->drawCallCount += streamingMesh->draw(Frustum(viewProjection * transform));
+  pbrShadersPtr->getCache().endGpuTimer();
+
+  // chunk 상주 현황 집계
+  const StreamingStats &stats = streamingMesh->getStats();
+  renderStatsPtr->streamingChunkCount = static_cast<unsigned int>(stats.chunkCount);
+  renderStatsPtr->streamingResidentChunkCount = static_cast<unsigned int>(stats.residentChunkCount);
+  renderStatsPtr->streamingLoadingChunkCount = static_cast<unsigned int>(stats.loadingChunkCount);
+  renderStatsPtr->streamingDrawnChunkCount = static_cast<unsigned int>(stats.drawnChunkCount);
+  renderStatsPtr->streamingResidentBytes = stats.residentBytes + stats.loadingBytes;
+  renderStatsPtr->streamingMemoryBudget = StreamingConstants::MEMORY_BUDGETS[memoryBudgetIndex].bytes;
+  renderStatsPtr->streamingUploadedBytes = stats.uploadedBytes;
+}
+
+void StreamingFeature::finalize()
+{
+  stopConversion();
+  streamingMesh.reset();
+
+  pbrShadersPtr = nullptr;
+  cameraFeaturePtr = nullptr;
+  renderStatsPtr = nullptr;
+}
+
+void StreamingFeature::onChange(const StreamingParameter &param)
+{
+  if (enabled != param.enabled)
+  {
+    setEnabled(param.enabled);
+  }
+
+  if (memoryBudgetIndex != param.memoryBudgetIndex)
+  {
+    setMemoryBudgetIndex(param.memoryBudgetIndex);
+  }
+
+  if (streamRadius != param.streamRadius)
+  {
+    setStreamRadius(param.streamRadius);
+  }
+
+  streamingParameter = param;
+}
+
+void StreamingFeature::setPbrShaders(PbrShaderVariants *pbrShaders)
+{
+  pbrShadersPtr = pbrShaders;
+}
+
+void StreamingFeature::setCameraFeature(CameraFeature *cameraFeature)
+{
+  cameraFeaturePtr = cameraFeature;
+}
+
+void StreamingFeature::setRenderStats(RenderStats *renderStats)
+{
+  renderStatsPtr = renderStats;
+}
+
+void StreamingFeature::getStreamingParameter(StreamingParameter &param) const
+{
+  param = streamingParameter;
+}
+
+void StreamingFeature::openStreamingMesh()
+{
+  // 변환 중이면 렌더 스레드를 막지 않고 다음 프레임에 다시 확인
+  if (conversionThread.joinable())
+  {
+    if (conversionRunning)
+    {
+      renderStatsPtr->streamingConverting = true;
+      return;
+    }
+
+    conversionThread.join();
+    if (!conversionSucceeded)
+    {
+      openFailed = true;
+      return;
+    }
+  }
+  else if (!std::filesystem::exists(StreamingConstants::CHUNKED_MESH_PATH))
+  {
+    // 변환은 원본 모델 전체를 읽어야 하므로 파일이 없을 때 한번만 수행
+    startConversion();
+    renderStatsPtr->streamingConverting = true;
+    return;
+  }
+
+  try
+  {
+    streamingMesh = std::make_unique<StreamingMesh>(StreamingConstants::CHUNKED_MESH_PATH,
+                                                    StreamingConstants::MEMORY_BUDGETS[memoryBudgetIndex].bytes,
+                                                    StreamingConstants::NUM_IO_THREADS);
+    applyParameters();
+  }
+  catch (const std::exception &e)
+  {
+    spdlog::error("Failed to open streaming mesh: {}", e.what());
+    openFailed = true;
+  }
+}
+
+void StreamingFeature::startConversion()
+{
+  spdlog::info("Converting <{}> to chunked mesh in background", StreamingConstants::SOURCE_MODEL_PATH);
+
+  conversionRunning = true;
+  conversionSucceeded = false;
+  conversionCancelRequested = false;
+  conversionThread = std::thread([this]()
+                                 {
+                                   try
+                                   {
+                                     conversionSucceeded = ChunkedMeshWriter::convert(StreamingConstants::SOURCE_MODEL_PATH,
+                                                                                      StreamingConstants::CHUNKED_MESH_PATH,
+                                                                                      StreamingConstants::CHUNK_MAX_TRIANGLES,
+                                                                                      StreamingConstants::CONVERSION_IN_MEMORY_TRIANGLES,
+                                                                                      StreamingConstants::CONVERSION_BATCH_TRIANGLES,
+                                                                                      &conversionCancelRequested);
+                                   }
+                                   catch (const std::exception &e)
+                                   {
+                                     spdlog::error("Failed to convert streaming mesh: {}", e.what());
+                                   }
+                                   conversionRunning = false;
+                                 });
+}
+
+void StreamingFeature::stopConversion()
+{
+  if (conversionThread.joinable())
+  {
+    conversionCancelRequested = true;
+    conversionThread.join();
+  }
+}
+
+void StreamingFeature::applyParameters()
+{
+  if (!streamingMesh)
+  {
+    return;
+  }
+
+  // stream radius 는 chunk 파일 전체 bounding box 의 대각선 길이 대비 비율이므로 object space 거리로 변환
+  const BoundingBox &bounds = streamingMesh->getBounds();
+  streamingMesh->setStreamRadius(streamRadius * glm::length(bounds.max - bounds.min));
+  streamingMesh->setMemoryBudget(StreamingConstants::MEMORY_BUDGETS[memoryBudgetIndex].bytes);
+}
+
+void StreamingFeature::setEnabled(const bool enabled)
+{
+  this->enabled = enabled;
+
+  // 비활성화되면 상주하던 chunk 들과 I/O 스레드를 모두 정리하여 메모리를 반납
+  if (!enabled)
+  {
+    streamingMesh.reset();
+  }
+}
+
+void StreamingFeature::setMemoryBudgetIndex(const int memoryBudgetIndex)
+{
+  this->memoryBudgetIndex = memoryBudgetIndex;
+  applyParameters();
+}
+
+void StreamingFeature::setStreamRadius(const float streamRadius)
+{
+  this->streamRadius = streamRadius;
+  applyParameters();
+}
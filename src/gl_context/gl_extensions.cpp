@@ -0,0 +1,181 @@
+#include "gl_context/gl_extensions.hpp"
+#include "constants/gl_object_constants.hpp"
+#include <spdlog/spdlog.h>
+
+// 정적 멤버 초기화
+int GLExtensions::majorVersion = 0;
+int GLExtensions::minorVersion = 0;
+GLExtensions::MultiDrawElementsIndirectProc GLExtensions::multiDrawElementsIndirect = nullptr;
+GLExtensions::GetProgramBinaryProc GLExtensions::getProgramBinary = nullptr;
+GLExtensions::ProgramBinaryProc GLExtensions::programBinary = nullptr;
+GLExtensions::ProgramParameteriProc GLExtensions::programParameteri = nullptr;
+GLExtensions::MaxShaderCompilerThreadsProc GLExtensions::maxShaderCompilerThreads = nullptr;
+GLExtensions::TexStorage2DProc GLExtensions::texStorage2D = nullptr;
+GLExtensions::CreateTexturesProc GLExtensions::createTextures = nullptr;
+GLExtensions::TextureParameteriProc GLExtensions::textureParameteri = nullptr;
+GLExtensions::GenerateTextureMipmapProc GLExtensions::generateTextureMipmap = nullptr;
+GLExtensions::BindTextureUnitProc GLExtensions::bindTextureUnit = nullptr;
+GLExtensions::TextureStorage2DProc GLExtensions::textureStorage2D = nullptr;
+GLExtensions::TextureSubImage2DProc GLExtensions::textureSubImage2D = nullptr;
+GLExtensions::CreateBuffersProc GLExtensions::createBuffers = nullptr;
+GLExtensions::NamedBufferDataProc GLExtensions::namedBufferData = nullptr;
+GLExtensions::NamedBufferSubDataProc GLExtensions::namedBufferSubData = nullptr;
+GLExtensions::MapNamedBufferRangeProc GLExtensions::mapNamedBufferRange = nullptr;
+GLExtensions::UnmapNamedBufferProc GLExtensions::unmapNamedBuffer = nullptr;
+GLExtensions::CopyNamedBufferSubDataProc GLExtensions::copyNamedBufferSubData = nullptr;
+GLExtensions::CreateVertexArraysProc GLExtensions::createVertexArrays = nullptr;
+GLExtensions::VertexArrayVertexBufferProc GLExtensions::vertexArrayVertexBuffer = nullptr;
+GLExtensions::VertexArrayElementBufferProc GLExtensions::vertexArrayElementBuffer = nullptr;
+GLExtensions::VertexArrayAttribFormatProc GLExtensions::vertexArrayAttribFormat = nullptr;
+GLExtensions::VertexArrayAttribIFormatProc GLExtensions::vertexArrayAttribIFormat = nullptr;
+GLExtensions::VertexArrayAttribBindingProc GLExtensions::vertexArrayAttribBinding = nullptr;
+GLExtensions::EnableVertexArrayAttribProc GLExtensions::enableVertexArrayAttrib = nullptr;
+GLExtensions::VertexArrayBindingDivisorProc GLExtensions::vertexArrayBindingDivisor = nullptr;
+
+void GLExtensions::load(GLADloadproc loadProc)
+{
+  glGetIntegerv(GL_MAJOR_VERSION, &majorVersion);
+  glGetIntegerv(GL_MINOR_VERSION, &minorVersion);
+
+  spdlog::info("OpenGL {}.{} ({})", majorVersion, minorVersion, reinterpret_cast<const char *>(glGetString(GL_RENDERER)));
+
+  // multi draw indirect 는 per-draw 데이터를 baseInstance 로 읽어야 하므로 ARB_base_instance 도 함께 지원되어야 함
+  if (isVersionSupported(4, 3) || (isExtensionSupported("GL_ARB_multi_draw_indirect") && isExtensionSupported("GL_ARB_base_instance")))
+  {
+    multiDrawElementsIndirect = reinterpret_cast<MultiDrawElementsIndirectProc>(loadProc("glMultiDrawElementsIndirect"));
+  }
+
+  spdlog::info("Multi draw indirect : {}", hasMultiDrawIndirect() ? "supported" : "not supported");
+
+  /*
+    프로그램 바이너리 캐시는 드라이버가 지원하는 바이너리 포맷이 하나 이상 있어야 사용할 수 있음.
+
+    -> 확장을 지원하더라도 포맷 개수가 0 이면 (ex> 일부 software GL 구현) glGetProgramBinary() 로 꺼낼 바이너리가 없음.
+  */
+  if (isVersionSupported(4, 1) || isExtensionSupported("GL_ARB_get_program_binary"))
+  {
+    GLint numBinaryFormats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numBinaryFormats);
+    if (numBinaryFormats > 0)
+    {
+      getProgramBinary = reinterpret_cast<GetProgramBinaryProc>(loadProc("glGetProgramBinary"));
+      programBinary = reinterpret_cast<ProgramBinaryProc>(loadProc("glProgramBinary"));
+      programParameteri = reinterpret_cast<ProgramParameteriProc>(loadProc("glProgramParameteri"));
+    }
+  }
+
+  spdlog::info("Program binary : {}", hasProgramBinary() ? "supported" : "not supported");
+
+  /*
+    KHR 확장과 ARB 확장은 함수 이름의 접미사만 다르고 동작은 같으므로, 지원하는 쪽의 함수를 로드함.
+
+    -> 0xFFFFFFFF 를 전달하면 드라이버가 정한 최대 개수의 스레드로 쉐이더를 컴파일함.
+  */
+  if (isExtensionSupported("GL_KHR_parallel_shader_compile"))
+  {
+    maxShaderCompilerThreads = reinterpret_cast<MaxShaderCompilerThreadsProc>(loadProc("glMaxShaderCompilerThreadsKHR"));
+  }
+  else if (isExtensionSupported("GL_ARB_parallel_shader_compile"))
+  {
+    maxShaderCompilerThreads = reinterpret_cast<MaxShaderCompilerThreadsProc>(loadProc("glMaxShaderCompilerThreadsARB"));
+  }
+
+  if (hasParallelShaderCompile())
+  {
+    maxShaderCompilerThreads(0xFFFFFFFF);
+  }
+
+  spdlog::info("Parallel shader compile : {}", hasParallelShaderCompile() ? "supported" : "not supported");
+
+  if (isVersionSupported(4, 2) || isExtensionSupported("GL_ARB_texture_storage"))
+  {
+    texStorage2D = reinterpret_cast<TexStorage2DProc>(loadProc("glTexStorage2D"));
+  }
+
+  spdlog::info("Texture storage : {}", hasTextureStorage() ? "supported" : "not supported");
+
+  /*
+    Direct State Access 함수들은 모든 GL 객체가 생성되기 전에 한번만 로드함.
+
+    -> DSA 함수는 glCreate*() 로 생성된 객체에만 사용할 수 있으므로 (glGen*() 로 예약만 된 이름은 아직 객체가 아님),
+    객체 생성과 설정이 모두 같은 경로를 사용하도록 프로그램 실행 중에는 사용 여부가 바뀌지 않아야 함.
+  */
+  if (GLObjectConstants::DIRECT_STATE_ACCESS_ENABLED && (isVersionSupported(4, 5) || isExtensionSupported("GL_ARB_direct_state_access")))
+  {
+    createTextures = reinterpret_cast<CreateTexturesProc>(loadProc("glCreateTextures"));
+    textureParameteri = reinterpret_cast<TextureParameteriProc>(loadProc("glTextureParameteri"));
+    generateTextureMipmap = reinterpret_cast<GenerateTextureMipmapProc>(loadProc("glGenerateTextureMipmap"));
+    bindTextureUnit = reinterpret_cast<BindTextureUnitProc>(loadProc("glBindTextureUnit"));
+    textureStorage2D = reinterpret_cast<TextureStorage2DProc>(loadProc("glTextureStorage2D"));
+    textureSubImage2D = reinterpret_cast<TextureSubImage2DProc>(loadProc("glTextureSubImage2D"));
+
+    createBuffers = reinterpret_cast<CreateBuffersProc>(loadProc("glCreateBuffers"));
+    namedBufferData = reinterpret_cast<NamedBufferDataProc>(loadProc("glNamedBufferData"));
+    namedBufferSubData = reinterpret_cast<NamedBufferSubDataProc>(loadProc("glNamedBufferSubData"));
+    mapNamedBufferRange = reinterpret_cast<MapNamedBufferRangeProc>(loadProc("glMapNamedBufferRange"));
+    unmapNamedBuffer = reinterpret_cast<UnmapNamedBufferProc>(loadProc("glUnmapNamedBuffer"));
+    copyNamedBufferSubData = reinterpret_cast<CopyNamedBufferSubDataProc>(loadProc("glCopyNamedBufferSubData"));
+
+    createVertexArrays = reinterpret_cast<CreateVertexArraysProc>(loadProc("glCreateVertexArrays"));
+    vertexArrayVertexBuffer = reinterpret_cast<VertexArrayVertexBufferProc>(loadProc("glVertexArrayVertexBuffer"));
+    vertexArrayElementBuffer = reinterpret_cast<VertexArrayElementBufferProc>(loadProc("glVertexArrayElementBuffer"));
+    vertexArrayAttribFormat = reinterpret_cast<VertexArrayAttribFormatProc>(loadProc("glVertexArrayAttribFormat"));
+    vertexArrayAttribIFormat = reinterpret_cast<VertexArrayAttribIFormatProc>(loadProc("glVertexArrayAttribIFormat"));
+    vertexArrayAttribBinding = reinterpret_cast<VertexArrayAttribBindingProc>(loadProc("glVertexArrayAttribBinding"));
+    enableVertexArrayAttrib = reinterpret_cast<EnableVertexArrayAttribProc>(loadProc("glEnableVertexArrayAttrib"));
+    vertexArrayBindingDivisor = reinterpret_cast<VertexArrayBindingDivisorProc>(loadProc("glVertexArrayBindingDivisor"));
+  }
+
+  spdlog::info("Direct state access : {}", hasDirectStateAccess() ? "supported" : (GLObjectConstants::DIRECT_STATE_ACCESS_ENABLED ? "not supported" : "disabled"));
+}
+
+bool GLExtensions::isVersionSupported(int major, int minor)
+{
+  return majorVersion > major || (majorVersion == major && minorVersion >= minor);
+}
+
+bool GLExtensions::isExtensionSupported(const std::string &name)
+{
+  GLint numExtensions = 0;
+  glGetIntegerv(GL_NUM_EXTENSIONS, &numExtensions);
+
+  for (GLint i = 0; i < numExtensions; i++)
+  {
+    const char *extension = reinterpret_cast<const char *>(glGetStringi(GL_EXTENSIONS, i));
+    if (extension && name == extension)
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool GLExtensions::hasMultiDrawIndirect()
+{
+  return multiDrawElementsIndirect != nullptr;
+}
+
+bool GLExtensions::hasProgramBinary()
+{
+  return getProgramBinary != nullptr && programBinary != nullptr && programParameteri != nullptr;
+}
+
+bool GLExtensions::hasParallelShaderCompile()
+{
+  return maxShaderCompilerThreads != nullptr;
+}
+
+bool GLExtensions::hasTextureStorage()
+{
+  return texStorage2D != nullptr;
+}
+
+bool GLExtensions::hasDirectStateAccess()
+{
+  // 일부 함수만 로드된 경우 DSA 경로와 bind 경로가 섞이지 않도록 모든 함수가 로드되었을 때만 사용
+  return createTextures && textureParameteri && generateTextureMipmap && bindTextureUnit && textureStorage2D && textureSubImage2D &&
+         createBuffers && namedBufferData && namedBufferSubData && mapNamedBufferRange && unmapNamedBuffer && copyNamedBufferSubData &&
+         createVertexArrays && vertexArrayVertexBuffer && vertexArrayElementBuffer && vertexArrayAttribFormat &&
+         vertexArrayAttribIFormat && vertexArrayAttribBinding && enableVertexArrayAttrib && vertexArrayBindingDivisor;
+}
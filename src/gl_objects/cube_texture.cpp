@@ -1,36 +1,81 @@
 #include "gl_objects/cube_texture.hpp"
+#include "gl_context/gl_extensions.hpp"
+#include "common/gl_call_counter.hpp"
 #include <stdexcept>
 #include <string>
+#include <algorithm>
 
-CubeTexture::CubeTexture(GLsizei width, GLsizei height, GLenum format, GLenum internalFormat)
-    : width(width), height(height), format(format), internalFormat(internalFormat)
+CubeTexture::CubeTexture(GLsizei width, GLsizei height, GLenum format, GLenum internalFormat, GLsizei levels)
+    : width(width), height(height), format(format), internalFormat(internalFormat), levels(levels)
 {
-  // 텍스쳐 객체 생성 및 바인딩
-  glGenTextures(1, &ID);
+  // 텍스쳐 객체 생성 (DSA 함수는 glCreateTextures() 로 생성된 객체에만 사용할 수 있음)
+  if (GLExtensions::hasDirectStateAccess())
+  {
+    GLExtensions::createTextures(GL_TEXTURE_CUBE_MAP, 1, &ID);
+  }
+  else
+  {
+    glGenTextures(1, &ID);
+  }
+  GLCallCounter::add(1);
 
-  bind();
+  /*
+    Cubemap 텍스쳐 또한 [0, 1] 범위를 넘어선 HDR 이미지 데이터(data)들을 온전히 저장하기 위해,
 
-  // 반복문을 순회하며 Cubemap 각 6면에 이미지 데이터를 저장할 메모리 할당
-  for (unsigned int i = 0; i < 6; i++)
+    GL_RGB16F floating point(부동 소수점) 포맷으로 Cubemap 6면의 levels 개 mip level 메모리를 한번에 할당
+    (하단 Floating point framebuffer 관련 필기 참고)
+  */
+  if (GLExtensions::hasDirectStateAccess())
   {
-    /*
-      Cubemap 텍스쳐 또한 [0, 1] 범위를 넘어선 HDR 이미지 데이터(data)들을 온전히 저장하기 위해,
-
-      GL_RGB16F floating point(부동 소수점) 포맷으로 프레임버퍼의 내부 색상 포맷 지정
-      (하단 Floating point framebuffer 관련 필기 참고)
-    */
-    glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, format, width, height, 0, internalFormat, GL_FLOAT, nullptr);
+    GLExtensions::textureStorage2D(ID, levels, format, width, height);
+    GLCallCounter::add(1);
+  }
+  else
+  {
+    bind();
+
+    if (GLExtensions::hasTextureStorage())
+    {
+      // Cubemap 텍스쳐는 GL_TEXTURE_CUBE_MAP 타겟으로 한번 할당하면 6면이 모두 할당됨
+      GLExtensions::texStorage2D(GL_TEXTURE_CUBE_MAP, levels, format, width, height);
+      GLCallCounter::add(1);
+    }
+    else
+    {
+      // immutable 할당을 지원하지 않으면 반복문을 순회하며 Cubemap 각 6면의 mip level 마다 메모리를 할당하고, 할당한 level 까지만 사용하도록 최대 level 을 제한
+      for (GLsizei level = 0; level < levels; level++)
+      {
+        for (unsigned int i = 0; i < 6; i++)
+        {
+          glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, level, format, std::max(width >> level, 1), std::max(height >> level, 1), 0, internalFormat, GL_FLOAT, nullptr);
+        }
+      }
+      glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAX_LEVEL, levels - 1);
+      GLCallCounter::add(static_cast<size_t>(levels) * 6 + 1);
+    }
   }
 
-  // 현재 GL_TEXTURE_CUBE_MAP 상태에 바인딩된 텍스쳐 객체 설정하기
-  // CubeTexture Wrapping 모드를 반복 모드로 설정 ([(0, 0), (1, 1)] 범위를 벗어나는 텍스쳐 좌표에 대한 처리)
-  glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-  glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-  glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-
-  // 텍스쳐 축소/확대 및 Mipmap 교체 시 CubeTexture Filtering (텍셀 필터링(보간)) 모드 설정
-  glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, minFilter);
-  glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, magFilter);
+  if (GLExtensions::hasDirectStateAccess())
+  {
+    GLExtensions::textureParameteri(ID, GL_TEXTURE_WRAP_S, wrapS);
+    GLExtensions::textureParameteri(ID, GL_TEXTURE_WRAP_T, wrapT);
+    GLExtensions::textureParameteri(ID, GL_TEXTURE_WRAP_R, wrapR);
+    GLExtensions::textureParameteri(ID, GL_TEXTURE_MIN_FILTER, minFilter);
+    GLExtensions::textureParameteri(ID, GL_TEXTURE_MAG_FILTER, magFilter);
+  }
+  else
+  {
+    // 현재 GL_TEXTURE_CUBE_MAP 상태에 바인딩된 텍스쳐 객체 설정하기
+    // CubeTexture Wrapping 모드를 반복 모드로 설정 ([(0, 0), (1, 1)] 범위를 벗어나는 텍스쳐 좌표에 대한 처리)
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, wrapS);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, wrapT);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, wrapR);
+
+    // 텍스쳐 축소/확대 및 Mipmap 교체 시 CubeTexture Filtering (텍셀 필터링(보간)) 모드 설정
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, minFilter);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, magFilter);
+  }
+  GLCallCounter::add(5);
 }
 
 CubeTexture::~CubeTexture()
@@ -41,21 +86,33 @@ CubeTexture::~CubeTexture()
 void CubeTexture::bind() const
 {
   glBindTexture(GL_TEXTURE_CUBE_MAP, ID);
+  GLCallCounter::add(1);
 }
 
 void CubeTexture::unbind() const
 {
   glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+  GLCallCounter::add(1);
 }
 
 void CubeTexture::destroy()
 {
   glDeleteTextures(1, &ID);
+  GLCallCounter::add(1);
 }
 
 void CubeTexture::use(GLenum textureUnit) const
 {
+  // DSA 를 지원하면 활성 texture unit 을 바꾸지 않고 해당 unit 에 바로 바인딩
+  if (GLExtensions::hasDirectStateAccess())
+  {
+    GLExtensions::bindTextureUnit(textureUnit - GL_TEXTURE0, ID);
+    GLCallCounter::add(1);
+    return;
+  }
+
   glActiveTexture(textureUnit);
+  GLCallCounter::add(1);
 
   bind();
 }
@@ -64,55 +121,35 @@ void CubeTexture::setWrapS(GLint wrapMode)
 {
   wrapS = wrapMode;
 
-  bind();
-
-  glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, wrapS);
-
-  unbind();
+  setParameter(GL_TEXTURE_WRAP_S, wrapS);
 }
 
 void CubeTexture::setWrapT(GLint wrapMode)
 {
   wrapT = wrapMode;
 
-  bind();
-
-  glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, wrapT);
-
-  unbind();
+  setParameter(GL_TEXTURE_WRAP_T, wrapT);
 }
 
 void CubeTexture::setWrapR(GLint wrapMode)
 {
   wrapR = wrapMode;
 
-  bind();
-
-  glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, wrapR);
-
-  unbind();
+  setParameter(GL_TEXTURE_WRAP_R, wrapR);
 }
 
 void CubeTexture::setMinFilter(GLint filterMode)
 {
   minFilter = filterMode;
 
-  bind();
-
-  glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, minFilter);
-
-  unbind();
+  setParameter(GL_TEXTURE_MIN_FILTER, minFilter);
 }
 
 void CubeTexture::setMagFilter(GLint filterMode)
 {
   magFilter = filterMode;
 
-  bind();
-
-  glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, magFilter);
-
-  unbind();
+  setParameter(GL_TEXTURE_MAG_FILTER, magFilter);
 }
 
 GLuint CubeTexture::getID() const
@@ -120,11 +157,42 @@ GLuint CubeTexture::getID() const
   return ID;
 }
 
+GLsizei CubeTexture::getLevels() const
+{
+  return levels;
+}
+
 void CubeTexture::generateMipmap()
 {
+  if (GLExtensions::hasDirectStateAccess())
+  {
+    GLExtensions::generateTextureMipmap(ID);
+    GLCallCounter::add(1);
+    return;
+  }
+
   bind();
 
   glGenerateMipmap(GL_TEXTURE_CUBE_MAP);
+  GLCallCounter::add(1);
+
+  unbind();
+}
+
+void CubeTexture::setParameter(GLenum name, GLint value)
+{
+  // DSA 를 지원하면 바인딩 없이 설정하므로, 호출하는 쪽에서 바인딩해 둔 텍스쳐가 해제되지 않음
+  if (GLExtensions::hasDirectStateAccess())
+  {
+    GLExtensions::textureParameteri(ID, name, value);
+    GLCallCounter::add(1);
+    return;
+  }
+
+  bind();
+
+  glTexParameteri(GL_TEXTURE_CUBE_MAP, name, value);
+  GLCallCounter::add(1);
 
   unbind();
 }
@@ -0,0 +1,46 @@
+#include "gl_objects/fence_object.hpp"
+
+FenceObject::FenceObject()
+    : sync(nullptr)
+{
+}
+
+FenceObject::~FenceObject()
+{
+  destroy();
+}
+
+bool FenceObject::isSignaled() const
+{
+  if (!sync)
+  {
+    return true;
+  }
+
+  // timeout 을 0 으로 지정하여 대기하지 않고 현재 상태만 확인
+  GLenum result = glClientWaitSync(sync, 0, 0);
+  return result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED;
+}
+
+void FenceObject::bind() const
+{
+  if (sync)
+  {
+    glDeleteSync(sync);
+  }
+
+  sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+void FenceObject::unbind() const
+{
+}
+
+void FenceObject::destroy()
+{
+  if (sync)
+  {
+    glDeleteSync(sync);
+    sync = nullptr;
+  }
+}
@@ -1,9 +1,21 @@
 #include "gl_objects/index_buffer_object.hpp"
+#include "gl_context/gl_extensions.hpp"
+#include "common/gl_call_counter.hpp"
 #include <stdexcept>
+#include <cstring>
 
 IndexBufferObject::IndexBufferObject()
 {
-  glGenBuffers(1, &ID);
+  // DSA 함수는 glCreateBuffers() 로 생성된 객체에만 사용할 수 있음 (glGenBuffers() 는 바인딩 전까지 이름만 예약함)
+  if (GLExtensions::hasDirectStateAccess())
+  {
+    GLExtensions::createBuffers(1, &ID);
+  }
+  else
+  {
+    glGenBuffers(1, &ID);
+  }
+  GLCallCounter::add(1);
 
   if (ID == 0)
   {
@@ -23,13 +35,111 @@ void IndexBufferObject::setData(const void *data, GLsizeiptr size, GLenum usage)
     throw std::runtime_error("IBO not initialized.");
   }
 
+  if (GLExtensions::hasDirectStateAccess())
+  {
+    GLExtensions::namedBufferData(ID, size, data, usage);
+    GLCallCounter::add(1);
+    return;
+  }
+
   bind();
 
   glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, data, usage);
+  GLCallCounter::add(1);
+
+  unbind();
+}
+
+void IndexBufferObject::setSubData(GLintptr offset, const void *data, GLsizeiptr size)
+{
+  if (ID == 0)
+  {
+    throw std::runtime_error("IBO not initialized.");
+  }
+
+  if (GLExtensions::hasDirectStateAccess())
+  {
+    GLExtensions::namedBufferSubData(ID, offset, size, data);
+    GLCallCounter::add(1);
+    return;
+  }
+
+  bind();
+
+  glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, size, data);
+  GLCallCounter::add(1);
 
   unbind();
 }
 
+void IndexBufferObject::setSubDataUnsynchronized(GLintptr offset, const void *data, GLsizeiptr size)
+{
+  if (ID == 0)
+  {
+    throw std::runtime_error("IBO not initialized.");
+  }
+
+  const GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+
+  if (GLExtensions::hasDirectStateAccess())
+  {
+    void *mapped = GLExtensions::mapNamedBufferRange(ID, offset, size, access);
+    GLCallCounter::add(1);
+    if (!mapped)
+    {
+      throw std::runtime_error("Failed to map IBO range.");
+    }
+
+    std::memcpy(mapped, data, static_cast<size_t>(size));
+    GLExtensions::unmapNamedBuffer(ID);
+    GLCallCounter::add(1);
+    return;
+  }
+
+  // 복사 전용 바인딩 지점에 매핑하여 VAO 에 연결된 버퍼 바인딩 상태에 영향을 주지 않음
+  glBindBuffer(GL_COPY_WRITE_BUFFER, ID);
+
+  void *mapped = glMapBufferRange(GL_COPY_WRITE_BUFFER, offset, size, access);
+  GLCallCounter::add(2);
+  if (!mapped)
+  {
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    GLCallCounter::add(1);
+    throw std::runtime_error("Failed to map IBO range.");
+  }
+
+  std::memcpy(mapped, data, static_cast<size_t>(size));
+  glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+
+  glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+  GLCallCounter::add(2);
+}
+
+void IndexBufferObject::copySubData(const IndexBufferObject &source, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+  if (ID == 0 || source.getID() == 0)
+  {
+    throw std::runtime_error("IBO not initialized.");
+  }
+
+  if (GLExtensions::hasDirectStateAccess())
+  {
+    GLExtensions::copyNamedBufferSubData(source.getID(), ID, readOffset, writeOffset, size);
+    GLCallCounter::add(1);
+    return;
+  }
+
+  // 복사 전용 바인딩 지점을 사용하여 다른 바인딩 상태(VAO 에 연결된 버퍼 등)에 영향을 주지 않음
+  glBindBuffer(GL_COPY_READ_BUFFER, source.getID());
+  glBindBuffer(GL_COPY_WRITE_BUFFER, ID);
+
+  glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, readOffset, writeOffset, size);
+
+  glBindBuffer(GL_COPY_READ_BUFFER, 0);
+  glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+  GLCallCounter::add(5);
+}
+
 GLuint IndexBufferObject::getID() const
 {
   return ID;
@@ -38,11 +148,13 @@ GLuint IndexBufferObject::getID() const
 void IndexBufferObject::bind() const
 {
   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ID);
+  GLCallCounter::add(1);
 }
 
 void IndexBufferObject::unbind() const
 {
   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+  GLCallCounter::add(1);
 }
 
 void IndexBufferObject::destroy()
@@ -50,6 +162,7 @@ void IndexBufferObject::destroy()
   if (ID != 0)
   {
     glDeleteBuffers(1, &ID);
+    GLCallCounter::add(1);
     ID = 0;
   }
 }
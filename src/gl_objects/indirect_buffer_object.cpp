@@ -0,0 +1,77 @@
+#include "gl_objects/indirect_buffer_object.hpp"
+#include "gl_context/gl_extensions.hpp"
+#include "common/gl_call_counter.hpp"
+#include <stdexcept>
+
+IndirectBufferObject::IndirectBufferObject()
+{
+  // DSA 함수는 glCreateBuffers() 로 생성된 객체에만 사용할 수 있음 (glGenBuffers() 는 바인딩 전까지 이름만 예약함)
+  if (GLExtensions::hasDirectStateAccess())
+  {
+    GLExtensions::createBuffers(1, &ID);
+  }
+  else
+  {
+    glGenBuffers(1, &ID);
+  }
+  GLCallCounter::add(1);
+
+  if (ID == 0)
+  {
+    throw std::runtime_error("Failed to generate indirect buffer.");
+  }
+}
+
+IndirectBufferObject::~IndirectBufferObject()
+{
+  destroy();
+}
+
+void IndirectBufferObject::setData(const void *data, GLsizeiptr size, GLenum usage)
+{
+  if (ID == 0)
+  {
+    throw std::runtime_error("Indirect buffer not initialized.");
+  }
+
+  if (GLExtensions::hasDirectStateAccess())
+  {
+    GLExtensions::namedBufferData(ID, size, data, usage);
+    GLCallCounter::add(1);
+    return;
+  }
+
+  bind();
+
+  glBufferData(GL_DRAW_INDIRECT_BUFFER, size, data, usage);
+  GLCallCounter::add(1);
+
+  unbind();
+}
+
+GLuint IndirectBufferObject::getID() const
+{
+  return ID;
+}
+
+void IndirectBufferObject::bind() const
+{
+  glBindBuffer(GL_DRAW_INDIRECT_BUFFER, ID);
+  GLCallCounter::add(1);
+}
+
+void IndirectBufferObject::unbind() const
+{
+  glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+  GLCallCounter::add(1);
+}
+
+void IndirectBufferObject::destroy()
+{
+  if (ID != 0)
+  {
+    glDeleteBuffers(1, &ID);
+    GLCallCounter::add(1);
+    ID = 0;
+  }
+}
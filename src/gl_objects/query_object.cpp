@@ -0,0 +1,68 @@
+#include "gl_objects/query_object.hpp"
+#include <stdexcept>
+
+QueryObject::QueryObject(GLenum target)
+    : target(target), issued(false)
+{
+  glGenQueries(1, &ID);
+
+  if (ID == 0)
+  {
+    throw std::runtime_error("Failed to generate query object.");
+  }
+}
+
+QueryObject::~QueryObject()
+{
+  destroy();
+}
+
+bool QueryObject::isResultAvailable() const
+{
+  if (!issued)
+  {
+    return false;
+  }
+
+  GLint available = GL_FALSE;
+  glGetQueryObjectiv(ID, GL_QUERY_RESULT_AVAILABLE, &available);
+  return available == GL_TRUE;
+}
+
+GLuint64 QueryObject::getResult() const
+{
+  GLuint64 result = 0;
+  glGetQueryObjectui64v(ID, GL_QUERY_RESULT, &result);
+  return result;
+}
+
+GLuint QueryObject::getID() const
+{
+  return ID;
+}
+
+void QueryObject::bind() const
+{
+  glBeginQuery(target, ID);
+  issued = true;
+}
+
+void QueryObject::unbind() const
+{
+  glEndQuery(target);
+}
+
+void QueryObject::recordTimestamp() const
+{
+  glQueryCounter(ID, GL_TIMESTAMP);
+  issued = true;
+}
+
+void QueryObject::destroy()
+{
+  if (ID != 0)
+  {
+    glDeleteQueries(1, &ID);
+    ID = 0;
+  }
+}
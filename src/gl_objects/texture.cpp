@@ -1,4 +1,6 @@
 #include "gl_objects/texture.hpp"
+#include "gl_context/gl_extensions.hpp"
+#include "common/gl_call_counter.hpp"
 
 // 이미지 파일 로드 라이브러리 include (관련 설명 하단 참고)
 #define STB_IMAGE_IMPLEMENTATION
@@ -7,6 +9,7 @@
 #include <spdlog/spdlog.h>
 #include <stdexcept>
 #include <string>
+#include <algorithm>
 
 Texture::Texture(const char *url)
 {
@@ -21,43 +24,36 @@ Texture::Texture(const char *url)
 
   if (data)
   {
-    // 텍스쳐 객체 생성 및 바인딩
-    glGenTextures(1, &ID);
+    // 텍스쳐 객체 생성
+    create();
 
-    bind();
+    /*
+      이미지 데이터의 색상 채널 개수에 따라 텍스쳐의 내부 포맷 및 넘겨줄 픽셀 데이터 포맷의 ENUM 값을 결정
 
-    // 이미지 데이터의 색상 채널 개수에 따라 glTexImage2D() 에 넘겨줄 픽셀 데이터 포맷의 ENUM 값을 결정
+      -> immutable 메모리 할당(glTexStorage2D())은 크기가 명시된(sized) 내부 포맷만 허용하므로,
+      채널당 8 bits 로 저장하는 sized 포맷을 사용함. (GL_RGB 처럼 크기를 명시하지 않았을 때 드라이버가 사용하던 크기와 같음)
+    */
     if (nrComponents == 1)
     {
-      format = GL_RED;
+      format = GL_R8;
       internalFormat = GL_RED;
     }
     else if (nrComponents == 3)
     {
-      format = GL_RGB;
+      format = GL_RGB8;
       internalFormat = GL_RGB;
     }
     else if (nrComponents == 4)
     {
-      format = GL_RGBA;
+      format = GL_RGBA8;
       internalFormat = GL_RGBA;
     }
 
-    /*
-      [0, 1] 범위를 넘어선 HDR 이미지 데이터(data)들을 온전히 저장하기 위해,
-      GL_RGB16F floating point(부동 소수점) 포맷으로 프레임버퍼의 내부 색상 포맷 지정
-      (하단 Floating point framebuffer 관련 필기 참고)
-    */
-    glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, internalFormat, GL_FLOAT, data);
-
-    // 현재 GL_TEXTURE_2D 상태에 바인딩된 텍스쳐 객체 설정하기
-    // Texture Wrapping 모드를 반복 모드로 설정 ([(0, 0), (1, 1)] 범위를 벗어나는 텍스쳐 좌표에 대한 처리)
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrapS);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrapT);
+    // 텍스쳐 메모리 할당 및 이미지 데이터 전달
+    allocate(data);
 
-    // 텍스쳐 축소/확대 및 Mipmap 교체 시 Texture Filtering (텍셀 필터링(보간)) 모드 설정
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minFilter);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, magFilter);
+    // 텍스쳐 Wrapping 및 Filtering 모드 설정
+    applyParameters();
 
     // 텍스쳐 객체에 이미지 데이터를 전달하고, 밉맵까지 생성 완료했다면, 로드한 이미지 데이터는 항상 메모리 해제할 것!
     stbi_image_free(data);
@@ -82,26 +78,18 @@ Texture::Texture(const char *url, GLenum format, GLenum internalFormat)
 
   if (data)
   {
-    // 텍스쳐 객체 생성 및 바인딩
-    glGenTextures(1, &ID);
-
-    bind();
+    // 텍스쳐 객체 생성
+    create();
 
     /*
       [0, 1] 범위를 넘어선 HDR 이미지 데이터(data)들을 온전히 저장하기 위해,
-      GL_RGB16F floating point(부동 소수점) 포맷으로 프레임버퍼의 내부 색상 포맷 지정
+      GL_RGB16F floating point(부동 소수점) 포맷으로 메모리를 할당하고 이미지 데이터 전달
       (하단 Floating point framebuffer 관련 필기 참고)
     */
-    glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, internalFormat, GL_FLOAT, data);
-
-    // 현재 GL_TEXTURE_2D 상태에 바인딩된 텍스쳐 객체 설정하기
-    // Texture Wrapping 모드를 반복 모드로 설정 ([(0, 0), (1, 1)] 범위를 벗어나는 텍스쳐 좌표에 대한 처리)
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrapS);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrapT);
+    allocate(data);
 
-    // 텍스쳐 축소/확대 및 Mipmap 교체 시 Texture Filtering (텍셀 필터링(보간)) 모드 설정
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minFilter);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, magFilter);
+    // 텍스쳐 Wrapping 및 Filtering 모드 설정
+    applyParameters();
 
     // 텍스쳐 객체에 이미지 데이터를 전달하고, 밉맵까지 생성 완료했다면, 로드한 이미지 데이터는 항상 메모리 해제할 것!
     stbi_image_free(data);
@@ -112,29 +100,21 @@ Texture::Texture(const char *url, GLenum format, GLenum internalFormat)
   }
 }
 
-Texture::Texture(GLsizei width, GLsizei height, GLenum format, GLenum internalFormat)
-    : width(width), height(height), format(format), internalFormat(internalFormat)
+Texture::Texture(GLsizei width, GLsizei height, GLenum format, GLenum internalFormat, GLsizei levels)
+    : width(width), height(height), format(format), internalFormat(internalFormat), levels(levels)
 {
-  // 텍스쳐 객체 생성 및 바인딩
-  glGenTextures(1, &ID);
-
-  bind();
+  // 텍스쳐 객체 생성
+  create();
 
   /*
     [0, 1] 범위를 넘어선 HDR 이미지 데이터(data)들을 온전히 저장하기 위해,
-    GL_RGB16F floating point(부동 소수점) 포맷으로 프레임버퍼의 내부 색상 포맷 지정
+    GL_RGB16F floating point(부동 소수점) 포맷으로 levels 개의 mip level 메모리 할당
     (하단 Floating point framebuffer 관련 필기 참고)
   */
-  glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, internalFormat, GL_FLOAT, nullptr);
-
-  // 현재 GL_TEXTURE_2D 상태에 바인딩된 텍스쳐 객체 설정하기
-  // Texture Wrapping 모드를 반복 모드로 설정 ([(0, 0), (1, 1)] 범위를 벗어나는 텍스쳐 좌표에 대한 처리)
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrapS);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrapT);
+  allocate(nullptr);
 
-  // 텍스쳐 축소/확대 및 Mipmap 교체 시 Texture Filtering (텍셀 필터링(보간)) 모드 설정
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minFilter);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, magFilter);
+  // 텍스쳐 Wrapping 및 Filtering 모드 설정
+  applyParameters();
 }
 
 Texture::~Texture()
@@ -146,21 +126,33 @@ Texture::~Texture()
 void Texture::bind() const
 {
   glBindTexture(GL_TEXTURE_2D, ID);
+  GLCallCounter::add(1);
 }
 
 void Texture::unbind() const
 {
   glBindTexture(GL_TEXTURE_2D, 0);
+  GLCallCounter::add(1);
 }
 
 void Texture::destroy()
 {
   glDeleteTextures(1, &ID);
+  GLCallCounter::add(1);
 }
 
 void Texture::use(GLenum textureUnit) const
 {
+  // DSA 를 지원하면 활성 texture unit 을 바꾸지 않고 해당 unit 에 바로 바인딩
+  if (GLExtensions::hasDirectStateAccess())
+  {
+    GLExtensions::bindTextureUnit(textureUnit - GL_TEXTURE0, ID);
+    GLCallCounter::add(1);
+    return;
+  }
+
   glActiveTexture(textureUnit);
+  GLCallCounter::add(1);
 
   bind();
 }
@@ -169,44 +161,28 @@ void Texture::setWrapS(GLint wrapMode)
 {
   wrapS = wrapMode;
 
-  bind();
-
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrapS);
-
-  unbind();
+  setParameter(GL_TEXTURE_WRAP_S, wrapS);
 }
 
 void Texture::setWrapT(GLint wrapMode)
 {
   wrapT = wrapMode;
 
-  bind();
-
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrapT);
-
-  unbind();
+  setParameter(GL_TEXTURE_WRAP_T, wrapT);
 }
 
 void Texture::setMinFilter(GLint filterMode)
 {
   minFilter = filterMode;
 
-  bind();
-
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minFilter);
-
-  unbind();
+  setParameter(GL_TEXTURE_MIN_FILTER, minFilter);
 }
 
 void Texture::setMagFilter(GLint filterMode)
 {
   magFilter = filterMode;
 
-  bind();
-
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, magFilter);
-
-  unbind();
+  setParameter(GL_TEXTURE_MAG_FILTER, magFilter);
 }
 
 GLuint Texture::getID() const
@@ -214,11 +190,181 @@ GLuint Texture::getID() const
   return ID;
 }
 
+GLsizei Texture::getWidth() const
+{
+  return width;
+}
+
+GLsizei Texture::getHeight() const
+{
+  return height;
+}
+
+size_t Texture::getByteSize() const
+{
+  // 텍스쳐 객체의 내부 포맷(멤버 format 에 저장됨)별 texel 하나의 크기
+  // (GL_RGB 처럼 크기가 명시되지 않은 포맷은 드라이버가 채널당 8 bits 로 저장한다고 가정)
+  size_t texelSize = 4;
+  switch (format)
+  {
+  case GL_RED:
+  case GL_R8:
+    texelSize = 1;
+    break;
+  case GL_RG:
+  case GL_RG8:
+  case GL_R16F:
+    texelSize = 2;
+    break;
+  case GL_RGB:
+  case GL_RGB8:
+    texelSize = 3;
+    break;
+  case GL_RG16F:
+  case GL_R32F:
+    texelSize = 4;
+    break;
+  case GL_RGB16F:
+    texelSize = 6;
+    break;
+  case GL_RGBA16F:
+  case GL_RG32F:
+    texelSize = 8;
+    break;
+  case GL_RGB32F:
+    texelSize = 12;
+    break;
+  case GL_RGBA32F:
+    texelSize = 16;
+    break;
+  }
+
+  // 할당된 mip level 마다 가로, 세로 해상도가 절반씩 줄어듦
+  size_t byteSize = 0;
+  for (GLsizei level = 0; level < levels; level++)
+  {
+    byteSize += static_cast<size_t>(std::max(width >> level, 1)) * static_cast<size_t>(std::max(height >> level, 1)) * texelSize;
+  }
+  return byteSize;
+}
+
+GLsizei Texture::getLevels() const
+{
+  return levels;
+}
+
 void Texture::generateMipmap()
 {
+  if (GLExtensions::hasDirectStateAccess())
+  {
+    GLExtensions::generateTextureMipmap(ID);
+    GLCallCounter::add(1);
+  }
+  else
+  {
+    bind();
+
+    glGenerateMipmap(GL_TEXTURE_2D);
+    GLCallCounter::add(1);
+
+    unbind();
+  }
+}
+
+void Texture::create()
+{
+  // DSA 함수는 glCreateTextures() 로 생성된 객체에만 사용할 수 있음 (glGenTextures() 는 바인딩 전까지 이름만 예약함)
+  if (GLExtensions::hasDirectStateAccess())
+  {
+    GLExtensions::createTextures(GL_TEXTURE_2D, 1, &ID);
+  }
+  else
+  {
+    glGenTextures(1, &ID);
+  }
+  GLCallCounter::add(1);
+}
+
+void Texture::allocate(const float *data)
+{
+  /*
+    DSA 를 지원하면 바인딩 없이 immutable 메모리를 할당하고,
+    immutable 할당만 지원하면 바인딩한 뒤 할당함. (할당 이후의 파라미터 설정을 위해 바인딩 상태를 유지)
+  */
+  if (GLExtensions::hasDirectStateAccess())
+  {
+    GLExtensions::textureStorage2D(ID, levels, format, width, height);
+    GLCallCounter::add(1);
+
+    if (data)
+    {
+      GLExtensions::textureSubImage2D(ID, 0, 0, 0, width, height, internalFormat, GL_FLOAT, data);
+      GLCallCounter::add(1);
+    }
+    return;
+  }
+
+  bind();
+
+  if (GLExtensions::hasTextureStorage())
+  {
+    GLExtensions::texStorage2D(GL_TEXTURE_2D, levels, format, width, height);
+    GLCallCounter::add(1);
+
+    if (data)
+    {
+      glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, internalFormat, GL_FLOAT, data);
+      GLCallCounter::add(1);
+    }
+    return;
+  }
+
+  // immutable 할당을 지원하지 않으면 mip level 마다 메모리를 할당하고, 할당한 level 까지만 사용하도록 최대 level 을 제한
+  for (GLsizei level = 0; level < levels; level++)
+  {
+    glTexImage2D(GL_TEXTURE_2D, level, format, std::max(width >> level, 1), std::max(height >> level, 1), 0, internalFormat, GL_FLOAT, level == 0 ? data : nullptr);
+  }
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levels - 1);
+  GLCallCounter::add(static_cast<size_t>(levels) + 1);
+}
+
+void Texture::applyParameters()
+{
+  if (GLExtensions::hasDirectStateAccess())
+  {
+    GLExtensions::textureParameteri(ID, GL_TEXTURE_WRAP_S, wrapS);
+    GLExtensions::textureParameteri(ID, GL_TEXTURE_WRAP_T, wrapT);
+    GLExtensions::textureParameteri(ID, GL_TEXTURE_MIN_FILTER, minFilter);
+    GLExtensions::textureParameteri(ID, GL_TEXTURE_MAG_FILTER, magFilter);
+  }
+  else
+  {
+    // 현재 GL_TEXTURE_2D 상태에 바인딩된 텍스쳐 객체 설정하기
+    // Texture Wrapping 모드를 반복 모드로 설정 ([(0, 0), (1, 1)] 범위를 벗어나는 텍스쳐 좌표에 대한 처리)
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrapS);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrapT);
+
+    // 텍스쳐 축소/확대 및 Mipmap 교체 시 Texture Filtering (텍셀 필터링(보간)) 모드 설정
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minFilter);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, magFilter);
+  }
+  GLCallCounter::add(4);
+}
+
+void Texture::setParameter(GLenum name, GLint value)
+{
+  // DSA 를 지원하면 바인딩 없이 설정하므로, 호출하는 쪽에서 바인딩해 둔 텍스쳐가 해제되지 않음
+  if (GLExtensions::hasDirectStateAccess())
+  {
+    GLExtensions::textureParameteri(ID, name, value);
+    GLCallCounter::add(1);
+    return;
+  }
+
   bind();
 
-  glGenerateMipmap(GL_TEXTURE_2D);
+  glTexParameteri(GL_TEXTURE_2D, name, value);
+  GLCallCounter::add(1);
 
   unbind();
 }
@@ -0,0 +1,152 @@
+#include "gl_objects/texture_cache.hpp"
+
+#include <spdlog/spdlog.h>
+#include <filesystem>
+#include <functional>
+#include <system_error>
+
+TextureCache &TextureCache::getInstance()
+{
+  static TextureCache instance;
+  return instance;
+}
+
+size_t TextureCache::KeyHash::operator()(const Key &key) const
+{
+  // 경로와 파라미터의 hash 값을 섞어서 하나의 hash 값으로 결합
+  size_t hash = std::hash<std::string>()(key.path);
+  hash ^= std::hash<GLenum>()(key.params.format) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  hash ^= std::hash<GLenum>()(key.params.internalFormat) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  return hash;
+}
+
+std::shared_ptr<Texture> TextureCache::acquire(const std::string &path, const TextureLoadParams &params)
+{
+  /*
+    같은 파일을 가리키는 서로 다른 경로 표기(ex> "./a/../b.png" 와 "b.png")가 하나의 항목으로 묶이도록 경로 정규화
+
+    -> 파일이 존재하지 않아도 예외를 던지지 않는 weakly_canonical() 을 사용하고, 그래도 실패하면 원래 경로를 key 로 사용함.
+  */
+  std::error_code error;
+  std::filesystem::path canonicalPath = std::filesystem::weakly_canonical(path, error);
+  Key key{error ? path : canonicalPath.generic_string(), params};
+
+  std::promise<std::shared_ptr<Texture>> promise;
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    Entry &entry = entries[key];
+
+    if (std::shared_ptr<Texture> texture = entry.texture.lock())
+    {
+      hitCount++;
+      return texture;
+    }
+
+    // 다른 스레드가 로드 중이면 lock 을 풀고 해당 로드가 끝나기를 기다림
+    if (entry.pending.valid())
+    {
+      hitCount++;
+      std::shared_future<std::shared_ptr<Texture>> pending = entry.pending;
+      lock.unlock();
+      return pending.get();
+    }
+
+    // 이 스레드가 로드를 담당하고, 이후의 요청들은 future 로 기다리도록 함
+    missCount++;
+    entry.pending = promise.get_future().share();
+  }
+
+  try
+  {
+    std::shared_ptr<Texture> texture = load(key);
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      Entry &entry = entries[key];
+      entry.texture = texture;
+      entry.pending = std::shared_future<std::shared_ptr<Texture>>();
+    }
+
+    promise.set_value(texture);
+    return texture;
+  }
+  catch (...)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      entries.erase(key);
+    }
+
+    // 기다리던 다른 스레드들에도 같은 예외를 전달
+    promise.set_exception(std::current_exception());
+    throw;
+  }
+}
+
+std::shared_ptr<Texture> TextureCache::load(const Key &key)
+{
+  Texture *texture = key.params.format == 0
+                         ? new Texture(key.path.c_str())
+                         : new Texture(key.path.c_str(), key.params.format, key.params.internalFormat);
+
+  const size_t byteSize = texture->getByteSize();
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    residentBytes += byteSize;
+  }
+
+  spdlog::info("TextureCache loaded <{}> ({} KB)", key.path, byteSize / 1024);
+
+  return std::shared_ptr<Texture>(texture, [this, key, byteSize](Texture *releasedTexture)
+                                  { release(key, releasedTexture, byteSize); });
+}
+
+void TextureCache::release(const Key &key, Texture *texture, size_t byteSize)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    residentBytes -= byteSize;
+
+    // 해제된 텍스쳐를 가리키던 항목만 제거 (그 사이 같은 key 로 다시 로드 중인 항목은 유지)
+    auto it = entries.find(key);
+    if (it != entries.end() && it->second.texture.expired() && !it->second.pending.valid())
+    {
+      entries.erase(it);
+    }
+  }
+
+  delete texture;
+}
+
+size_t TextureCache::getResidentBytes() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return residentBytes;
+}
+
+size_t TextureCache::getTextureCount() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  size_t count = 0;
+  for (const auto &[key, entry] : entries)
+  {
+    if (!entry.texture.expired())
+    {
+      count++;
+    }
+  }
+  return count;
+}
+
+size_t TextureCache::getHitCount() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return hitCount;
+}
+
+size_t TextureCache::getMissCount() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return missCount;
+}
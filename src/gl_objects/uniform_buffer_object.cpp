@@ -0,0 +1,121 @@
+#include "gl_objects/uniform_buffer_object.hpp"
+#include "gl_context/gl_extensions.hpp"
+#include "common/gl_call_counter.hpp"
+#include <stdexcept>
+
+UniformBufferObject::UniformBufferObject()
+{
+  // DSA 함수는 glCreateBuffers() 로 생성된 객체에만 사용할 수 있음 (glGenBuffers() 는 바인딩 전까지 이름만 예약함)
+  if (GLExtensions::hasDirectStateAccess())
+  {
+    GLExtensions::createBuffers(1, &ID);
+  }
+  else
+  {
+    glGenBuffers(1, &ID);
+  }
+  GLCallCounter::add(1);
+
+  if (ID == 0)
+  {
+    throw std::runtime_error("Failed to generate UBO.");
+  }
+}
+
+UniformBufferObject::~UniformBufferObject()
+{
+  destroy();
+}
+
+void UniformBufferObject::setData(const void *data, GLsizeiptr size, GLenum usage)
+{
+  if (ID == 0)
+  {
+    throw std::runtime_error("UBO not initialized.");
+  }
+
+  if (GLExtensions::hasDirectStateAccess())
+  {
+    GLExtensions::namedBufferData(ID, size, data, usage);
+    GLCallCounter::add(1);
+    return;
+  }
+
+  bind();
+
+  glBufferData(GL_UNIFORM_BUFFER, size, data, usage);
+  GLCallCounter::add(1);
+
+  unbind();
+}
+
+void UniformBufferObject::setSubData(GLintptr offset, const void *data, GLsizeiptr size)
+{
+  if (ID == 0)
+  {
+    throw std::runtime_error("UBO not initialized.");
+  }
+
+  if (GLExtensions::hasDirectStateAccess())
+  {
+    GLExtensions::namedBufferSubData(ID, offset, size, data);
+    GLCallCounter::add(1);
+    return;
+  }
+
+  bind();
+
+  glBufferSubData(GL_UNIFORM_BUFFER, offset, size, data);
+  GLCallCounter::add(1);
+
+  unbind();
+}
+
+void UniformBufferObject::bindBase(GLuint bindingPoint) const
+{
+  if (ID == 0)
+  {
+    throw std::runtime_error("UBO not initialized.");
+  }
+
+  glBindBufferBase(GL_UNIFORM_BUFFER, bindingPoint, ID);
+  GLCallCounter::add(1);
+}
+
+void UniformBufferObject::bindRange(GLuint bindingPoint, GLintptr offset, GLsizeiptr size) const
+{
+  if (ID == 0)
+  {
+    throw std::runtime_error("UBO not initialized.");
+  }
+
+  glBindBufferRange(GL_UNIFORM_BUFFER, bindingPoint, ID, offset, size);
+  GLCallCounter::add(1);
+}
+
+GLuint UniformBufferObject::getID() const
+{
+  return ID;
+}
+
+void UniformBufferObject::bind() const
+{
+  glBindBuffer(GL_UNIFORM_BUFFER, ID);
+  GLCallCounter::add(1);
+}
+
+void UniformBufferObject::unbind() const
+{
+  glBindBuffer(GL_UNIFORM_BUFFER, 0);
+  GLCallCounter::add(1);
+}
+
+void UniformBufferObject::destroy()
+{
+  if (ID != 0)
+  {
+    glDeleteBuffers(1, &ID);
+    GLCallCounter::add(1);
+    ID = 0;
+  }
+}
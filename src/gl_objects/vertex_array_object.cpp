@@ -1,9 +1,20 @@
 #include "gl_objects/vertex_array_object.hpp"
+#include "gl_context/gl_extensions.hpp"
+#include "common/gl_call_counter.hpp"
 #include <stdexcept>
 
 VertexArrayObject::VertexArrayObject()
 {
-  glGenVertexArrays(1, &ID);
+  // DSA 함수는 glCreateVertexArrays() 로 생성된 객체에만 사용할 수 있음 (glGenVertexArrays() 는 바인딩 전까지 이름만 예약함)
+  if (GLExtensions::hasDirectStateAccess())
+  {
+    GLExtensions::createVertexArrays(1, &ID);
+  }
+  else
+  {
+    glGenVertexArrays(1, &ID);
+  }
+  GLCallCounter::add(1);
 
   if (ID == 0)
   {
@@ -18,6 +29,12 @@ VertexArrayObject::~VertexArrayObject()
 
 void VertexArrayObject::linkVBO(const VertexBufferObject &vbo, const std::vector<std::tuple<GLuint, GLint, GLenum, GLboolean, GLsizei, const void *>> &attributes)
 {
+  if (GLExtensions::hasDirectStateAccess())
+  {
+    linkVBODirect(vbo, attributes);
+    return;
+  }
+
   bind();
   vbo.bind();
 
@@ -33,21 +50,106 @@ void VertexArrayObject::linkVBO(const VertexBufferObject &vbo, const std::vector
     // 구조적 바인딩을 사용하여 tuple 각 요소 추출
     auto [index, size, type, normalized, stride, offset] = attr;
 
-    glVertexAttribPointer(index, size, type, normalized, stride, offset);
+    /*
+      정규화하지 않는 정수형 attribute(ex> bone ID)는 glVertexAttribIPointer() 로 연결해야
+      쉐이더에서 ivec4 등의 정수형 변수로 손실 없이 읽을 수 있음.
+
+      -> glVertexAttribPointer() 로 연결하면 정수값이 float 으로 변환되어 버림.
+      (GL_INT_2_10_10_10_REV 같은 packed 포맷이나 normalized 정수는 기존처럼 float 으로 읽음)
+    */
+    if (normalized == GL_FALSE && isIntegerType(type))
+    {
+      glVertexAttribIPointer(index, size, type, stride, offset);
+    }
+    else
+    {
+      glVertexAttribPointer(index, size, type, normalized, stride, offset);
+    }
     glEnableVertexAttribArray(index);
+    GLCallCounter::add(2);
   }
 
   vbo.unbind();
   unbind();
 }
 
+void VertexArrayObject::linkVBODirect(const VertexBufferObject &vbo, const std::vector<std::tuple<GLuint, GLint, GLenum, GLboolean, GLsizei, const void *>> &attributes)
+{
+  for (const auto &attr : attributes)
+  {
+    auto [index, size, type, normalized, stride, offset] = attr;
+
+    /*
+      glVertexAttribPointer() 는 index 번 attribute 를 같은 index 번 buffer binding 에 연결하고,
+      offset 을 binding 의 버퍼 시작 위치로 사용하는 것과 같음.
+
+      -> 같은 방식으로 attribute 마다 같은 번호의 binding 을 사용하면,
+      setAttributeDivisor() 의 binding 별 divisor 설정도 bind 경로와 동일하게 동작하고
+      relative offset 최대값(GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET)의 제한도 받지 않음.
+    */
+    GLExtensions::vertexArrayVertexBuffer(ID, index, vbo.getID(), reinterpret_cast<GLintptr>(offset), stride);
+
+    // 정규화하지 않는 정수형 attribute 는 정수형 변수로 손실 없이 읽도록 연결 (linkVBO() 참고)
+    if (normalized == GL_FALSE && isIntegerType(type))
+    {
+      GLExtensions::vertexArrayAttribIFormat(ID, index, size, type, 0);
+    }
+    else
+    {
+      GLExtensions::vertexArrayAttribFormat(ID, index, size, type, normalized, 0);
+    }
+    GLExtensions::vertexArrayAttribBinding(ID, index, index);
+    GLExtensions::enableVertexArrayAttrib(ID, index);
+    GLCallCounter::add(4);
+  }
+}
+
+bool VertexArrayObject::isIntegerType(GLenum type)
+{
+  switch (type)
+  {
+  case GL_BYTE:
+  case GL_UNSIGNED_BYTE:
+  case GL_SHORT:
+  case GL_UNSIGNED_SHORT:
+  case GL_INT:
+  case GL_UNSIGNED_INT:
+    return true;
+  default:
+    return false;
+  }
+}
+
 void VertexArrayObject::linkIBO(const IndexBufferObject &ibo)
 {
+  if (GLExtensions::hasDirectStateAccess())
+  {
+    GLExtensions::vertexArrayElementBuffer(ID, ibo.getID());
+    GLCallCounter::add(1);
+    return;
+  }
+
   bind();
   ibo.bind();
   unbind();
 }
 
+void VertexArrayObject::setAttributeDivisor(GLuint index, GLuint divisor)
+{
+  // linkVBODirect() 는 attribute 마다 같은 번호의 binding 을 사용하므로 binding 의 divisor 를 설정
+  if (GLExtensions::hasDirectStateAccess())
+  {
+    GLExtensions::vertexArrayBindingDivisor(ID, index, divisor);
+    GLCallCounter::add(1);
+    return;
+  }
+
+  bind();
+  glVertexAttribDivisor(index, divisor);
+  GLCallCounter::add(1);
+  unbind();
+}
+
 GLuint VertexArrayObject::getID() const
 {
   return ID;
@@ -56,11 +158,13 @@ GLuint VertexArrayObject::getID() const
 void VertexArrayObject::bind() const
 {
   glBindVertexArray(ID);
+  GLCallCounter::add(1);
 }
 
 void VertexArrayObject::unbind() const
 {
   glBindVertexArray(0);
+  GLCallCounter::add(1);
 }
 
 void VertexArrayObject::destroy()
@@ -68,6 +172,7 @@ void VertexArrayObject::destroy()
   if (ID != 0)
   {
     glDeleteVertexArrays(1, &ID);
+    GLCallCounter::add(1);
     ID = 0;
   }
 }
@@ -1,5 +1,6 @@
 #include "glfw_impl/glfw_impl.hpp"
 #include "gl_context/gl_context.hpp"
+#include "gl_context/gl_extensions.hpp"
 
 GLFWImpl::GLFWImpl(int width, int height, const char *title)
     : width(width), height(height), title(title),
@@ -63,6 +64,9 @@ int GLFWImpl::init()
     return -1;
   }
 
+  // glad 가 로드하지 않는 상위 버전 OpenGL 함수들의 지원 여부 검사 및 로드
+  GLExtensions::load((GLADloadproc)glfwGetProcAddress);
+
   return 0;
 }
 
@@ -0,0 +1,81 @@
+#include "mesh/bounding_volume.hpp"
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+BoundingBox computeBoundingBox(const std::vector<glm::vec3> &positions)
+{
+  BoundingBox box;
+  if (positions.empty())
+  {
+    return box;
+  }
+
+  box.min = glm::vec3(std::numeric_limits<float>::max());
+  box.max = glm::vec3(std::numeric_limits<float>::lowest());
+  for (const glm::vec3 &position : positions)
+  {
+    box.min = glm::min(box.min, position);
+    box.max = glm::max(box.max, position);
+  }
+
+  return box;
+}
+
+BoundingBox transformBoundingBox(const BoundingBox &box, const glm::mat4 &transform)
+{
+  /*
+    8개의 꼭짓점을 모두 변환하는 대신,
+    중심은 그대로 변환하고 반지름(extent)은 회전/크기 행렬 성분의 절댓값으로 변환함. (Arvo 방식)
+  */
+  glm::vec3 center = (box.min + box.max) * 0.5f;
+  glm::vec3 extent = (box.max - box.min) * 0.5f;
+
+  glm::vec3 worldCenter = glm::vec3(transform * glm::vec4(center, 1.0f));
+  glm::vec3 worldExtent = glm::abs(glm::vec3(transform[0])) * extent.x +
+                          glm::abs(glm::vec3(transform[1])) * extent.y +
+                          glm::abs(glm::vec3(transform[2])) * extent.z;
+
+  BoundingBox result;
+  result.min = worldCenter - worldExtent;
+  result.max = worldCenter + worldExtent;
+  return result;
+}
+
+BoundingSphere computeBoundingSphere(const std::vector<glm::vec3> &positions)
+{
+  BoundingSphere sphere;
+  if (positions.empty())
+  {
+    return sphere;
+  }
+
+  // AABB 의 중심을 bounding sphere 의 중심으로 사용
+  BoundingBox box = computeBoundingBox(positions);
+  sphere.center = (box.min + box.max) * 0.5f;
+
+  // 중심으로부터 가장 먼 정점까지의 거리를 반지름으로 사용
+  float maxDistanceSquared = 0.0f;
+  for (const glm::vec3 &position : positions)
+  {
+    glm::vec3 offset = position - sphere.center;
+    maxDistanceSquared = std::max(maxDistanceSquared, glm::dot(offset, offset));
+  }
+  sphere.radius = std::sqrt(maxDistanceSquared);
+
+  return sphere;
+}
+
+BoundingSphere transformBoundingSphere(const BoundingSphere &sphere, const glm::mat4 &transform)
+{
+  BoundingSphere result;
+  result.center = glm::vec3(transform * glm::vec4(sphere.center, 1.0f));
+
+  // 비균등 scale 이 적용되어도 mesh 를 모두 감쌀 수 있도록 가장 큰 축의 scale 을 반지름에 곱함
+  float scaleX = glm::length(glm::vec3(transform[0]));
+  float scaleY = glm::length(glm::vec3(transform[1]));
+  float scaleZ = glm::length(glm::vec3(transform[2]));
+  result.radius = sphere.radius * std::max(scaleX, std::max(scaleY, scaleZ));
+
+  return result;
+}
@@ -0,0 +1,96 @@
+#include "mesh/buffer_suballocator.hpp"
+#include <iterator>
+
+BufferSuballocator::BufferSuballocator(size_t capacity)
+    : capacity(0), usedCount(0)
+{
+  grow(capacity);
+}
+
+size_t BufferSuballocator::allocate(size_t count)
+{
+  if (count == 0)
+  {
+    return INVALID_OFFSET;
+  }
+
+  // offset 이 가장 작은 빈 영역부터 순회하며 count 개를 담을 수 있는 첫 번째 영역을 사용
+  for (auto it = freeBlocks.begin(); it != freeBlocks.end(); ++it)
+  {
+    if (it->second < count)
+    {
+      continue;
+    }
+
+    size_t offset = it->first;
+    size_t remaining = it->second - count;
+    freeBlocks.erase(it);
+
+    // 사용하고 남은 뒷부분은 다시 빈 영역으로 추가
+    if (remaining > 0)
+    {
+      freeBlocks.emplace(offset + count, remaining);
+    }
+
+    usedCount += count;
+    return offset;
+  }
+
+  return INVALID_OFFSET;
+}
+
+void BufferSuballocator::free(size_t offset, size_t count)
+{
+  if (count == 0)
+  {
+    return;
+  }
+
+  usedCount -= count;
+  auto it = freeBlocks.emplace(offset, count).first;
+
+  // 바로 뒤의 빈 영역과 맞닿아 있으면 병합
+  auto next = std::next(it);
+  if (next != freeBlocks.end() && it->first + it->second == next->first)
+  {
+    it->second += next->second;
+    freeBlocks.erase(next);
+  }
+
+  // 바로 앞의 빈 영역과 맞닿아 있으면 병합
+  if (it != freeBlocks.begin())
+  {
+    auto prev = std::prev(it);
+    if (prev->first + prev->second == it->first)
+    {
+      prev->second += it->second;
+      freeBlocks.erase(it);
+    }
+  }
+}
+
+void BufferSuballocator::grow(size_t newCapacity)
+{
+  if (newCapacity <= capacity)
+  {
+    return;
+  }
+
+  // 늘어난 영역을 빈 영역으로 추가 (마지막 빈 영역과 맞닿아 있으면 free() 에서 병합됨)
+  size_t addedCount = newCapacity - capacity;
+  size_t addedOffset = capacity;
+  capacity = newCapacity;
+
+  usedCount += addedCount;
+  free(addedOffset, addedCount);
+}
+
+size_t BufferSuballocator::getCapacity() const
+{
+  return capacity;
+}
+
+size_t BufferSuballocator::getUsedCount() const
+{
+  return usedCount;
+}
@@ -0,0 +1,530 @@
+#include "mesh/bvh.hpp"
+#include "constants/model_constants.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+// x86 계열에서 SSE2 명령어를 사용할 수 있으면 SIMD 경로로 컴파일
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BVH_USE_SSE 1
+#include <emmintrin.h>
+#else
+#define BVH_USE_SSE 0
+#endif
+
+namespace
+{
+  constexpr float INFINITE_DISTANCE = std::numeric_limits<float>::infinity();
+
+  // 아무것도 포함하지 않는 AABB (어떤 점을 포함시켜도 그 점만 감싸는 AABB 가 됨)
+  BoundingBox emptyBox()
+  {
+    BoundingBox box;
+    box.min = glm::vec3(std::numeric_limits<float>::max());
+    box.max = glm::vec3(-std::numeric_limits<float>::max());
+    return box;
+  }
+
+  void grow(BoundingBox &box, const BoundingBox &other)
+  {
+    box.min = glm::min(box.min, other.min);
+    box.max = glm::max(box.max, other.max);
+  }
+
+  void grow(BoundingBox &box, const glm::vec3 &point)
+  {
+    box.min = glm::min(box.min, point);
+    box.max = glm::max(box.max, point);
+  }
+
+  // SAH 비용 계산에 사용하는 AABB 의 표면적 (모든 노드에 같은 비율로 곱해지는 상수 2 는 생략)
+  float halfArea(const BoundingBox &box)
+  {
+    glm::vec3 extent = box.max - box.min;
+    return extent.x * extent.y + extent.y * extent.z + extent.z * extent.x;
+  }
+
+  // SAH 분할 위치를 찾기 위해 centroid 를 나눠 담는 bin
+  struct Bin
+  {
+    BoundingBox box = emptyBox();
+    size_t count = 0;
+  };
+
+  // 아직 분할되지 않은 노드와 노드에 속한 삼각형들의 order 배열 구간 [begin, end)
+  struct BuildTask
+  {
+    std::uint32_t node;
+    size_t begin;
+    size_t end;
+    int depth;
+  };
+} // namespace
+
+void Bvh::build(const std::vector<glm::vec3> &positions, const std::vector<unsigned int> &indices, size_t indexCount)
+{
+  nodes.clear();
+  packets.clear();
+  triangleCount = indexCount / 3;
+
+  if (triangleCount == 0)
+  {
+    return;
+  }
+
+  // 삼각형마다 AABB 와 centroid 를 미리 계산해두고, 분할은 삼각형 번호 배열(order)을 재정렬하여 수행
+  std::vector<BoundingBox> triangleBoxes(triangleCount);
+  std::vector<glm::vec3> centroids(triangleCount);
+  std::vector<std::uint32_t> order(triangleCount);
+  for (size_t t = 0; t < triangleCount; t++)
+  {
+    BoundingBox box = emptyBox();
+    grow(box, positions[indices[t * 3 + 0]]);
+    grow(box, positions[indices[t * 3 + 1]]);
+    grow(box, positions[indices[t * 3 + 2]]);
+
+    triangleBoxes[t] = box;
+    centroids[t] = (box.min + box.max) * 0.5f;
+    order[t] = static_cast<std::uint32_t>(t);
+  }
+
+  // leaf 에는 최대 PACKET_WIDTH 개의 삼각형이 들어가므로, leaf 는 삼각형 개수 / PACKET_WIDTH 개 이상이고 노드 개수는 그 2배 정도가 됨
+  nodes.reserve(triangleCount / PACKET_WIDTH * 2 + 1);
+  packets.reserve(triangleCount / PACKET_WIDTH + 1);
+  nodes.emplace_back();
+
+  /*
+    재귀 호출 대신 작업 stack 으로 깊이 우선 생성
+
+    -> 왼쪽 자식을 먼저 처리하므로, packet 배열에 leaf 들이 트리의 왼쪽부터 순서대로 배치되어
+    공간적으로 가까운 leaf 들이 메모리 상에서도 가깝게 놓임.
+  */
+  std::vector<BuildTask> tasks;
+  tasks.push_back({0, 0, triangleCount, 0});
+
+  while (!tasks.empty())
+  {
+    BuildTask task = tasks.back();
+    tasks.pop_back();
+
+    BoundingBox bounds = emptyBox();
+    BoundingBox centroidBounds = emptyBox();
+    for (size_t i = task.begin; i < task.end; i++)
+    {
+      grow(bounds, triangleBoxes[order[i]]);
+      grow(centroidBounds, centroids[order[i]]);
+    }
+
+    Node &node = nodes[task.node];
+    node.min[0] = bounds.min.x;
+    node.min[1] = bounds.min.y;
+    node.min[2] = bounds.min.z;
+    node.max[0] = bounds.max.x;
+    node.max[1] = bounds.max.y;
+    node.max[2] = bounds.max.z;
+
+    const size_t count = task.end - task.begin;
+
+    /* 삼각형이 packet 하나에 들어가면 leaf 로 만들고, packet 의 남는 lane 은 퇴화 삼각형(0 으로 초기화)으로 둠 */
+    if (count <= PACKET_WIDTH)
+    {
+      node.leftOrFirst = static_cast<std::uint32_t>(packets.size());
+      node.count = static_cast<std::uint32_t>(count);
+
+      TrianglePacket &packet = packets.emplace_back();
+      packet = TrianglePacket{};
+      for (size_t lane = 0; lane < count; lane++)
+      {
+        const std::uint32_t t = order[task.begin + lane];
+        const glm::vec3 &v0 = positions[indices[t * 3 + 0]];
+        const glm::vec3 e1 = positions[indices[t * 3 + 1]] - v0;
+        const glm::vec3 e2 = positions[indices[t * 3 + 2]] - v0;
+
+        packet.v0x[lane] = v0.x;
+        packet.v0y[lane] = v0.y;
+        packet.v0z[lane] = v0.z;
+        packet.e1x[lane] = e1.x;
+        packet.e1y[lane] = e1.y;
+        packet.e1z[lane] = e1.z;
+        packet.e2x[lane] = e2.x;
+        packet.e2y[lane] = e2.y;
+        packet.e2z[lane] = e2.z;
+        packet.triangle[lane] = t;
+      }
+      continue;
+    }
+
+    /*
+      SAH 분할
+
+      축마다 centroid 범위를 NUM_BINS 개의 bin 으로 나눠서 삼각형들을 담은 뒤,
+      각 bin 경계에서 나눴을 때의 비용 (= 자식 AABB 표면적 * 자식 삼각형 개수의 합) 이 가장 작은 경계를 찾음.
+      -> 왼쪽에서부터 누적한 AABB 와 오른쪽에서부터 누적한 AABB 를 이용하므로 축마다 bin 개수에 비례하는 비용으로 모든 경계를 평가함.
+    */
+    const glm::vec3 centroidExtent = centroidBounds.max - centroidBounds.min;
+    int bestAxis = -1;
+    int bestSplit = 0;
+    float bestCost = INFINITE_DISTANCE;
+
+    if (task.depth < BvhConstants::MAX_SAH_DEPTH)
+    {
+      for (int axis = 0; axis < 3; axis++)
+      {
+        if (centroidExtent[axis] <= 0.0f)
+        {
+          continue;
+        }
+
+        const float binScale = BvhConstants::NUM_BINS / centroidExtent[axis];
+        std::array<Bin, BvhConstants::NUM_BINS> bins;
+        for (size_t i = task.begin; i < task.end; i++)
+        {
+          const std::uint32_t t = order[i];
+          const int bin = std::min(BvhConstants::NUM_BINS - 1, static_cast<int>((centroids[t][axis] - centroidBounds.min[axis]) * binScale));
+          bins[bin].count++;
+          grow(bins[bin].box, triangleBoxes[t]);
+        }
+
+        // split 번째 경계는 [0, split) bin 들과 [split, NUM_BINS) bin 들로 나눔
+        std::array<float, BvhConstants::NUM_BINS> leftCosts{};
+        BoundingBox leftBox = emptyBox();
+        size_t leftCount = 0;
+        for (int split = 1; split < BvhConstants::NUM_BINS; split++)
+        {
+          leftCount += bins[split - 1].count;
+          grow(leftBox, bins[split - 1].box);
+          leftCosts[split] = leftCount > 0 ? halfArea(leftBox) * leftCount : INFINITE_DISTANCE;
+        }
+
+        BoundingBox rightBox = emptyBox();
+        size_t rightCount = 0;
+        for (int split = BvhConstants::NUM_BINS - 1; split > 0; split--)
+        {
+          rightCount += bins[split].count;
+          grow(rightBox, bins[split].box);
+          if (rightCount == 0)
+          {
+            continue;
+          }
+
+          const float cost = leftCosts[split] + halfArea(rightBox) * rightCount;
+          if (cost < bestCost)
+          {
+            bestCost = cost;
+            bestAxis = axis;
+            bestSplit = split;
+          }
+        }
+      }
+    }
+
+    size_t middle = task.begin;
+    if (bestAxis >= 0)
+    {
+      // 찾은 경계 왼쪽 bin 에 담긴 삼각형들을 구간 앞쪽으로 모음 (binning 과 같은 식으로 bin 을 계산해야 결과가 일치함)
+      const float binScale = BvhConstants::NUM_BINS / centroidExtent[bestAxis];
+      middle = static_cast<size_t>(std::partition(order.begin() + task.begin, order.begin() + task.end, [&](std::uint32_t t)
+                                                  { return std::min(BvhConstants::NUM_BINS - 1, static_cast<int>((centroids[t][bestAxis] - centroidBounds.min[bestAxis]) * binScale)) < bestSplit; }) -
+                                   order.begin());
+    }
+
+    /*
+      median 분할
+
+      centroid 가 모두 한 점에 모여 있거나 (ex> 같은 위치에 겹친 삼각형들) 최대 SAH 깊이를 넘어선 경우,
+      centroid 범위가 가장 긴 축을 기준으로 삼각형 개수를 절반씩 나눔.
+    */
+    if (middle == task.begin || middle == task.end)
+    {
+      int axis = 0;
+      if (centroidExtent.y > centroidExtent[axis])
+      {
+        axis = 1;
+      }
+      if (centroidExtent.z > centroidExtent[axis])
+      {
+        axis = 2;
+      }
+
+      middle = (task.begin + task.end) / 2;
+      std::nth_element(order.begin() + task.begin, order.begin() + middle, order.begin() + task.end, [&](std::uint32_t a, std::uint32_t b)
+                       { return centroids[a][axis] < centroids[b][axis]; });
+    }
+
+    // 형제 노드를 연속으로 추가 (emplace_back() 으로 노드 배열이 재할당될 수 있으므로 node 참조 대신 인덱스로 접근)
+    const std::uint32_t left = static_cast<std::uint32_t>(nodes.size());
+    nodes[task.node].leftOrFirst = left;
+    nodes[task.node].count = 0;
+    nodes.emplace_back();
+    nodes.emplace_back();
+
+    tasks.push_back({left + 1, middle, task.end, task.depth + 1});
+    tasks.push_back({left, task.begin, middle, task.depth + 1});
+  }
+}
+
+bool Bvh::intersect(const BvhRay &ray, float maxDistance, BvhHit &hit) const
+{
+  return traverse<false>(ray, maxDistance, hit);
+}
+
+bool Bvh::occluded(const BvhRay &ray, float maxDistance) const
+{
+  BvhHit hit;
+  return traverse<true>(ray, maxDistance, hit);
+}
+
+bool Bvh::empty() const
+{
+  return nodes.empty();
+}
+
+size_t Bvh::getNodeCount() const
+{
+  return nodes.size();
+}
+
+size_t Bvh::getTriangleCount() const
+{
+  return triangleCount;
+}
+
+size_t Bvh::getMemorySize() const
+{
+  return nodes.size() * sizeof(Node) + packets.size() * sizeof(TrianglePacket);
+}
+
+BoundingBox Bvh::getBounds() const
+{
+  BoundingBox box;
+  if (!nodes.empty())
+  {
+    box.min = glm::vec3(nodes[0].min[0], nodes[0].min[1], nodes[0].min[2]);
+    box.max = glm::vec3(nodes[0].max[0], nodes[0].max[1], nodes[0].max[2]);
+  }
+  return box;
+}
+
+template <bool AnyHit>
+bool Bvh::traverse(const BvhRay &ray, float maxDistance, BvhHit &hit) const
+{
+  if (nodes.empty())
+  {
+    return false;
+  }
+
+  // slab 검사에서 나눗셈 대신 곱셈을 사용하도록 방향의 역수를 미리 계산 (0 인 성분은 inf 가 되어 해당 축의 slab 이 무한히 넓어짐)
+  const glm::vec4 origin(ray.origin, 0.0f);
+  const glm::vec4 inverseDirection(1.0f / ray.direction.x, 1.0f / ray.direction.y, 1.0f / ray.direction.z, 0.0f);
+
+  float entryDistance;
+  if (!intersectNode(nodes[0], origin, inverseDirection, maxDistance, entryDistance))
+  {
+    return false;
+  }
+
+  // 나중에 방문할 먼 쪽 자식 노드와 그 노드의 교차 시작 거리
+  std::uint32_t nodeStack[BvhConstants::TRAVERSAL_STACK_SIZE];
+  float entryStack[BvhConstants::TRAVERSAL_STACK_SIZE];
+  int stackSize = 0;
+
+  float closest = maxDistance;
+  bool found = false;
+  std::uint32_t nodeIndex = 0;
+
+  while (true)
+  {
+    const Node &node = nodes[nodeIndex];
+    if (node.count > 0)
+    {
+      if (intersectPacket(packets[node.leftOrFirst], ray, closest, hit))
+      {
+        if constexpr (AnyHit)
+        {
+          return true;
+        }
+        closest = hit.distance;
+        found = true;
+      }
+    }
+    else
+    {
+      // 두 자식 모두 교차하면 가까운 쪽부터 내려가고 먼 쪽은 stack 에 보관 (가까운 쪽에서 교차를 찾으면 먼 쪽은 대부분 건너뜀)
+      std::uint32_t near = node.leftOrFirst;
+      std::uint32_t far = node.leftOrFirst + 1;
+      float nearEntry, farEntry;
+      bool hitNear = intersectNode(nodes[near], origin, inverseDirection, closest, nearEntry);
+      bool hitFar = intersectNode(nodes[far], origin, inverseDirection, closest, farEntry);
+
+      if (hitNear && hitFar && farEntry < nearEntry)
+      {
+        std::swap(near, far);
+        std::swap(nearEntry, farEntry);
+      }
+
+      if (hitNear && hitFar)
+      {
+        nodeStack[stackSize] = far;
+        entryStack[stackSize] = farEntry;
+        stackSize++;
+        nodeIndex = near;
+        continue;
+      }
+      if (hitNear || hitFar)
+      {
+        nodeIndex = hitNear ? near : far;
+        continue;
+      }
+    }
+
+    // stack 에 보관했던 노드들 중 그 사이 찾은 교차보다 가까운 노드만 방문
+    bool popped = false;
+    while (stackSize > 0)
+    {
+      stackSize--;
+      if (entryStack[stackSize] < closest)
+      {
+        nodeIndex = nodeStack[stackSize];
+        popped = true;
+        break;
+      }
+    }
+    if (!popped)
+    {
+      break;
+    }
+  }
+
+  return found;
+}
+
+bool Bvh::intersectNode(const Node &node, const glm::vec4 &origin, const glm::vec4 &inverseDirection, float maxDistance, float &entryDistance)
+{
+#if BVH_USE_SSE
+  // 노드의 min, max 를 각각 한번에 읽어서 3개 축의 slab 교차 거리를 동시에 계산 (4번째 lane 은 inverseDirection.w = 0 이 곱해지고 결과에서 제외됨)
+  const __m128 originV = _mm_loadu_ps(&origin.x);
+  const __m128 inverseDirectionV = _mm_loadu_ps(&inverseDirection.x);
+  const __m128 t0 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node.min), originV), inverseDirectionV);
+  const __m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node.max), originV), inverseDirectionV);
+  const __m128 nearV = _mm_min_ps(t0, t1);
+  const __m128 farV = _mm_max_ps(t0, t1);
+
+  // x, y, z lane 의 최댓값(진입 거리) 및 최솟값(탈출 거리)
+  const float entry = _mm_cvtss_f32(_mm_max_ss(_mm_max_ss(nearV, _mm_shuffle_ps(nearV, nearV, _MM_SHUFFLE(1, 1, 1, 1))), _mm_shuffle_ps(nearV, nearV, _MM_SHUFFLE(2, 2, 2, 2))));
+  const float exit = _mm_cvtss_f32(_mm_min_ss(_mm_min_ss(farV, _mm_shuffle_ps(farV, farV, _MM_SHUFFLE(1, 1, 1, 1))), _mm_shuffle_ps(farV, farV, _MM_SHUFFLE(2, 2, 2, 2))));
+#else
+  float entry = -INFINITE_DISTANCE;
+  float exit = INFINITE_DISTANCE;
+  for (int axis = 0; axis < 3; axis++)
+  {
+    const float t0 = (node.min[axis] - origin[axis]) * inverseDirection[axis];
+    const float t1 = (node.max[axis] - origin[axis]) * inverseDirection[axis];
+    entry = std::max(entry, std::min(t0, t1));
+    exit = std::min(exit, std::max(t0, t1));
+  }
+#endif
+
+  entryDistance = entry;
+  return exit >= std::max(entry, 0.0f) && entry < maxDistance;
+}
+
+bool Bvh::intersectPacket(const TrianglePacket &packet, const BvhRay &ray, float maxDistance, BvhHit &hit)
+{
+  /*
+    Möller–Trumbore 교차 검사
+
+    p = d x e2, det = e1 . p 로 광선과 삼각형 평면의 교차를 구하고, barycentric 좌표 u, v 와 거리 t 를 계산함.
+    -> 광선과 평행하거나 퇴화된 삼각형(패딩 lane 포함)은 det 가 0 이 되어 u, v 가 inf 또는 NaN 이 되므로 비교에서 모두 걸러짐.
+  */
+#if BVH_USE_SSE
+  const __m128 dx = _mm_set1_ps(ray.direction.x);
+  const __m128 dy = _mm_set1_ps(ray.direction.y);
+  const __m128 dz = _mm_set1_ps(ray.direction.z);
+
+  const __m128 e1x = _mm_load_ps(packet.e1x);
+  const __m128 e1y = _mm_load_ps(packet.e1y);
+  const __m128 e1z = _mm_load_ps(packet.e1z);
+  const __m128 e2x = _mm_load_ps(packet.e2x);
+  const __m128 e2y = _mm_load_ps(packet.e2y);
+  const __m128 e2z = _mm_load_ps(packet.e2z);
+
+  const __m128 px = _mm_sub_ps(_mm_mul_ps(dy, e2z), _mm_mul_ps(dz, e2y));
+  const __m128 py = _mm_sub_ps(_mm_mul_ps(dz, e2x), _mm_mul_ps(dx, e2z));
+  const __m128 pz = _mm_sub_ps(_mm_mul_ps(dx, e2y), _mm_mul_ps(dy, e2x));
+  const __m128 det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, px), _mm_mul_ps(e1y, py)), _mm_mul_ps(e1z, pz));
+  const __m128 inverseDet = _mm_div_ps(_mm_set1_ps(1.0f), det);
+
+  const __m128 tx = _mm_sub_ps(_mm_set1_ps(ray.origin.x), _mm_load_ps(packet.v0x));
+  const __m128 ty = _mm_sub_ps(_mm_set1_ps(ray.origin.y), _mm_load_ps(packet.v0y));
+  const __m128 tz = _mm_sub_ps(_mm_set1_ps(ray.origin.z), _mm_load_ps(packet.v0z));
+  const __m128 u = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(tx, px), _mm_mul_ps(ty, py)), _mm_mul_ps(tz, pz)), inverseDet);
+
+  const __m128 qx = _mm_sub_ps(_mm_mul_ps(ty, e1z), _mm_mul_ps(tz, e1y));
+  const __m128 qy = _mm_sub_ps(_mm_mul_ps(tz, e1x), _mm_mul_ps(tx, e1z));
+  const __m128 qz = _mm_sub_ps(_mm_mul_ps(tx, e1y), _mm_mul_ps(ty, e1x));
+  const __m128 v = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, qx), _mm_mul_ps(dy, qy)), _mm_mul_ps(dz, qz)), inverseDet);
+  const __m128 t = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qx), _mm_mul_ps(e2y, qy)), _mm_mul_ps(e2z, qz)), inverseDet);
+
+  const __m128 zero = _mm_setzero_ps();
+  __m128 hitMask = _mm_and_ps(_mm_cmpge_ps(u, zero), _mm_cmpge_ps(v, zero));
+  hitMask = _mm_and_ps(hitMask, _mm_cmple_ps(_mm_add_ps(u, v), _mm_set1_ps(1.0f)));
+  hitMask = _mm_and_ps(hitMask, _mm_and_ps(_mm_cmpgt_ps(t, zero), _mm_cmplt_ps(t, _mm_set1_ps(maxDistance))));
+
+  int mask = _mm_movemask_ps(hitMask);
+  if (mask == 0)
+  {
+    return false;
+  }
+
+  // 교차한 lane 들 중 가장 가까운 lane 선택
+  alignas(16) float distances[PACKET_WIDTH];
+  alignas(16) float us[PACKET_WIDTH];
+  alignas(16) float vs[PACKET_WIDTH];
+  _mm_store_ps(distances, t);
+  _mm_store_ps(us, u);
+  _mm_store_ps(vs, v);
+
+  int bestLane = -1;
+  for (int lane = 0; lane < static_cast<int>(PACKET_WIDTH); lane++)
+  {
+    if (((mask >> lane) & 1) && (bestLane < 0 || distances[lane] < distances[bestLane]))
+    {
+      bestLane = lane;
+    }
+  }
+
+  hit.distance = distances[bestLane];
+  hit.triangle = packet.triangle[bestLane];
+  hit.u = us[bestLane];
+  hit.v = vs[bestLane];
+  return true;
+#else
+  bool found = false;
+  float closest = maxDistance;
+  for (size_t lane = 0; lane < PACKET_WIDTH; lane++)
+  {
+    const glm::vec3 e1(packet.e1x[lane], packet.e1y[lane], packet.e1z[lane]);
+    const glm::vec3 e2(packet.e2x[lane], packet.e2y[lane], packet.e2z[lane]);
+    const glm::vec3 p = glm::cross(ray.direction, e2);
+    const float inverseDet = 1.0f / glm::dot(e1, p);
+
+    const glm::vec3 s = ray.origin - glm::vec3(packet.v0x[lane], packet.v0y[lane], packet.v0z[lane]);
+    const float u = glm::dot(s, p) * inverseDet;
+    const glm::vec3 q = glm::cross(s, e1);
+    const float v = glm::dot(ray.direction, q) * inverseDet;
+    const float t = glm::dot(e2, q) * inverseDet;
+
+    if (u >= 0.0f && v >= 0.0f && u + v <= 1.0f && t > 0.0f && t < closest)
+    {
+      closest = t;
+      hit.distance = t;
+      hit.triangle = packet.triangle[lane];
+      hit.u = u;
+      hit.v = v;
+      found = true;
+    }
+  }
+  return found;
+#endif
+}
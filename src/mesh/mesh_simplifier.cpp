@@ -0,0 +1,359 @@
+#include "mesh/mesh_simplifier.hpp"
+#include <unordered_map>
+#include <queue>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+
+namespace
+{
+  // 합칠 edge 후보 (from 정점을 to 정점으로 합침)
+  struct Collapse
+  {
+    double cost;
+    unsigned int from;
+    unsigned int to;
+
+    // std::priority_queue 가 비용이 가장 작은 후보를 먼저 꺼내도록 비교 연산자를 반대로 정의
+    bool operator<(const Collapse &other) const
+    {
+      return cost > other.cost;
+    }
+  };
+
+  // 삼각형의 면적 방향 노멀 (정규화하지 않음)
+  glm::vec3 triangleNormal(const glm::vec3 &p0, const glm::vec3 &p1, const glm::vec3 &p2)
+  {
+    return glm::cross(p1 - p0, p2 - p0);
+  }
+}
+
+void MeshSimplifier::Quadric::addPlane(const glm::dvec4 &plane)
+{
+  a00 += plane.x * plane.x;
+  a01 += plane.x * plane.y;
+  a02 += plane.x * plane.z;
+  a03 += plane.x * plane.w;
+  a11 += plane.y * plane.y;
+  a12 += plane.y * plane.z;
+  a13 += plane.y * plane.w;
+  a22 += plane.z * plane.z;
+  a23 += plane.z * plane.w;
+  a33 += plane.w * plane.w;
+}
+
+void MeshSimplifier::Quadric::add(const Quadric &other)
+{
+  a00 += other.a00;
+  a01 += other.a01;
+  a02 += other.a02;
+  a03 += other.a03;
+  a11 += other.a11;
+  a12 += other.a12;
+  a13 += other.a13;
+  a22 += other.a22;
+  a23 += other.a23;
+  a33 += other.a33;
+}
+
+double MeshSimplifier::Quadric::evaluate(const glm::vec3 &position) const
+{
+  // v^T * Q * v (v = (x, y, z, 1)) -> 누적된 평면들까지의 거리 제곱의 합
+  double x = position.x, y = position.y, z = position.z;
+  double result = a00 * x * x + 2.0 * a01 * x * y + 2.0 * a02 * x * z + 2.0 * a03 * x +
+                  a11 * y * y + 2.0 * a12 * y * z + 2.0 * a13 * y +
+                  a22 * z * z + 2.0 * a23 * z +
+                  a33;
+
+  // 부동소수점 오차로 인해 음수가 나오는 경우 방지
+  return std::max(result, 0.0);
+}
+
+MeshSimplifier::MeshSimplifier(const std::vector<glm::vec3> &positions, const std::vector<unsigned int> &indices)
+    : positions(positions), indices(indices)
+{
+  buildPositionRoots();
+  buildLockedVertices();
+  buildQuadrics();
+}
+
+void MeshSimplifier::buildPositionRoots()
+{
+  // position 의 bit pattern 을 key 로 하는 해시맵으로 동일한 position 을 공유하는 정점들을 묶음
+  struct PositionHash
+  {
+    size_t operator()(const glm::vec3 &p) const
+    {
+      std::uint32_t bits[3];
+      std::memcpy(bits, &p, sizeof(bits));
+      return (bits[0] * 73856093u) ^ (bits[1] * 19349663u) ^ (bits[2] * 83492791u);
+    }
+  };
+
+  std::unordered_map<glm::vec3, unsigned int, PositionHash> roots;
+  roots.reserve(positions.size());
+
+  positionRoots.resize(positions.size());
+  for (unsigned int i = 0; i < positions.size(); i++)
+  {
+    positionRoots[i] = roots.emplace(positions[i], i).first->second;
+  }
+}
+
+void MeshSimplifier::buildLockedVertices()
+{
+  locked.assign(positions.size(), false);
+
+  // 동일한 position 을 공유하는 정점이 2개 이상이면 uv 또는 노멀이 끊기는 seam 정점이므로 고정
+  std::vector<unsigned int> rootCounts(positions.size(), 0);
+  for (unsigned int i = 0; i < positions.size(); i++)
+  {
+    rootCounts[positionRoots[i]]++;
+  }
+
+  std::vector<bool> lockedRoots(positions.size(), false);
+  for (unsigned int i = 0; i < positions.size(); i++)
+  {
+    if (rootCounts[positionRoots[i]] > 1)
+    {
+      lockedRoots[positionRoots[i]] = true;
+    }
+  }
+
+  // 하나의 삼각형에서만 사용되는 edge 는 열린 경계(border)이므로 양 끝 정점을 고정
+  std::unordered_map<std::uint64_t, unsigned int> edgeCounts;
+  edgeCounts.reserve(indices.size());
+  for (size_t i = 0; i + 2 < indices.size(); i += 3)
+  {
+    for (size_t e = 0; e < 3; e++)
+    {
+      std::uint64_t a = positionRoots[indices[i + e]];
+      std::uint64_t b = positionRoots[indices[i + (e + 1) % 3]];
+      edgeCounts[std::min(a, b) << 32 | std::max(a, b)]++;
+    }
+  }
+
+  for (const auto &[edge, count] : edgeCounts)
+  {
+    if (count == 1)
+    {
+      lockedRoots[static_cast<unsigned int>(edge >> 32)] = true;
+      lockedRoots[static_cast<unsigned int>(edge & 0xFFFFFFFFu)] = true;
+    }
+  }
+
+  for (unsigned int i = 0; i < positions.size(); i++)
+  {
+    locked[i] = lockedRoots[positionRoots[i]];
+  }
+}
+
+void MeshSimplifier::buildQuadrics()
+{
+  quadrics.assign(positions.size(), Quadric());
+
+  // 각 삼각형이 놓인 평면의 quadric 을 삼각형의 세 정점(대표 정점)에 누적
+  for (size_t i = 0; i + 2 < indices.size(); i += 3)
+  {
+    const glm::vec3 &p0 = positions[indices[i]];
+    const glm::vec3 &p1 = positions[indices[i + 1]];
+    const glm::vec3 &p2 = positions[indices[i + 2]];
+
+    glm::dvec3 normal = glm::dvec3(triangleNormal(p0, p1, p2));
+    double length = glm::length(normal);
+    if (length == 0.0)
+    {
+      continue;
+    }
+    normal /= length;
+
+    glm::dvec4 plane(normal, -glm::dot(normal, glm::dvec3(p0)));
+    for (size_t j = 0; j < 3; j++)
+    {
+      quadrics[positionRoots[indices[i + j]]].addPlane(plane);
+    }
+  }
+}
+
+std::vector<unsigned int> MeshSimplifier::simplify(size_t targetIndexCount, float *resultError) const
+{
+  const size_t triangleCount = indices.size() / 3;
+
+  // 단순화 과정에서 수정될 삼각형 인덱스 및 quadric 작업용 복사본
+  std::vector<unsigned int> triangles(indices.begin(), indices.begin() + triangleCount * 3);
+  std::vector<Quadric> workQuadrics = quadrics;
+  std::vector<bool> removedTriangles(triangleCount, false);
+  std::vector<bool> collapsedVertices(positions.size(), false);
+
+  // 정점별로 해당 정점을 사용하는 삼각형 목록 (합쳐진 정점의 삼각형은 합친 정점의 목록에 이어붙임)
+  std::vector<std::vector<unsigned int>> vertexTriangles(positions.size());
+  for (unsigned int t = 0; t < triangleCount; t++)
+  {
+    for (size_t j = 0; j < 3; j++)
+    {
+      vertexTriangles[triangles[t * 3 + j]].push_back(t);
+    }
+  }
+
+  auto collapseCost = [&](unsigned int from, unsigned int to)
+  {
+    Quadric quadric = workQuadrics[positionRoots[from]];
+    quadric.add(workQuadrics[positionRoots[to]]);
+    return quadric.evaluate(positions[to]);
+  };
+
+  std::priority_queue<Collapse> queue;
+  auto pushCollapse = [&](unsigned int from, unsigned int to)
+  {
+    if (!locked[from] && from != to)
+    {
+      queue.push({collapseCost(from, to), from, to});
+    }
+  };
+
+  for (unsigned int t = 0; t < triangleCount; t++)
+  {
+    for (size_t j = 0; j < 3; j++)
+    {
+      unsigned int a = triangles[t * 3 + j];
+      unsigned int b = triangles[t * 3 + (j + 1) % 3];
+      pushCollapse(a, b);
+      pushCollapse(b, a);
+    }
+  }
+
+  size_t liveTriangleCount = triangleCount;
+  double maxCost = 0.0;
+
+  while (liveTriangleCount * 3 > targetIndexCount && !queue.empty())
+  {
+    Collapse collapse = queue.top();
+    queue.pop();
+
+    unsigned int from = collapse.from;
+    unsigned int to = collapse.to;
+
+    // 이미 합쳐진 정점이 포함된 후보는 무시
+    if (collapsedVertices[from] || collapsedVertices[to])
+    {
+      continue;
+    }
+
+    // 다른 collapse 로 인해 비용이 바뀌었다면 갱신된 비용으로 다시 후보에 넣음 (lazy update)
+    double cost = collapseCost(from, to);
+    if (cost > collapse.cost * (1.0 + 1e-6) + 1e-12)
+    {
+      queue.push({cost, from, to});
+      continue;
+    }
+
+    // from, to 정점이 아직 edge 로 연결되어 있는지 및 합쳤을 때 뒤집히는 삼각형이 없는지 검사
+    bool connected = false;
+    bool flipped = false;
+    for (unsigned int t : vertexTriangles[from])
+    {
+      if (removedTriangles[t])
+      {
+        continue;
+      }
+
+      const unsigned int *triangle = &triangles[t * 3];
+      if (triangle[0] == to || triangle[1] == to || triangle[2] == to)
+      {
+        connected = true;
+        continue;
+      }
+
+      glm::vec3 p[3];
+      glm::vec3 q[3];
+      for (size_t j = 0; j < 3; j++)
+      {
+        p[j] = positions[triangle[j]];
+        q[j] = triangle[j] == from ? positions[to] : p[j];
+      }
+
+      glm::vec3 before = triangleNormal(p[0], p[1], p[2]);
+      glm::vec3 after = triangleNormal(q[0], q[1], q[2]);
+      if (glm::dot(before, after) <= 0.0f)
+      {
+        flipped = true;
+        break;
+      }
+    }
+
+    if (!connected || flipped)
+    {
+      continue;
+    }
+
+    /* edge collapse 수행 : from 정점을 사용하는 삼각형들을 to 정점을 사용하도록 변경 */
+    for (unsigned int t : vertexTriangles[from])
+    {
+      if (removedTriangles[t])
+      {
+        continue;
+      }
+
+      unsigned int *triangle = &triangles[t * 3];
+      if (triangle[0] == to || triangle[1] == to || triangle[2] == to)
+      {
+        // from-to edge 를 공유하던 삼각형은 면적이 0 이 되므로 제거
+        removedTriangles[t] = true;
+        liveTriangleCount--;
+        continue;
+      }
+
+      for (size_t j = 0; j < 3; j++)
+      {
+        if (triangle[j] == from)
+        {
+          triangle[j] = to;
+        }
+      }
+      vertexTriangles[to].push_back(t);
+    }
+
+    collapsedVertices[from] = true;
+    vertexTriangles[from].clear();
+    workQuadrics[positionRoots[to]].add(workQuadrics[positionRoots[from]]);
+    maxCost = std::max(maxCost, cost);
+
+    // to 정점 주변의 edge 들을 새로운 후보로 추가
+    for (unsigned int t : vertexTriangles[to])
+    {
+      if (removedTriangles[t])
+      {
+        continue;
+      }
+
+      for (size_t j = 0; j < 3; j++)
+      {
+        unsigned int other = triangles[t * 3 + j];
+        if (other != to)
+        {
+          pushCollapse(other, to);
+          pushCollapse(to, other);
+        }
+      }
+    }
+  }
+
+  // 제거되지 않은 삼각형들만 모아서 단순화된 인덱스 버퍼 생성
+  std::vector<unsigned int> result;
+  result.reserve(liveTriangleCount * 3);
+  for (unsigned int t = 0; t < triangleCount; t++)
+  {
+    if (!removedTriangles[t])
+    {
+      result.insert(result.end(), triangles.begin() + t * 3, triangles.begin() + t * 3 + 3);
+    }
+  }
+
+  if (resultError)
+  {
+    *resultError = static_cast<float>(std::sqrt(maxCost));
+  }
+
+  return result;
+}
@@ -0,0 +1,297 @@
+#include "mesh/meshlet.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// x86 계열에서 SSE2 명령어를 사용할 수 있으면 SIMD 경로로 컴파일 (frustum.cpp 참고)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MESHLET_USE_SSE 1
+#include <emmintrin.h>
+#else
+#define MESHLET_USE_SSE 0
+#endif
+
+namespace
+{
+  // normal 들이 이 값보다 넓게 퍼져있는 meshlet 은 cone 으로 backface culling 할 수 없는 것으로 간주 (약 84도)
+  constexpr float MIN_CONE_DOT = 0.1f;
+
+  constexpr unsigned int INVALID_MESHLET = std::numeric_limits<unsigned int>::max();
+
+  // meshlet 삼각형들의 normal 로 normal cone 계산
+  void computeNormalCone(const std::vector<glm::vec3> &triangleNormals, const std::vector<unsigned int> &triangles, Meshlet &meshlet)
+  {
+    glm::vec3 axis(0.0f);
+    for (unsigned int triangle : triangles)
+    {
+      axis += triangleNormals[triangle];
+    }
+
+    float axisLength = glm::length(axis);
+    if (axisLength <= 0.0f)
+    {
+      return;
+    }
+    axis /= axisLength;
+
+    // 넓이가 0 인 삼각형(normal 이 0 벡터)은 화면에 그려지지 않으므로 cone 계산에서 제외
+    float minDot = 1.0f;
+    for (unsigned int triangle : triangles)
+    {
+      const glm::vec3 &normal = triangleNormals[triangle];
+      if (normal != glm::vec3(0.0f))
+      {
+        minDot = std::min(minDot, glm::dot(normal, axis));
+      }
+    }
+
+    meshlet.coneAxis = axis;
+    meshlet.coneCutoff = minDot <= MIN_CONE_DOT ? 1.0f : std::sqrt(1.0f - minDot * minDot);
+  }
+} // namespace
+
+namespace MeshletBuilder
+{
+  std::vector<Meshlet> build(const std::vector<glm::vec3> &positions, std::vector<unsigned int> &indices, size_t maxVertices, size_t maxTriangles)
+  {
+    std::vector<Meshlet> meshlets;
+
+    const size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0)
+    {
+      return meshlets;
+    }
+
+    // 삼각형별 단위 normal 및 무게중심 계산
+    std::vector<glm::vec3> triangleNormals(triangleCount);
+    std::vector<glm::vec3> triangleCentroids(triangleCount);
+    for (size_t t = 0; t < triangleCount; t++)
+    {
+      const glm::vec3 &p0 = positions[indices[t * 3 + 0]];
+      const glm::vec3 &p1 = positions[indices[t * 3 + 1]];
+      const glm::vec3 &p2 = positions[indices[t * 3 + 2]];
+
+      glm::vec3 normal = glm::cross(p1 - p0, p2 - p0);
+      float length = glm::length(normal);
+      triangleNormals[t] = length > 0.0f ? normal / length : glm::vec3(0.0f);
+      triangleCentroids[t] = (p0 + p1 + p2) / 3.0f;
+    }
+
+    /*
+      정점 -> 정점을 공유하는 삼각형 목록 (CSR 형태의 인접 리스트)
+
+      -> vertexTriangles[vertexTriangleOffsets[v], vertexTriangleOffsets[v + 1]) 구간이 v 번째 정점을 사용하는 삼각형들
+    */
+    std::vector<unsigned int> vertexTriangleOffsets(positions.size() + 1, 0);
+    for (unsigned int index : indices)
+    {
+      vertexTriangleOffsets[index + 1]++;
+    }
+    for (size_t v = 0; v < positions.size(); v++)
+    {
+      vertexTriangleOffsets[v + 1] += vertexTriangleOffsets[v];
+    }
+
+    std::vector<unsigned int> vertexTriangles(indices.size());
+    std::vector<unsigned int> fillCursor(vertexTriangleOffsets.begin(), vertexTriangleOffsets.end() - 1);
+    for (size_t i = 0; i < indices.size(); i++)
+    {
+      vertexTriangles[fillCursor[indices[i]]++] = static_cast<unsigned int>(i / 3);
+    }
+
+    std::vector<std::uint8_t> emitted(triangleCount, 0);
+    std::vector<unsigned int> vertexMeshlet(positions.size(), INVALID_MESHLET); // 정점이 마지막으로 포함된 meshlet 번호
+    std::vector<unsigned int> reorderedIndices;
+    reorderedIndices.reserve(indices.size());
+
+    std::vector<unsigned int> meshletTriangles;
+    std::vector<unsigned int> candidates;
+    std::vector<glm::vec3> meshletPositions;
+    meshletTriangles.reserve(maxTriangles);
+    meshletPositions.reserve(maxTriangles * 3);
+
+    size_t seedTriangle = 0;
+    while (true)
+    {
+      // 아직 meshlet 에 포함되지 않은 첫 번째 삼각형에서 새 meshlet 시작
+      while (seedTriangle < triangleCount && emitted[seedTriangle])
+      {
+        seedTriangle++;
+      }
+      if (seedTriangle == triangleCount)
+      {
+        break;
+      }
+
+      const unsigned int meshletIndex = static_cast<unsigned int>(meshlets.size());
+      size_t meshletVertexCount = 0;
+      glm::vec3 centroidSum(0.0f);
+      meshletTriangles.clear();
+      candidates.clear();
+
+      // 삼각형을 meshlet 에 추가하고, 새로 추가된 정점을 공유하는 삼각형들을 후보에 추가
+      auto addTriangle = [&](unsigned int triangle)
+      {
+        emitted[triangle] = 1;
+        meshletTriangles.push_back(triangle);
+        centroidSum += triangleCentroids[triangle];
+
+        for (size_t k = 0; k < 3; k++)
+        {
+          unsigned int vertex = indices[triangle * 3 + k];
+          if (vertexMeshlet[vertex] == meshletIndex)
+          {
+            continue;
+          }
+
+          vertexMeshlet[vertex] = meshletIndex;
+          meshletVertexCount++;
+
+          for (unsigned int j = vertexTriangleOffsets[vertex]; j < vertexTriangleOffsets[vertex + 1]; j++)
+          {
+            if (!emitted[vertexTriangles[j]])
+            {
+              candidates.push_back(vertexTriangles[j]);
+            }
+          }
+        }
+      };
+
+      addTriangle(static_cast<unsigned int>(seedTriangle));
+
+      while (meshletTriangles.size() < maxTriangles)
+      {
+        /*
+          후보 삼각형 중 meshlet 에 새로 추가되는 정점이 가장 적은 삼각형 선택
+
+          -> 새 정점 개수가 같으면 meshlet 중심에 가까운 삼각형을 선택하여 meshlet 이 둥근 모양으로 자라도록 함.
+          (bounding sphere 가 작을수록, normal 이 모여있을수록 culling 효율이 높아짐)
+        */
+        const glm::vec3 center = centroidSum / static_cast<float>(meshletTriangles.size());
+        unsigned int bestTriangle = INVALID_MESHLET;
+        size_t bestNewVertexCount = 4;
+        float bestDistance = std::numeric_limits<float>::max();
+
+        for (size_t c = 0; c < candidates.size();)
+        {
+          unsigned int triangle = candidates[c];
+
+          // 이미 meshlet 에 포함된 후보는 목록에서 제거
+          if (emitted[triangle])
+          {
+            candidates[c] = candidates.back();
+            candidates.pop_back();
+            continue;
+          }
+          c++;
+
+          size_t newVertexCount = 0;
+          for (size_t k = 0; k < 3; k++)
+          {
+            newVertexCount += vertexMeshlet[indices[triangle * 3 + k]] != meshletIndex ? 1 : 0;
+          }
+
+          if (meshletVertexCount + newVertexCount > maxVertices)
+          {
+            continue;
+          }
+
+          glm::vec3 offset = triangleCentroids[triangle] - center;
+          float distance = glm::dot(offset, offset);
+          if (newVertexCount < bestNewVertexCount || (newVertexCount == bestNewVertexCount && distance < bestDistance))
+          {
+            bestTriangle = triangle;
+            bestNewVertexCount = newVertexCount;
+            bestDistance = distance;
+          }
+        }
+
+        // 정점 한도 내에서 추가할 수 있는 인접 삼각형이 없으면 meshlet 완성
+        if (bestTriangle == INVALID_MESHLET)
+        {
+          break;
+        }
+
+        addTriangle(bestTriangle);
+      }
+
+      // meshlet 의 삼각형들을 재정렬된 인덱스 배열에 이어붙이고 bounding sphere 및 normal cone 계산
+      Meshlet meshlet;
+      meshlet.indexOffset = reorderedIndices.size();
+      meshlet.indexCount = meshletTriangles.size() * 3;
+
+      meshletPositions.clear();
+      for (unsigned int triangle : meshletTriangles)
+      {
+        for (size_t k = 0; k < 3; k++)
+        {
+          reorderedIndices.push_back(indices[triangle * 3 + k]);
+          meshletPositions.push_back(positions[indices[triangle * 3 + k]]);
+        }
+      }
+
+      meshlet.sphere = computeBoundingSphere(meshletPositions);
+      computeNormalCone(triangleNormals, meshletTriangles, meshlet);
+
+      meshlets.push_back(meshlet);
+    }
+
+    indices.swap(reorderedIndices);
+
+    return meshlets;
+  }
+
+  void cull(const MeshletBatch &meshlets, const Frustum &frustum, const glm::vec3 &cameraPosition, size_t begin, size_t end, std::uint8_t *visible)
+  {
+    // bounding sphere 로 절두체 바깥의 meshlet 을 먼저 걸러냄
+    frustum.cullSpheres(meshlets.spheres, begin, end, visible);
+
+    /*
+      normal cone 기반 backface culling
+
+      카메라에서 meshlet 중심을 향하는 벡터와 cone 축 사이의 각도로 판정하며,
+      dot(center - camera, axis) >= cutoff * |center - camera| + radius 이면
+      bounding sphere 내의 어느 위치에서 보더라도 모든 삼각형이 카메라 반대쪽을 향하므로 그리지 않음.
+    */
+    const BoundingSphereBatch &spheres = meshlets.spheres;
+    size_t i = begin;
+
+#if MESHLET_USE_SSE
+    // meshlet 4개씩 묶어서 동시에 검사
+    const __m128 cameraX = _mm_set1_ps(cameraPosition.x);
+    const __m128 cameraY = _mm_set1_ps(cameraPosition.y);
+    const __m128 cameraZ = _mm_set1_ps(cameraPosition.z);
+
+    for (; i + 4 <= end; i += 4)
+    {
+      __m128 offsetX = _mm_sub_ps(_mm_loadu_ps(&spheres.centerX[i]), cameraX);
+      __m128 offsetY = _mm_sub_ps(_mm_loadu_ps(&spheres.centerY[i]), cameraY);
+      __m128 offsetZ = _mm_sub_ps(_mm_loadu_ps(&spheres.centerZ[i]), cameraZ);
+
+      __m128 dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(offsetX, _mm_loadu_ps(&meshlets.coneAxisX[i])),
+                                         _mm_mul_ps(offsetY, _mm_loadu_ps(&meshlets.coneAxisY[i]))),
+                              _mm_mul_ps(offsetZ, _mm_loadu_ps(&meshlets.coneAxisZ[i])));
+      __m128 distance = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(offsetX, offsetX), _mm_mul_ps(offsetY, offsetY)), _mm_mul_ps(offsetZ, offsetZ)));
+      __m128 threshold = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&meshlets.coneCutoff[i]), distance), _mm_loadu_ps(&spheres.radius[i]));
+
+      int backfacing = _mm_movemask_ps(_mm_cmpge_ps(dot, threshold));
+      visible[i + 0] &= static_cast<std::uint8_t>(~(backfacing >> 0) & 1);
+      visible[i + 1] &= static_cast<std::uint8_t>(~(backfacing >> 1) & 1);
+      visible[i + 2] &= static_cast<std::uint8_t>(~(backfacing >> 2) & 1);
+      visible[i + 3] &= static_cast<std::uint8_t>(~(backfacing >> 3) & 1);
+    }
+#endif
+
+    // SIMD 로 처리하고 남은 meshlet (또는 SSE 미지원 환경의 모든 meshlet) 은 scalar 로 검사
+    for (; i < end; i++)
+    {
+      glm::vec3 offset = glm::vec3(spheres.centerX[i], spheres.centerY[i], spheres.centerZ[i]) - cameraPosition;
+      glm::vec3 axis(meshlets.coneAxisX[i], meshlets.coneAxisY[i], meshlets.coneAxisZ[i]);
+
+      if (glm::dot(offset, axis) >= meshlets.coneCutoff[i] * glm::length(offset) + spheres.radius[i])
+      {
+        visible[i] = 0;
+      }
+    }
+  }
+} // namespace MeshletBuilder
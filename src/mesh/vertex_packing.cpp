@@ -0,0 +1,141 @@
+#include "mesh/vertex_packing.hpp"
+#include <glm/gtc/packing.hpp> // packSnorm3x10_1x2(), packHalf1x16() 등 압축 관련 함수
+#include <limits>
+
+std::uint32_t VertexPacking::packNormal(const glm::vec3 &normal)
+{
+  return glm::packSnorm3x10_1x2(glm::vec4(normal, 0.0f));
+}
+
+std::uint32_t VertexPacking::packTangent(const glm::vec3 &normal, const glm::vec3 &tangent, const glm::vec3 &bitangent)
+{
+  // Gram-Schmidt 직교화로 tangent 를 normal 에 수직이 되도록 보정 (uv 가 없는 mesh 는 tangent 가 0 벡터이므로 그대로 둠)
+  glm::vec3 t = tangent - normal * glm::dot(normal, tangent);
+  float length = glm::length(t);
+  t = length > 0.0f ? t / length : glm::vec3(0.0f);
+
+  /*
+    bitangent 는 cross(normal, tangent) 와 같은 방향이거나 반대 방향이므로,
+    방향 부호만 w 성분에 저장하고 버텍스 쉐이더에서 cross(N, T) * sign(w) 로 복원함.
+
+    -> 2 bits snorm 의 변환 규칙이 GL 버전마다 다르므로(-1 이 -1/3 또는 -1 로 복원됨),
+    쉐이더에서는 w 값 자체가 아닌 sign(w) 만 사용할 것!
+  */
+  float handedness = glm::dot(glm::cross(normal, t), bitangent) < 0.0f ? -1.0f : 1.0f;
+
+  return glm::packSnorm3x10_1x2(glm::vec4(t, handedness));
+}
+
+void VertexPacking::packTexCoords(const glm::vec2 &texCoords, std::uint16_t (&packed)[2])
+{
+  packed[0] = glm::packHalf1x16(texCoords.x);
+  packed[1] = glm::packHalf1x16(texCoords.y);
+}
+
+PositionDequantization VertexPacking::pack(const std::vector<VertexData> &vertices, std::vector<VertexData> &packedVertices)
+{
+  packedVertices = vertices;
+  return PositionDequantization();
+}
+
+PositionDequantization VertexPacking::pack(const std::vector<VertexData> &vertices, std::vector<PackedVertexData> &packedVertices)
+{
+  packedVertices.resize(vertices.size());
+
+  for (size_t i = 0; i < vertices.size(); i++)
+  {
+    const VertexData &vertex = vertices[i];
+    PackedVertexData &packed = packedVertices[i];
+
+    packed.Position = vertex.Position;
+    packed.Normal = packNormal(vertex.Normal);
+    packed.Tangent = packTangent(vertex.Normal, vertex.Tangent, vertex.Bitangent);
+    packTexCoords(vertex.TexCoords, packed.TexCoords);
+  }
+
+  return PositionDequantization();
+}
+
+PositionDequantization VertexPacking::pack(const std::vector<VertexData> &vertices, std::vector<QuantizedVertexData> &packedVertices)
+{
+  packedVertices.resize(vertices.size());
+
+  // 양자화 기준이 될 mesh 의 AABB 계산
+  glm::vec3 minPosition(std::numeric_limits<float>::max());
+  glm::vec3 maxPosition(std::numeric_limits<float>::lowest());
+  for (const VertexData &vertex : vertices)
+  {
+    minPosition = glm::min(minPosition, vertex.Position);
+    maxPosition = glm::max(maxPosition, vertex.Position);
+  }
+
+  PositionDequantization dequantization;
+  if (vertices.empty())
+  {
+    return dequantization;
+  }
+
+  // AABB 크기가 0 인 축(ex> 평면 mesh)은 0 으로 나누지 않도록 scale 을 1 로 둠
+  glm::vec3 extent = maxPosition - minPosition;
+  dequantization.scale = glm::vec3(
+      extent.x > 0.0f ? extent.x : 1.0f,
+      extent.y > 0.0f ? extent.y : 1.0f,
+      extent.z > 0.0f ? extent.z : 1.0f);
+  dequantization.offset = minPosition;
+
+  for (size_t i = 0; i < vertices.size(); i++)
+  {
+    const VertexData &vertex = vertices[i];
+    QuantizedVertexData &packed = packedVertices[i];
+
+    // AABB 기준으로 [0, 1] 범위로 정규화한 position 을 unorm16 으로 양자화
+    glm::vec3 normalized = (vertex.Position - dequantization.offset) / dequantization.scale;
+    packed.Position[0] = glm::packUnorm1x16(normalized.x);
+    packed.Position[1] = glm::packUnorm1x16(normalized.y);
+    packed.Position[2] = glm::packUnorm1x16(normalized.z);
+    packed.Position[3] = 0;
+
+    packed.Normal = packNormal(vertex.Normal);
+    packed.Tangent = packTangent(vertex.Normal, vertex.Tangent, vertex.Bitangent);
+    packTexCoords(vertex.TexCoords, packed.TexCoords);
+  }
+
+  return dequantization;
+}
+
+void VertexPacking::packSkinning(const std::vector<VertexData> &vertices, std::vector<SkinVertexData> &skinVertices)
+{
+  skinVertices.resize(vertices.size());
+
+  for (size_t i = 0; i < vertices.size(); i++)
+  {
+    const VertexData &vertex = vertices[i];
+    SkinVertexData &packed = skinVertices[i];
+
+    float totalWeight = 0.0f;
+    for (int j = 0; j < MAX_BONE_INFLUENCE; j++)
+    {
+      totalWeight += vertex.m_Weights[j];
+    }
+
+    int quantizedTotal = 0;
+    int largest = 0;
+    for (int j = 0; j < MAX_BONE_INFLUENCE; j++)
+    {
+      packed.BoneIDs[j] = static_cast<std::uint8_t>(vertex.m_BoneIDs[j]);
+      packed.Weights[j] = totalWeight > 0.0f ? static_cast<std::uint8_t>(vertex.m_Weights[j] / totalWeight * 255.0f + 0.5f) : 0;
+      quantizedTotal += packed.Weights[j];
+
+      if (vertex.m_Weights[j] > vertex.m_Weights[largest])
+      {
+        largest = j;
+      }
+    }
+
+    // 반올림 오차로 합이 255 에서 벗어난 만큼을 가장 큰 weight 에서 보정
+    if (quantizedTotal > 0)
+    {
+      packed.Weights[largest] = static_cast<std::uint8_t>(packed.Weights[largest] + (255 - quantizedTotal));
+    }
+  }
+}
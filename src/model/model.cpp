@@ -1,21 +1,435 @@
 #include "model/model.hpp"
+#include "mesh/vertex_packing.hpp"
+#include "mesh/mesh_simplifier.hpp"
+#include "mesh/bounding_volume.hpp"
+#include "mesh/meshlet.hpp"
+#include "constants/model_constants.hpp"
+#include "gl_objects/texture_cache.hpp"
+#include "constants/animation_constants.hpp"
 
 // glm 라이브러리 사용을 위한 헤더파일 포함
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
 
-Model::Model(const std::string &path)
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+Model::Model(const std::string &path, const ModelLoadOptions &options, std::shared_ptr<ModelGeometryArenas> geometryArenas, ThreadPool *threadPool)
+    : options(options), geometryArenas(geometryArenas), threadPool(threadPool)
 {
   // 생성자에서 Assimp 로 모델 로드하는 함수 곧바로 호출
   loadModel(path);
+
+  // cull() 이 호출되기 전에는 모든 Mesh 를 그리도록 초기화
+  worldSpheres.resize(meshes.size());
+  meshVisibility.assign(meshes.size(), 1);
+
+  // 로드 직후 모든 노드가 dirty 상태이므로, 각 Mesh 에 노드의 world transform 을 전달
+  updateTransforms();
+}
+
+Model::~Model()
+{
+  if (!geometryArenas)
+  {
+    return;
+  }
+
+  for (const auto &mesh : meshes)
+  {
+    // skinning 되는 Mesh 는 arena 를 사용하지 않고 자신의 버퍼를 소유함
+    if (mesh->isSkinned())
+    {
+      continue;
+    }
+
+    const MeshGeometry &geometry = mesh->getGeometry();
+    if (geometry.indexType == GL_UNSIGNED_SHORT)
+    {
+      geometryArenas->shortIndexed.free(geometry);
+    }
+    else
+    {
+      geometryArenas->indexed.free(geometry);
+    }
+  }
+}
+
+size_t Model::updateTransforms()
+{
+  size_t updatedCount = sceneGraph.updateWorldTransforms();
+
+  // world transform 이 갱신된 노드에 속한 Mesh 들만 순회
+  for (int node : sceneGraph.getUpdatedNodes())
+  {
+    const glm::mat4 &worldTransform = sceneGraph.getWorldTransform(node);
+    for (size_t i = nodeMeshOffsets[node]; i < nodeMeshOffsets[node + 1]; i++)
+    {
+      // skinning 되는 Mesh 는 bone palette 에 joint 들의 transform 이 이미 반영되어 있으므로 노드의 world transform 을 적용하지 않음
+      if (!meshes[i]->isSkinned())
+      {
+        meshes[i]->setNodeTransform(worldTransform);
+      }
+    }
+  }
+
+  return updatedCount;
 }
 
-void Model::draw(Shader &shader)
+SceneGraph &Model::getSceneGraph()
 {
+  return sceneGraph;
+}
+
+unsigned int Model::draw(Shader &shader)
+{
+  unsigned int drawCallCount = 0;
+
+  // arena 를 사용하지 않거나 multi draw indirect 를 지원하지 않으면 기존처럼 Mesh 마다 draw call 호출
+  if (!geometryArenas || !GLExtensions::hasMultiDrawIndirect())
+  {
+    for (unsigned int i = 0; i < meshes.size(); i++)
+    {
+      if (meshVisibility[i] && !meshes[i]->isSkinned())
+      {
+        meshes[i]->draw(shader);
+        drawCallCount++;
+      }
+    }
+    return drawCallCount + drawSkinnedMeshes(shader);
+  }
+
+  /*
+    같은 arena 와 같은 텍스쳐들을 사용하는 연속된 Mesh 들의 현재 LOD 를 indirect command 로 기록해두었다가
+    하나의 glMultiDrawElementsIndirect() 로 그림.
+
+    -> 각 command 의 baseInstance 는 drawData 배열에서 해당 Mesh 의 노드 world transform 및 dequantization 변환 위치를 가리킴.
+  */
+  const Mesh<ModelVertexData> *batchMesh = nullptr;
   for (unsigned int i = 0; i < meshes.size(); i++)
   {
-    meshes[i]->draw(shader);
+    // meshlet 이 모두 culling 된 Mesh 는 command 를 기록하지 않고, arena 를 사용하지 않는 skinning Mesh 는 따로 그림
+    if (!meshVisibility[i] || meshes[i]->isSkinned() || (meshes[i]->isUsingVisibleMeshlets() && meshes[i]->getVisibleMeshletRanges().empty()))
+    {
+      continue;
+    }
+
+    if (batchMesh && !canBatch(*batchMesh, *meshes[i]))
+    {
+      flushDrawCommands(shader, *batchMesh);
+      drawCallCount++;
+      batchMesh = nullptr;
+    }
+
+    if (!batchMesh)
+    {
+      batchMesh = meshes[i].get();
+    }
+
+    // meshlet culling 결과를 사용하는 Mesh 는 보이는 구간마다 command 를 기록하고, 모든 구간은 같은 per-draw 데이터를 가리킴
+    if (meshes[i]->isUsingVisibleMeshlets())
+    {
+      for (const MeshIndexRange &range : meshes[i]->getVisibleMeshletRanges())
+      {
+        drawCommands.push_back(meshes[i]->getIndirectCommand(range, static_cast<GLuint>(drawData.size())));
+      }
+    }
+    else
+    {
+      drawCommands.push_back(meshes[i]->getIndirectCommand(static_cast<GLuint>(drawData.size())));
+    }
+    drawData.push_back(meshes[i]->getDrawData());
+  }
+
+  if (batchMesh)
+  {
+    flushDrawCommands(shader, *batchMesh);
+    drawCallCount++;
+  }
+
+  return drawCallCount + drawSkinnedMeshes(shader);
+}
+
+bool Model::canBatch(const Mesh<ModelVertexData> &a, const Mesh<ModelVertexData> &b)
+{
+  if (a.getGeometry().indexType != b.getGeometry().indexType || a.textures.size() != b.textures.size())
+  {
+    return false;
+  }
+
+  for (size_t i = 0; i < a.textures.size(); i++)
+  {
+    if (a.textures[i].id != b.textures[i].id || a.textures[i].type != b.textures[i].type)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void Model::flushDrawCommands(Shader &shader, const Mesh<ModelVertexData> &batchMesh)
+{
+  // batch 내의 모든 Mesh 가 같은 텍스쳐들을 사용하므로 첫 번째 Mesh 의 텍스쳐만 바인딩
+  batchMesh.bindTextures(shader);
+
+  if (batchMesh.getGeometry().indexType == GL_UNSIGNED_SHORT)
+  {
+    geometryArenas->shortIndexed.multiDraw(GL_TRIANGLES, drawCommands, drawData);
+  }
+  else
+  {
+    geometryArenas->indexed.multiDraw(GL_TRIANGLES, drawCommands, drawData);
+  }
+
+  drawCommands.clear();
+  drawData.clear();
+}
+
+unsigned int Model::drawSkinnedMeshes(Shader &shader)
+{
+  if (!animator)
+  {
+    return 0;
+  }
+
+  // 쉐이더의 BonePalette uniform block 이 연결된 binding point 에 bone palette UBO 를 연결하고, skinning 을 켠 상태로 그림
+  bonePaletteUbo->bindBase(AnimationConstants::BONE_PALETTE_BINDING);
+  shader.setBool("skinned", true);
+
+  unsigned int drawCallCount = 0;
+  for (size_t i = 0; i < meshes.size(); i++)
+  {
+    if (meshVisibility[i] && meshes[i]->isSkinned())
+    {
+      meshes[i]->draw(shader);
+      drawCallCount++;
+    }
+  }
+
+  // 같은 쉐이더로 그려지는 다른 물체들에 skinning 이 적용되지 않도록 다시 끔
+  shader.setBool("skinned", false);
+
+  return drawCallCount;
+}
+
+void Model::cull(const glm::mat4 &transform, const Frustum &frustum)
+{
+  // 각 Mesh 의 bounding sphere 를 world space 로 변환하여 SoA 배열에 저장
+  for (size_t i = 0; i < meshes.size(); i++)
+  {
+    worldSpheres.set(i, transformBoundingSphere(meshes[i]->getBoundingSphere(), transform * meshes[i]->getNodeTransform()));
+  }
+
+  // bounding sphere 로 절두체 바깥의 Mesh 들을 SIMD 로 빠르게 걸러냄
+  frustum.cullSpheres(worldSpheres, meshVisibility);
+
+  // bounding sphere 는 길쭉한 mesh 를 느슨하게 감싸므로, 통과한 Mesh 는 더 타이트한 AABB 로 한번 더 검사
+  for (size_t i = 0; i < meshes.size(); i++)
+  {
+    if (meshVisibility[i] && !frustum.intersects(transformBoundingBox(meshes[i]->getBoundingBox(), transform * meshes[i]->getNodeTransform())))
+    {
+      meshVisibility[i] = 0;
+    }
+
+    // skinning 되는 Mesh 의 bounding volume 은 bind pose 기준이라 애니메이션 중에는 실제 범위를 감싸지 못하므로 항상 그림
+    if (meshes[i]->isSkinned())
+    {
+      meshVisibility[i] = 1;
+    }
+  }
+}
+
+bool Model::isMeshVisible(size_t index) const
+{
+  return meshVisibility[index] != 0;
+}
+
+void Model::selectLods(const glm::mat4 &transform, const glm::vec3 &cameraPosition, float projectionScale)
+{
+  for (const auto &mesh : meshes)
+  {
+    const std::vector<MeshLod> &lods = mesh->getLods();
+
+    // world space 로 변환한 bounding sphere 의 화면상 지름(pixel) 계산
+    BoundingSphere sphere = transformBoundingSphere(mesh->getBoundingSphere(), transform * mesh->getNodeTransform());
+    float distance = glm::length(sphere.center - cameraPosition);
+
+    // 카메라가 bounding sphere 내부에 있으면 화면을 가득 채우므로 항상 가장 정밀한 LOD 를 사용
+    size_t lod = mesh->getCurrentLod();
+    if (distance <= sphere.radius)
+    {
+      mesh->setCurrentLod(0);
+      continue;
+    }
+    float screenSize = 2.0f * sphere.radius * projectionScale / distance;
+
+    /*
+      hysteresis 를 적용하여 LOD 전환
+
+      더 거친 LOD 로 전환할 때는 경계값보다 일정 비율 더 작아져야 하고,
+      더 정밀한 LOD 로 돌아올 때는 경계값보다 일정 비율 더 커져야 전환되도록 하여
+      경계값 부근에서 매 프레임 LOD 가 바뀌며 popping 이 발생하는 것을 방지함.
+    */
+    while (lod + 1 < lods.size() && screenSize < ModelConstants::LOD_SCREEN_SIZES[lod + 1] * (1.0f - ModelConstants::LOD_HYSTERESIS))
+    {
+      lod++;
+    }
+    while (lod > 0 && screenSize > ModelConstants::LOD_SCREEN_SIZES[lod] * (1.0f + ModelConstants::LOD_HYSTERESIS))
+    {
+      lod--;
+    }
+
+    mesh->setCurrentLod(lod);
+  }
+}
+
+MeshletCullStats Model::cullMeshlets(const glm::mat4 &viewProjection, const glm::mat4 &transform, const glm::vec3 &cameraPosition, ThreadPool &threadPool)
+{
+  MeshletCullStats stats;
+
+  // 보이는 Mesh 들 중 LOD 0 으로 그려질 Mesh 의 meshlet 들만 CULL_BATCH_SIZE 개씩 작업으로 나눔
+  meshletCullJobs.clear();
+  for (size_t i = 0; i < meshes.size(); i++)
+  {
+    Mesh<ModelVertexData> &mesh = *meshes[i];
+    if (!meshVisibility[i] || mesh.getMeshletCount() == 0 || mesh.getCurrentLod() != 0)
+    {
+      mesh.clearVisibleMeshlets();
+      continue;
+    }
+
+    /*
+      meshlet 의 bounding volume 은 Mesh 의 object space 기준이므로,
+      world space 로 변환하는 대신 절두체와 카메라 위치를 object space 로 변환하여 검사함.
+      -> clip space 행렬에 object -> world 행렬을 곱해서 추출한 절두체 평면은 object space 평면이 됨.
+    */
+    const glm::mat4 meshTransform = transform * mesh.getNodeTransform();
+    const Frustum localFrustum(viewProjection * meshTransform);
+    const glm::vec3 localCameraPosition = glm::vec3(glm::inverse(meshTransform) * glm::vec4(cameraPosition, 1.0f));
+
+    for (size_t begin = 0; begin < mesh.getMeshletCount(); begin += MeshletConstants::CULL_BATCH_SIZE)
+    {
+      meshletCullJobs.push_back({&mesh, localFrustum, localCameraPosition, begin, std::min(begin + MeshletConstants::CULL_BATCH_SIZE, mesh.getMeshletCount())});
+    }
+  }
+
+  // 각 작업은 Mesh 의 가시성 배열에서 서로 겹치지 않는 구간에만 기록하므로 동기화 없이 병렬로 실행 가능
+  threadPool.parallelFor(meshletCullJobs.size(), 1, [this](size_t begin, size_t end)
+                         {
+                           for (size_t i = begin; i < end; i++)
+                           {
+                             const MeshletCullJob &job = meshletCullJobs[i];
+                             MeshletBuilder::cull(job.mesh->getMeshletBatch(), job.frustum, job.cameraPosition, job.begin, job.end, job.mesh->getMeshletVisibility());
+                           } });
+
+  // 모든 검사가 끝나면 Mesh 마다 보이는 meshlet 구간들을 이어붙임
+  for (size_t i = 0; i < meshes.size(); i++)
+  {
+    Mesh<ModelVertexData> &mesh = *meshes[i];
+    if (!meshVisibility[i] || mesh.getMeshletCount() == 0 || mesh.getCurrentLod() != 0)
+    {
+      continue;
+    }
+
+    stats.meshletCount += mesh.getMeshletCount();
+    stats.culledTriangleCount += mesh.compactVisibleMeshlets();
+
+    const std::uint8_t *visibility = mesh.getMeshletVisibility();
+    stats.culledMeshletCount += static_cast<size_t>(std::count(visibility, visibility + mesh.getMeshletCount(), std::uint8_t(0)));
+  }
+
+  return stats;
+}
+
+size_t Model::updateAnimation(float deltaTime)
+{
+  if (!animator)
+  {
+    return 0;
+  }
+
+  size_t jointCount = animator->update(deltaTime);
+
+  // bone 개수만큼만 갱신 (UBO 는 쉐이더의 uniform block 크기인 MAX_BONES 개로 할당되어 있고, 노멀 행렬 배열은 skinning 행렬 배열 뒤에 위치함)
+  const std::vector<glm::mat4> &palette = animator->getBonePalette();
+  bonePaletteUbo->setSubData(0, palette.data(), static_cast<GLsizeiptr>(palette.size() * sizeof(glm::mat4)));
+
+  const std::vector<glm::mat3x4> &normalPalette = animator->getBoneNormalPalette();
+  bonePaletteUbo->setSubData(static_cast<GLintptr>(AnimationConstants::MAX_BONES * sizeof(glm::mat4)), normalPalette.data(), static_cast<GLsizeiptr>(normalPalette.size() * sizeof(glm::mat3x4)));
+
+  return jointCount;
+}
+
+bool Model::isAnimated() const
+{
+  return animator != nullptr;
+}
+
+Animator *Model::getAnimator()
+{
+  return animator.get();
+}
+
+size_t Model::getSkinnedVertexCount() const
+{
+  return skinnedVertexCount;
+}
+
+bool Model::pick(const BvhRay &ray, const glm::mat4 &transform, ModelPickResult &result) const
+{
+  result = ModelPickResult();
+  float closest = std::numeric_limits<float>::max();
+
+  for (size_t i = 0; i < meshes.size(); i++)
+  {
+    const Bvh *bvh = meshes[i]->getBvh();
+    if (!bvh)
+    {
+      continue;
+    }
+
+    // 광선을 Mesh 의 object space 로 변환 (방향 벡터는 정규화하지 않아야 교차 거리가 world space 광선 기준으로 유지됨)
+    const glm::mat4 worldToObject = glm::inverse(transform * meshes[i]->getNodeTransform());
+    BvhRay localRay;
+    localRay.origin = glm::vec3(worldToObject * glm::vec4(ray.origin, 1.0f));
+    localRay.direction = glm::vec3(worldToObject * glm::vec4(ray.direction, 0.0f));
+
+    // 이전 Mesh 들에서 찾은 교차보다 먼 교차는 BVH 순회 중에 바로 걸러짐
+    BvhHit hit;
+    if (bvh->intersect(localRay, closest, hit))
+    {
+      closest = hit.distance;
+      result.meshIndex = static_cast<int>(i);
+      result.triangle = hit.triangle;
+      result.distance = hit.distance;
+    }
+  }
+
+  if (result.meshIndex < 0)
+  {
+    return false;
   }
+
+  result.position = ray.origin + ray.direction * result.distance;
+  return true;
+}
+
+size_t Model::getBvhNodeCount() const
+{
+  return bvhNodeCount;
+}
+
+size_t Model::getBvhMemorySize() const
+{
+  return bvhMemorySize;
+}
+
+float Model::getBvhBuildTimeMs() const
+{
+  return bvhBuildTimeMs;
 }
 
 void Model::loadModel(const std::string &path)
@@ -25,7 +439,9 @@ void Model::loadModel(const std::string &path)
 
   // 비트플래그 연산을 통해, 3D 모델을 Scene 구조로 불러올 때의 여러 가지 옵션들을 지정함
   // 비트플래그 및 비트마스킹 연산 관련 https://github.com/jooo0922/cpp-study/blob/main/TBCppStudy/Chapter3_9/Chapter3_9.cpp 참고
-  const aiScene *scene = importer.ReadFile(path, aiProcess_Triangulate | aiProcess_GenSmoothNormals | aiProcess_FlipUVs | aiProcess_CalcTangentSpace);
+  // (aiProcess_JoinIdenticalVertices 로 중복 정점을 합쳐서 정점 개수를 줄여야 대부분의 mesh 를 16-bit 인덱스로 그릴 수 있음)
+  // (aiProcess_LimitBoneWeights 로 정점마다 영향을 주는 bone 을 weight 가 큰 순서로 최대 4개까지만 남김)
+  const aiScene *scene = importer.ReadFile(path, aiProcess_Triangulate | aiProcess_JoinIdenticalVertices | aiProcess_GenSmoothNormals | aiProcess_FlipUVs | aiProcess_CalcTangentSpace | aiProcess_LimitBoneWeights);
 
   if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode)
   {
@@ -45,12 +461,76 @@ void Model::loadModel(const std::string &path)
   // std::string.substr() 는 string 에서 지정된 시작 위치와 마지막 위치 사이의 부분 문자열을 반환함.
   directory = path.substr(0, path.find_last_of('/'));
 
-  // Assimp Scene 구조를 따라 재귀적으로 하위 aiNode 들을 처리함
-  processNode(scene->mRootNode, scene);
+  // Assimp Scene 구조를 따라 재귀적으로 하위 aiNode 들을 처리하며 aiMesh 들을 import 작업으로 기록함
+  std::vector<MeshImportJob> jobs;
+  processNode(scene->mRootNode, scene, SceneGraph::NO_PARENT, jobs);
+
+  // 마지막 노드의 import 작업 범위가 끝나는 위치 기록
+  nodeMeshOffsets.push_back(jobs.size());
+
+  // aiMesh 변환 작업에서 bone 인덱스를 조회할 수 있도록 skeleton 및 애니메이션을 먼저 불러옴
+  loadSkeleton(scene);
+
+  /*
+    aiMesh 마다의 변환 작업은 서로 독립적이므로 스레드 풀에 나눠서 처리
+
+    -> aiMesh 마다 크기가 크게 다를 수 있으므로 작업을 하나씩 가져가도록 grain size 를 1 로 지정하여 부하를 고르게 분산함.
+  */
+  auto prepareJobs = [this, &jobs](size_t begin, size_t end)
+  {
+    for (size_t i = begin; i < end; i++)
+    {
+      prepareMesh(jobs[i].mesh, jobs[i].prepared);
+    }
+  };
+
+  if (threadPool)
+  {
+    threadPool->parallelFor(jobs.size(), 1, prepareJobs);
+  }
+  else
+  {
+    prepareJobs(0, jobs.size());
+  }
+
+  // GL 버퍼 생성 및 업로드는 렌더링 스레드에서 import 작업 순서대로 수행하고, 각 작업의 Mesh 들이 시작하는 위치를 기록
+  std::vector<size_t> jobMeshOffsets(jobs.size() + 1);
+  for (size_t i = 0; i < jobs.size(); i++)
+  {
+    jobMeshOffsets[i] = meshes.size();
+    for (PreparedMesh &prepared : jobs[i].prepared)
+    {
+      addMesh(prepared, jobs[i].textures);
+    }
+  }
+  jobMeshOffsets.back() = meshes.size();
+
+  // 노드별 import 작업 범위를 meshes 배열 범위로 변환
+  for (size_t &offset : nodeMeshOffsets)
+  {
+    offset = jobMeshOffsets[offset];
+  }
+
+  if (bvhNodeCount > 0)
+  {
+    spdlog::info("BVH built for <{}> ({} nodes, {:.2f} MB, {:.2f} ms summed over meshes)", path, bvhNodeCount, bvhMemorySize / (1024.0 * 1024.0), bvhBuildTimeMs);
+  }
 }
 
-void Model::processNode(aiNode *node, const aiScene *scene)
+void Model::processNode(aiNode *node, const aiScene *scene, int parentNode, std::vector<MeshImportJob> &jobs)
 {
+  /*
+    aiNode 의 부모 노드 기준 local transform 을 보존하여 scene graph 노드로 추가
+
+    -> aiMatrix4x4 는 행 우선(row-major) 으로 저장되어 있고 glm::mat4 는 열 우선(column-major) 이므로,
+    원소들을 그대로 읽어들인 뒤 전치(transpose)해서 변환함.
+  */
+  const glm::mat4 localTransform = glm::transpose(glm::make_mat4(&node->mTransformation.a1));
+  const int sceneNode = sceneGraph.addNode(node->mName.C_Str(), parentNode, localTransform);
+
+  // 노드의 Mesh 범위는 우선 import 작업 인덱스로 기록해두고, 모든 Mesh 가 추가된 뒤 meshes 배열 인덱스로 변환함
+  nodeMeshOffsets.push_back(jobs.size());
+
   // 현재 aiNode 에 포함된 aiMesh 개수만큼 반복문을 돌림
   for (unsigned int i = 0; i < node->mNumMeshes; i++)
   {
@@ -58,29 +538,151 @@ void Model::processNode(aiNode *node, const aiScene *scene)
     // aiScene.mMeshes 에 실제 각 aiMesh 의 주소값들이 저장되어 있으므로, 이 배열에서 aiMesh 의 주소값을 얻어옴.
     aiMesh *mesh = scene->mMeshes[node->mMeshes[i]];
 
-    // aiMesh 를 파싱하여 우리가 만든 Mesh 클래스 인스턴스로 반환받고(processMesh()), 동적배열 멤버에 추가
-    processMesh(mesh, scene);
+    // aiMesh 의 변환은 나중에 병렬로 처리하도록 import 작업으로 기록하고, 텍스쳐는 GL 호출이 필요하므로 지금 로드
+    MeshImportJob job;
+    job.mesh = mesh;
+    job.textures = loadMeshTextures(mesh, scene);
+    jobs.push_back(std::move(job));
   }
 
   // 현재 aiNode 의 mChildren 멤버에 저장된 자식노드들을 재귀적으로 순회해서 처리함
   for (unsigned int i = 0; i < node->mNumChildren; i++)
   {
-    processNode(node->mChildren[i], scene);
+    processNode(node->mChildren[i], scene, sceneNode, jobs);
+  }
+}
+
+void Model::loadSkeleton(const aiScene *scene)
+{
+  // joint 계층 구조는 scene graph 노드 계층 구조를 그대로 사용
+  skeleton.build(sceneGraph);
+
+  // 모든 aiMesh 가 참조하는 aiBone 들을 bone 으로 등록 (여러 aiMesh 가 같은 bone 을 참조하면 하나의 bone 인덱스를 공유함)
+  for (unsigned int i = 0; i < scene->mNumMeshes; i++)
+  {
+    const aiMesh *mesh = scene->mMeshes[i];
+    for (unsigned int b = 0; b < mesh->mNumBones; b++)
+    {
+      const aiBone *bone = mesh->mBones[b];
+      if (skeleton.addBone(bone->mName.C_Str(), glm::transpose(glm::make_mat4(&bone->mOffsetMatrix.a1))) < 0)
+      {
+        spdlog::warn("Bone <{}> does not match any node, its weights are ignored", bone->mName.C_Str());
+      }
+    }
+  }
+
+  if (skeleton.getBoneCount() == 0)
+  {
+    return;
+  }
+
+  // bone palette 는 쉐이더의 고정 크기 uniform block 에 업로드되므로, bone 이 너무 많으면 skinning 없이 bind pose 로 그림
+  if (skeleton.getBoneCount() > AnimationConstants::MAX_BONES)
+  {
+    spdlog::warn("Model has {} bones (max {}), skinning is disabled", skeleton.getBoneCount(), AnimationConstants::MAX_BONES);
+    return;
+  }
+
+  animations.reserve(scene->mNumAnimations);
+  for (unsigned int i = 0; i < scene->mNumAnimations; i++)
+  {
+    animations.emplace_back(scene->mAnimations[i], skeleton);
+    spdlog::info("Animation <{}> loaded ({:.2f} s)", animations.back().getName(), animations.back().getDuration());
+  }
+
+  // animations 배열은 이후 변경되지 않으므로 Animator 가 참조로 보관해도 안전함
+  animator = std::make_unique<Animator>(skeleton, animations);
+
+  bonePaletteUbo = std::make_unique<UniformBufferObject>();
+  bonePaletteUbo->setData(nullptr, static_cast<GLsizeiptr>(AnimationConstants::MAX_BONES * (sizeof(glm::mat4) + sizeof(glm::mat3x4))), GL_DYNAMIC_DRAW);
+
+  // 첫 프레임에 그려질 bone palette 를 미리 계산하여 업로드
+  updateAnimation(0.0f);
+
+  spdlog::info("Skeleton loaded ({} joints, {} bones, {} animations)", skeleton.getJointCount(), skeleton.getBoneCount(), animations.size());
+}
+
+void Model::assignBoneWeights(const aiMesh *mesh, std::vector<VertexData> &vertices) const
+{
+  for (unsigned int b = 0; b < mesh->mNumBones; b++)
+  {
+    const aiBone *bone = mesh->mBones[b];
+    const int boneIndex = skeleton.findBone(bone->mName.C_Str());
+    if (boneIndex < 0)
+    {
+      continue;
+    }
+
+    for (unsigned int w = 0; w < bone->mNumWeights; w++)
+    {
+      const aiVertexWeight &weight = bone->mWeights[w];
+      VertexData &vertex = vertices[weight.mVertexId];
+
+      // 비어있는 슬롯이 있으면 채우고, 없으면 가장 작은 weight 보다 클 때만 교체 (aiProcess_LimitBoneWeights 를 통과했다면 교체는 일어나지 않음)
+      int slot = 0;
+      for (int j = 1; j < MAX_BONE_INFLUENCE; j++)
+      {
+        if (vertex.m_Weights[j] < vertex.m_Weights[slot])
+        {
+          slot = j;
+        }
+      }
+
+      if (weight.mWeight > vertex.m_Weights[slot])
+      {
+        vertex.m_BoneIDs[slot] = boneIndex;
+        vertex.m_Weights[slot] = weight.mWeight;
+      }
+    }
   }
 }
 
-void Model::processMesh(aiMesh *mesh, const aiScene *scene)
+std::vector<TextureData> Model::loadMeshTextures(const aiMesh *mesh, const aiScene *scene)
+{
+  std::vector<TextureData> textures;
+
+  // 현재 aiMesh 에서 사용할 aiMaterial 데이터 가져오기
+  // aiMaterial 또한 인덱스 값만 aiMesh 에 저장되어 있고, 실제 주소값은 aiScene 이 갖고 있음
+  aiMaterial *material = scene->mMaterials[mesh->mMaterialIndex];
+
+  /* aiMaterial 에 저장된 텍스쳐 경로를 로드하여 Texture 구조체로 파싱 */
+  // uniform sampler 변수명을 '텍스쳐 타입 + 텍스쳐 번호' 형태의 convention 으로 선언할 것이므로,
+  // 동일한 텍스쳐 타입끼리 Texture 구조체 동적 배열을 생성하여 이어붙일 것임 (std::vector.insert() 사용)
+  // 1. diffuse maps
+  std::vector<TextureData> diffuseMap = loadMaterialTextures(material, aiTextureType_DIFFUSE, "texture_diffsue");
+  textures.insert(textures.end(), diffuseMap.begin(), diffuseMap.end()); // textures 동적 배열 마지막에 diffuseMap 동적 배열 삽입(이어붙이기)
+
+  // 2. specular maps
+  std::vector<TextureData> specularMap = loadMaterialTextures(material, aiTextureType_SPECULAR, "texture_specular");
+  textures.insert(textures.end(), specularMap.begin(), specularMap.end()); // textures 동적 배열 마지막에 specularMap 동적 배열 삽입(이어붙이기)
+
+  // 3. normal maps
+  std::vector<TextureData> normalMap = loadMaterialTextures(material, aiTextureType_NORMALS, "texture_normal");
+  textures.insert(textures.end(), normalMap.begin(), normalMap.end()); // textures 동적 배열 마지막에 normalMap 동적 배열 삽입(이어붙이기)
+
+  // 4. height maps
+  std::vector<TextureData> heightMap = loadMaterialTextures(material, aiTextureType_HEIGHT, "texture_height");
+  textures.insert(textures.end(), heightMap.begin(), heightMap.end()); // textures 동적 배열 마지막에 heightMap 동적 배열 삽입(이어붙이기)
+
+  return textures;
+}
+
+void Model::prepareMesh(const aiMesh *mesh, std::vector<PreparedMesh> &prepared) const
 {
   // Mesh 클래스 인스턴스 생성 시, 각 멤버에 채워넣을 동적배열 데이터 선언
   std::vector<VertexData> vertices;
   std::vector<unsigned int> indices;
-  std::vector<TextureData> textures;
+
+  // 정점 및 인덱스 개수를 미리 알고 있으므로, push_back() 중에 배열이 여러 번 재할당되며 복사되지 않도록 미리 메모리 확보
+  // (aiProcess_Triangulate 옵션에 의해 모든 face 는 삼각형)
+  vertices.reserve(mesh->mNumVertices);
+  indices.reserve(static_cast<size_t>(mesh->mNumFaces) * 3);
 
   // aiMesh 에 포함된 버텍스 개수만큼 반복문 순회
   for (unsigned int i = 0; i < mesh->mNumVertices; i++)
   {
     /* aiMesh 에 저장된 버텍스 데이터를 Vertex 구조체로 파싱 */
-    VertexData vertex;
+    VertexData vertex{};
 
     /* position 데이터 파싱 */
     // Assimp 는 자체적으로 vector3 타입을 갖고있어, 호환성을 위해 glm::vec3 로 타입을 변환해서 파싱해줘야 함.
@@ -134,8 +736,8 @@ void Model::processMesh(aiMesh *mesh, const aiScene *scene)
   // aiMesh 의 face 개수만큼 반복 순회
   for (unsigned int i = 0; i < mesh->mNumFaces; i++)
   {
-    // face 데이터를 가져옴
-    aiFace face = mesh->mFaces[i];
+    // face 데이터를 가져옴 (aiFace 를 값으로 복사하면 인덱스 배열까지 깊은 복사되므로 참조로 가져옴)
+    const aiFace &face = mesh->mFaces[i];
 
     // 삼각형 face(aiProcess_Triangulate 옵션에 의해...)를 구성하는 정점 인덱스 정보(aiFace.mIndices)가
     // aiFace 에 들어있으므로, 각 aiFace 의 정점 인덱스들을 indices 동적 배열에 순서대로 추가함
@@ -145,31 +747,244 @@ void Model::processMesh(aiMesh *mesh, const aiScene *scene)
     }
   }
 
-  // 현재 aiMesh 에서 사용할 aiMaterial 데이터 가져오기
-  // aiMaterial 또한 인덱스 값만 aiMesh 에 저장되어 있고, 실제 주소값은 aiScene 이 갖고 있음
-  aiMaterial *material = scene->mMaterials[mesh->mMaterialIndex];
+  // bone palette 를 계산할 Animator 가 있을 때만 정점별 bone ID 및 weight 를 기록하여 skinning 되는 Mesh 로 만듦
+  const bool skinned = animator && mesh->mNumBones > 0;
+  if (skinned)
+  {
+    assignBoneWeights(mesh, vertices);
+  }
 
-  /* aiMaterial 에 저장된 텍스쳐 경로를 로드하여 Texture 구조체로 파싱 */
-  // uniform sampler 변수명을 '텍스쳐 타입 + 텍스쳐 번호' 형태의 convention 으로 선언할 것이므로,
-  // 동일한 텍스쳐 타입끼리 Texture 구조체 동적 배열을 생성하여 이어붙일 것임 (std::vector.insert() 사용)
-  // 1. diffuse maps
-  std::vector<TextureData> diffuseMap = loadMaterialTextures(material, aiTextureType_DIFFUSE, "texture_diffsue");
-  textures.insert(textures.end(), diffuseMap.begin(), diffuseMap.end()); // textures 동적 배열 마지막에 diffuseMap 동적 배열 삽입(이어붙이기)
+  // 16-bit 인덱스 범위를 넘어서는 mesh 는 옵션에 따라 여러 chunk 로 분할
+  if (options.splitLargeMeshes && vertices.size() > MAX_SHORT_INDEXED_VERTICES)
+  {
+    prepareSplitMeshes(mesh->mName.C_Str(), vertices, indices, skinned, prepared);
+  }
+  else
+  {
+    prepareGeometry(mesh->mName.C_Str(), vertices, indices, skinned, prepared);
+  }
+}
 
-  // 2. specular maps
-  std::vector<TextureData> specularMap = loadMaterialTextures(material, aiTextureType_SPECULAR, "texture_specular");
-  textures.insert(textures.end(), specularMap.begin(), specularMap.end()); // textures 동적 배열 마지막에 specularMap 동적 배열 삽입(이어붙이기)
+void Model::prepareGeometry(const std::string &name, const std::vector<VertexData> &vertices, const std::vector<unsigned int> &indices, bool skinned, std::vector<PreparedMesh> &prepared) const
+{
+  // 파싱한 VertexData 를 GPU 에 업로드할 정점 포맷(ModelVertexData)으로 압축
+  std::vector<ModelVertexData> packedVertices;
+  PositionDequantization dequantization = VertexPacking::pack(vertices, packedVertices);
 
-  // 3. normal maps
-  std::vector<TextureData> normalMap = loadMaterialTextures(material, aiTextureType_NORMALS, "texture_normal");
-  textures.insert(textures.end(), normalMap.begin(), normalMap.end()); // textures 동적 배열 마지막에 normalMap 동적 배열 삽입(이어붙이기)
+  // bounding sphere 계산 및 LOD 생성에 사용할 position 배열
+  std::vector<glm::vec3> positions(vertices.size());
+  for (size_t i = 0; i < vertices.size(); i++)
+  {
+    positions[i] = vertices[i].Position;
+  }
 
-  // 4. height maps
-  std::vector<TextureData> heightMap = loadMaterialTextures(material, aiTextureType_HEIGHT, "texture_height");
-  textures.insert(textures.end(), heightMap.begin(), heightMap.end()); // textures 동적 배열 마지막에 heightMap 동적 배열 삽입(이어붙이기)
+  /*
+    LOD 생성
+
+    각 LOD 는 이전 LOD 의 인덱스 버퍼를 단순화하여 생성하고, 원본 정점 버퍼를 공유하므로
+    모든 LOD 의 인덱스를 하나의 배열에 이어붙여서 Mesh 에 전달함. (MeshLod 에는 각 LOD 의 인덱스 범위만 기록)
+  */
+  std::vector<unsigned int> lodIndices;
+  std::vector<MeshLod> lods = {{0, indices.size(), 0.0f}};
+
+  // LOD 들의 인덱스가 이어붙여질 것을 고려하여 미리 메모리 확보 (각 LOD 는 이전 LOD 보다 작으므로 원본의 2배를 넘지 않음)
+  lodIndices.reserve(options.generateLods ? indices.size() * 2 : indices.size());
+  lodIndices.insert(lodIndices.end(), indices.begin(), indices.end());
+
+  /*
+    LOD 0 의 삼각형들을 meshlet 단위로 재정렬
 
-  // Mesh 객체를 스마트 포인터로 생성 후 컨테이너에 주소값을 추가하여 의도치 않은 Mesh::~Mesh() 소멸자 호출 방지
-  meshes.push_back(std::make_shared<Mesh<VertexData>>(mesh->mName.C_Str(), vertices, indices, textures));
+    -> 재정렬은 삼각형 순서만 바꾸므로 LOD 생성에는 원본 인덱스(indices)를 그대로 사용해도 결과가 같음.
+  */
+  std::vector<Meshlet> meshlets;
+  if (options.generateMeshlets && !skinned)
+  {
+    meshlets = MeshletBuilder::build(positions, lodIndices, MeshletConstants::MAX_VERTICES, MeshletConstants::MAX_TRIANGLES);
+  }
+
+  if (options.generateLods)
+  {
+    std::vector<unsigned int> previousIndices = indices;
+    for (int lodIndex = 1; lodIndex < ModelConstants::NUM_LODS; lodIndex++)
+    {
+      size_t targetIndexCount = static_cast<size_t>(indices.size() * ModelConstants::LOD_TRIANGLE_RATIOS[lodIndex]) / 3 * 3;
+
+      float error = 0.0f;
+      MeshSimplifier simplifier(positions, previousIndices);
+      std::vector<unsigned int> simplifiedIndices = simplifier.simplify(targetIndexCount, &error);
+
+      // 단순화가 거의 되지 않았다면 (ex> seam, border 정점이 대부분인 mesh) 더 이상 LOD 를 생성하지 않음
+      if (simplifiedIndices.empty() || simplifiedIndices.size() > previousIndices.size() * ModelConstants::LOD_MIN_REDUCTION_RATIO)
+      {
+        break;
+      }
+
+      // LOD 오차는 원본 대비 누적 오차이므로, 이전 LOD 의 오차보다 작아지지 않도록 함
+      lods.push_back({lodIndices.size(), simplifiedIndices.size(), std::max(error, lods.back().error)});
+      lodIndices.insert(lodIndices.end(), simplifiedIndices.begin(), simplifiedIndices.end());
+      previousIndices = std::move(simplifiedIndices);
+    }
+
+    spdlog::info("Mesh <{}> generated {} LODs ({} -> {} triangles)", name, lods.size(), lods.front().indexCount / 3, lods.back().indexCount / 3);
+  }
+
+  // GPU 업로드를 제외한 변환 결과를 PreparedMesh 로 전달
+  PreparedMesh &mesh = prepared.emplace_back();
+  mesh.name = name;
+  mesh.vertices = std::move(packedVertices);
+  mesh.indices = std::move(lodIndices);
+  mesh.lods = std::move(lods);
+  mesh.meshlets = std::move(meshlets);
+  mesh.dequantization = dequantization;
+  mesh.sphere = computeBoundingSphere(positions);
+  mesh.box = computeBoundingBox(positions);
+
+  if (skinned)
+  {
+    VertexPacking::packSkinning(vertices, mesh.skin);
+  }
+
+  /*
+    LOD 0 의 삼각형들로 BVH 생성
+
+    -> meshlet 재정렬을 마친 인덱스로 생성하므로, 교차 결과의 삼각형 번호는 GPU 에 업로드된 LOD 0 인덱스 순서와 일치함.
+    -> aiMesh 변환 작업과 함께 worker 스레드에서 수행되므로 Mesh 마다 병렬로 생성됨.
+  */
+  if (options.buildBvh && !skinned)
+  {
+    auto bvhStart = std::chrono::steady_clock::now();
+    auto bvh = std::make_shared<Bvh>();
+    bvh->build(positions, mesh.indices, mesh.lods.front().indexCount);
+    mesh.bvhBuildTimeMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - bvhStart).count();
+    mesh.bvh = std::move(bvh);
+  }
+}
+
+void Model::addMesh(PreparedMesh &prepared, const std::vector<TextureData> &textures)
+{
+  /*
+    Mesh 객체를 스마트 포인터로 생성 후 컨테이너에 주소값을 추가하여 의도치 않은 Mesh::~Mesh() 소멸자 호출 방지
+
+    -> arena 가 전달되었다면 정점 개수에 따라 16-bit 또는 32-bit 인덱스 arena 에 업로드하고,
+    Mesh 에는 arena 내의 버퍼 영역만 기록함.
+    -> skinning 되는 Mesh 는 bone ID 및 weight 를 별도 VBO 로 VAO 에 연결해야 하므로, arena 가 있어도 자신의 버퍼를 소유함.
+  */
+  if (geometryArenas && prepared.skin.empty())
+  {
+    MeshGeometry geometry = prepared.vertices.size() <= MAX_SHORT_INDEXED_VERTICES
+                                ? geometryArenas->shortIndexed.allocate(prepared.vertices, prepared.indices)
+                                : geometryArenas->indexed.allocate(prepared.vertices, prepared.indices);
+    meshes.push_back(std::make_shared<Mesh<ModelVertexData>>(prepared.name, std::move(prepared.vertices), std::move(prepared.indices), textures, geometry));
+  }
+  else
+  {
+    meshes.push_back(std::make_shared<Mesh<ModelVertexData>>(prepared.name, std::move(prepared.vertices), std::move(prepared.indices), textures));
+  }
+
+  // 양자화된 position 을 복원할 dequantization 변환, LOD 인덱스 범위 및 bounding volume 설정
+  meshes.back()->setPositionDequantization(prepared.dequantization);
+  meshes.back()->setLods(prepared.lods);
+  meshes.back()->setBoundingSphere(prepared.sphere);
+  meshes.back()->setBoundingBox(prepared.box);
+  meshes.back()->setMeshlets(prepared.meshlets);
+
+  if (prepared.bvh)
+  {
+    bvhNodeCount += prepared.bvh->getNodeCount();
+    bvhMemorySize += prepared.bvh->getMemorySize();
+    bvhBuildTimeMs += prepared.bvhBuildTimeMs;
+    meshes.back()->setBvh(std::move(prepared.bvh));
+  }
+
+  // skinning 되는 Mesh 는 VAO 를 직접 소유하므로 bone ID 및 weight 를 별도 VBO 로 연결
+  if (!prepared.skin.empty())
+  {
+    meshes.back()->setSkinning(prepared.skin);
+    skinnedVertexCount += prepared.skin.size();
+  }
+
+  // GPU 업로드 및 bounding volume 계산이 끝났으므로, 옵션에 따라 CPU 측 정점 및 인덱스 배열 해제
+  if (!options.keepCpuGeometry)
+  {
+    meshes.back()->releaseCpuData();
+  }
+}
+
+void Model::prepareSplitMeshes(const std::string &name, const std::vector<VertexData> &vertices, const std::vector<unsigned int> &indices, bool skinned, std::vector<PreparedMesh> &prepared) const
+{
+  /*
+    삼각형을 순서대로 순회하며, 현재 chunk 가 참조하는 정점 개수가
+    16-bit 인덱스 범위(MAX_SHORT_INDEXED_VERTICES)를 넘어서기 직전에 chunk 를 끊어서 PreparedMesh 를 생성함.
+
+    -> 원본 정점 인덱스를 chunk 내부의 지역 인덱스로 변환하는 remap 테이블을 사용하며,
+    chunk 가 바뀔 때마다 이번 chunk 에서 사용된 항목들만 초기화함.
+  */
+  constexpr unsigned int INVALID_INDEX = 0xFFFFFFFFu;
+  std::vector<unsigned int> remap(vertices.size(), INVALID_INDEX);
+
+  std::vector<VertexData> chunkVertices;
+  std::vector<unsigned int> chunkSourceIndices; // chunk 의 각 정점이 참조하는 원본 정점 인덱스
+  std::vector<unsigned int> chunkIndices;
+  chunkVertices.reserve(MAX_SHORT_INDEXED_VERTICES);
+  chunkSourceIndices.reserve(MAX_SHORT_INDEXED_VERTICES);
+
+  unsigned int chunkNumber = 0;
+
+  // 현재 chunk 를 PreparedMesh 로 변환하고 다음 chunk 를 위해 상태 초기화
+  auto flushChunk = [&]()
+  {
+    if (chunkIndices.empty())
+    {
+      return;
+    }
+
+    prepareGeometry(name + "_chunk" + std::to_string(chunkNumber++), chunkVertices, chunkIndices, skinned, prepared);
+
+    for (unsigned int sourceIndex : chunkSourceIndices)
+    {
+      remap[sourceIndex] = INVALID_INDEX;
+    }
+    chunkVertices.clear();
+    chunkSourceIndices.clear();
+    chunkIndices.clear();
+  };
+
+  // aiProcess_Triangulate 옵션에 의해 모든 face 는 삼각형이므로, 인덱스를 3개씩 묶어서 순회
+  for (size_t i = 0; i + 2 < indices.size(); i += 3)
+  {
+    // 현재 삼각형을 추가할 때 chunk 에 새로 추가되어야 하는 정점 개수 계산
+    size_t newVertexCount = 0;
+    for (size_t j = 0; j < 3; j++)
+    {
+      unsigned int sourceIndex = indices[i + j];
+      bool duplicated = (j > 0 && indices[i + j - 1] == sourceIndex) || (j > 1 && indices[i] == sourceIndex);
+      if (remap[sourceIndex] == INVALID_INDEX && !duplicated)
+      {
+        newVertexCount++;
+      }
+    }
+
+    // 16-bit 인덱스 범위를 넘어서게 된다면 현재 chunk 를 먼저 변환
+    if (chunkVertices.size() + newVertexCount > MAX_SHORT_INDEXED_VERTICES)
+    {
+      flushChunk();
+    }
+
+    for (size_t j = 0; j < 3; j++)
+    {
+      unsigned int sourceIndex = indices[i + j];
+      if (remap[sourceIndex] == INVALID_INDEX)
+      {
+        remap[sourceIndex] = static_cast<unsigned int>(chunkVertices.size());
+        chunkVertices.push_back(vertices[sourceIndex]);
+        chunkSourceIndices.push_back(sourceIndex);
+      }
+      chunkIndices.push_back(remap[sourceIndex]);
+    }
+  }
+
+  // 마지막으로 남은 chunk 변환
+  flushChunk();
 }
 
 std::vector<TextureData> Model::loadMaterialTextures(aiMaterial *mat, aiTextureType type, std::string typeName)
@@ -183,34 +998,18 @@ std::vector<TextureData> Model::loadMaterialTextures(aiMaterial *mat, aiTextureT
     aiString str;                   // 텍스쳐 파일 경로를 저장할 Assimp 자체 문자열 타입 변수 선언
     mat->GetTexture(type, i, &str); // aiMaterial 에 저장된 특정 타입의 i 번째 텍스쳐 파일 경로를 str 에 저장함
 
-    // 지금 생성하려는 Texture 구조체가 이전에 이미 생성되었는지 검사
-    bool skip = false;
-    for (unsigned int j = 0; j < textures_loaded.size(); j++)
-    {
-      // std::strcmp() 함수로 텍스쳐 파일 경로 문자열이 동일한 지 비교 (두 문자열이 동일하면 0을 반환함.)
-      // std::string.data() 는 std::string 타입의 문자열을 char* 타입의 c-style 문자열로 변환해주는 역할
-      if (std::strcmp(textures_loaded[j].path.data(), str.C_Str()) == 0)
-      {
-        // 만약, 이미 생성된 Texture 구조체가 존재한다면, 해당 구조체를 가져와서 textures 배열에 저장
-        textures.push_back(textures_loaded[j]);
-
-        // 새로운 Texture 구조체 파싱 여부를 검사하는 플래그를 true 로 설정하고 반복문 중단
-        skip = true;
-        break;
-      }
-    }
+    /*
+      프로세스 전체에서 공유되는 텍스쳐 캐시로부터 텍스쳐 객체를 가져옴
 
-    // Texture 구조체 파싱
-    if (!skip)
-    {
-      TextureData texture;
-      texture.texturePtr = std::make_shared<Texture>(str.C_Str()); // 텍스쳐 객체 생성
-      texture.id = texture.texturePtr->getID();                    // 텍스쳐 객체로부터 참조 ID 반환받아 저장
-      texture.type = typeName;                                     // 텍스쳐 타입 이름 저장
-      texture.path = str.C_Str();                                  // 텍스쳐 파일 경로를 c-style 문자열로 변환 후 저장 (중복 생성된 텍스쳐가 있는지 파일 경로로 검사하기 위해 추가)
-      textures.push_back(texture);                                 // textures 동적 배열에 파싱한 Texture 구조체 추가
-      textures_loaded.push_back(texture);                          // Texture 구조체 중복 생성 방지를 위해, 이미 로드된 텍스쳐를 저장하는 동적 배열에도 추가
-    }
+      -> 같은 이미지 파일을 사용하는 텍스쳐는 Model 간에도 한번만 로드되며,
+      캐시 조회는 hash map 으로 이루어지므로 텍스쳐 개수가 많아도 조회 비용이 일정함.
+    */
+    TextureData texture;
+    texture.texturePtr = TextureCache::getInstance().acquire(str.C_Str()); // 텍스쳐 객체 조회 또는 생성
+    texture.id = texture.texturePtr->getID();                              // 텍스쳐 객체로부터 참조 ID 반환받아 저장
+    texture.type = typeName;                                               // 텍스쳐 타입 이름 저장
+    texture.path = str.C_Str();                                            // 텍스쳐 파일 경로를 c-style 문자열로 변환 후 저장
+    textures.push_back(texture);                                           // textures 동적 배열에 파싱한 Texture 구조체 추가
   }
 
   // 특정 타입의 Textures 구조체 동적 배열 반환
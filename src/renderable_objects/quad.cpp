@@ -1,5 +1,6 @@
 #include "renderable_objects/quad.hpp"
 #include <memory>
+#include <utility>
 
 Quad::Quad()
 {
@@ -10,7 +11,7 @@ Quad::Quad()
   generateVertexData(vertices, indices);
 
   // 생성된 데이터를 이용하여 Mesh 객체 인스턴스화 (mesh 멤버변수를 스마트 포인터로 관리하는 이유 하단 필기 참고)
-  mesh = std::make_unique<Mesh<SimpleVertexData>>("quad", vertices, indices);
+  mesh = std::make_unique<Mesh<SimpleVertexData>>("quad", std::move(vertices), std::move(indices));
 }
 
 void Quad::draw(Shader &shader)
@@ -0,0 +1,187 @@
+#include "scene/render_queue.hpp"
+#include "gl_context/gl_extensions.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+  // 현재 바인딩된 쉐이더 프로그램의 material uniform handle
+  struct MaterialUniforms
+  {
+    UniformHandle<glm::vec3> albedo;
+    UniformHandle<float> metallic;
+    UniformHandle<float> roughness;
+    UniformHandle<float> ao;
+  };
+
+  // 두 Mesh 가 같은 텍스쳐들을 같은 용도로 사용하는지 검사 (같으면 텍스쳐를 다시 바인딩할 필요가 없음)
+  bool hasSameTextures(const Mesh<ModelVertexData> &a, const Mesh<ModelVertexData> &b)
+  {
+    if (a.textures.size() != b.textures.size())
+    {
+      return false;
+    }
+
+    for (size_t i = 0; i < a.textures.size(); i++)
+    {
+      if (a.textures[i].id != b.textures[i].id || a.textures[i].type != b.textures[i].type)
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+} // namespace
+
+std::uint64_t RenderQueue::makeKey(std::uint32_t shader, std::uint32_t material, std::uint32_t textureSet, std::uint32_t mesh, float depth)
+{
+  const std::uint64_t depthMax = (std::uint64_t(1) << DEPTH_BITS) - 1;
+  const std::uint64_t quantizedDepth = static_cast<std::uint64_t>(glm::clamp(depth, 0.0f, 1.0f) * static_cast<float>(depthMax));
+
+  std::uint64_t key = shader & ((1u << SHADER_BITS) - 1);
+  key = (key << MATERIAL_BITS) | (material & ((1u << MATERIAL_BITS) - 1));
+  key = (key << TEXTURE_SET_BITS) | (textureSet & ((1u << TEXTURE_SET_BITS) - 1));
+  key = (key << MESH_BITS) | (mesh & ((1u << MESH_BITS) - 1));
+  key = (key << DEPTH_BITS) | quantizedDepth;
+  return key;
+}
+
+std::uint32_t RenderQueue::getTextureSetKey(const Mesh<ModelVertexData> &mesh)
+{
+  // 텍스쳐 id 들을 FNV-1a 로 섞은 뒤 상위 비트를 하위 비트에 접어서 TEXTURE_SET_BITS 로 줄임
+  std::uint32_t hash = 2166136261u;
+  for (const TextureData &texture : mesh.textures)
+  {
+    hash = (hash ^ texture.id) * 16777619u;
+  }
+  return (hash ^ (hash >> TEXTURE_SET_BITS)) & ((1u << TEXTURE_SET_BITS) - 1);
+}
+
+void RenderQueue::clear()
+{
+  commands.clear();
+  sortedKeys.clear();
+}
+
+void RenderQueue::submit(std::uint64_t key, const RenderCommand &command)
+{
+  sortedKeys.push_back({key, static_cast<std::uint32_t>(commands.size())});
+  commands.push_back(command);
+}
+
+void RenderQueue::sort()
+{
+  // 키가 같은 명령들은 제출 순서를 유지하도록 인덱스까지 비교함 (pair 의 기본 비교)
+  std::sort(sortedKeys.begin(), sortedKeys.end());
+}
+
+RenderQueueStats RenderQueue::flush(const std::vector<RenderMaterial> &materials, ModelGeometryArenas *geometryArenas)
+{
+  RenderQueueStats stats;
+  stats.commandCount = static_cast<unsigned int>(sortedKeys.size());
+
+  const bool useMultiDraw = geometryArenas && GLExtensions::hasMultiDrawIndirect();
+
+  Shader *currentShader = nullptr;
+  std::uint32_t currentMaterial = std::numeric_limits<std::uint32_t>::max();
+  const Mesh<ModelVertexData> *textureMesh = nullptr; // 현재 바인딩된 텍스쳐들을 사용하는 Mesh
+  MaterialUniforms materialUniforms;
+  GLenum batchIndexType = GL_UNSIGNED_INT;
+
+  for (const auto &sortedKey : sortedKeys)
+  {
+    const RenderCommand &command = commands[sortedKey.second];
+    const Mesh<ModelVertexData> &mesh = *command.mesh;
+
+    const bool shaderChanged = command.shader != currentShader;
+    const bool materialChanged = shaderChanged || command.material != currentMaterial;
+    const bool texturesChanged = shaderChanged || !textureMesh || !hasSameTextures(*textureMesh, mesh);
+
+    // 상태가 바뀌기 전에, 지금까지 묶인 command 들을 이전 상태로 먼저 그림 (인덱스 타입이 다른 arena 의 Mesh 도 함께 그릴 수 없음)
+    if (useMultiDraw && !drawCommands.empty() && (materialChanged || texturesChanged || mesh.getGeometry().indexType != batchIndexType))
+    {
+      flushBatch(*geometryArenas, batchIndexType);
+      stats.drawCallCount++;
+    }
+
+    if (shaderChanged)
+    {
+      currentShader = command.shader;
+      currentShader->use();
+
+      // 오브젝트 및 노드 transform 은 모두 per-draw transform 으로 전달하므로 모델 행렬 uniform 은 단위 행렬로 설정
+      currentShader->setMat4("model", glm::mat4(1.0f));
+      currentShader->setMat3("normalMatrix", glm::mat3(1.0f));
+
+      // material 이 바뀔 때마다 이름으로 조회하지 않도록 프로그램이 바뀔 때만 handle 조회
+      materialUniforms.albedo = currentShader->getUniformHandle<glm::vec3>("albedo");
+      materialUniforms.metallic = currentShader->getUniformHandle<float>("metallic");
+      materialUniforms.roughness = currentShader->getUniformHandle<float>("roughness");
+      materialUniforms.ao = currentShader->getUniformHandle<float>("ao");
+      stats.programBindCount++;
+    }
+
+    if (materialChanged)
+    {
+      currentMaterial = command.material;
+      const RenderMaterial &material = materials[currentMaterial];
+      currentShader->set(materialUniforms.albedo, material.albedo);
+      currentShader->set(materialUniforms.metallic, material.metallic);
+      currentShader->set(materialUniforms.roughness, material.roughness);
+      currentShader->set(materialUniforms.ao, material.ao);
+      stats.materialBindCount++;
+    }
+
+    if (texturesChanged)
+    {
+      textureMesh = command.mesh;
+      mesh.bindTextures(*currentShader);
+      stats.textureBindCount++;
+    }
+
+    if (useMultiDraw)
+    {
+      const MeshLod &lod = mesh.getLods()[command.lod];
+      batchIndexType = mesh.getGeometry().indexType;
+      drawCommands.push_back(mesh.getIndirectCommand(MeshIndexRange{lod.indexOffset, lod.indexCount}, static_cast<GLuint>(drawData.size())));
+      drawData.push_back({command.transform, command.normalMatrix, mesh.getPositionDequantization()});
+    }
+    else
+    {
+      mesh.drawLod(command.lod, command.transform, command.normalMatrix);
+      stats.drawCallCount++;
+    }
+  }
+
+  if (!drawCommands.empty())
+  {
+    flushBatch(*geometryArenas, batchIndexType);
+    stats.drawCallCount++;
+  }
+
+  // 그리기 명령 완료 후, 활성 texture unit 을 다시 기본값으로 초기화함.
+  glActiveTexture(GL_TEXTURE0);
+
+  return stats;
+}
+
+size_t RenderQueue::size() const
+{
+  return commands.size();
+}
+
+void RenderQueue::flushBatch(ModelGeometryArenas &geometryArenas, GLenum indexType)
+{
+  if (indexType == GL_UNSIGNED_SHORT)
+  {
+    geometryArenas.shortIndexed.multiDraw(GL_TRIANGLES, drawCommands, drawData);
+  }
+  else
+  {
+    geometryArenas.indexed.multiDraw(GL_TRIANGLES, drawCommands, drawData);
+  }
+
+  drawCommands.clear();
+  drawData.clear();
+}
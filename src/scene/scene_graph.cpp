@@ -0,0 +1,132 @@
+#include "scene/scene_graph.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+int SceneGraph::addNode(const std::string &name, int parent, const glm::mat4 &localTransform)
+{
+  const int node = static_cast<int>(names.size());
+
+  /*
+    부모 노드의 서브트리가 현재 배열의 끝까지 이어져 있어야 새 노드를 붙여도 서브트리 구간이 연속적으로 유지됨.
+
+    -> 부모가 가장 최근에 추가된 노드 또는 그 조상 노드인 경우에만 성립하며,
+    이는 곧 노드들이 전위 순회 순서로 추가되고 있음을 의미함.
+  */
+  if (parent != NO_PARENT && (parent < 0 || parent >= node || subtreeEnds[parent] != node))
+  {
+    throw std::invalid_argument("SceneGraph nodes must be added in depth-first pre-order.");
+  }
+
+  names.push_back(name);
+  parents.push_back(parent);
+  subtreeEnds.push_back(node + 1);
+  localTransforms.push_back(localTransform);
+  worldTransforms.push_back(glm::mat4(1.0f));
+  dirtyFlags.push_back(0);
+
+  // 새 노드를 포함하도록 모든 조상 노드의 서브트리 구간 확장
+  for (int ancestor = parent; ancestor != NO_PARENT; ancestor = parents[ancestor])
+  {
+    subtreeEnds[ancestor] = node + 1;
+  }
+
+  // 새 노드의 world transform 은 아직 계산되지 않았으므로 dirty 표시
+  setLocalTransform(node, localTransform);
+
+  return node;
+}
+
+void SceneGraph::setLocalTransform(int node, const glm::mat4 &localTransform)
+{
+  localTransforms.at(node) = localTransform;
+
+  if (!dirtyFlags[node])
+  {
+    dirtyFlags[node] = 1;
+    dirtyNodes.push_back(node);
+  }
+}
+
+size_t SceneGraph::updateWorldTransforms()
+{
+  updatedNodes.clear();
+
+  if (dirtyNodes.empty())
+  {
+    return 0;
+  }
+
+  /*
+    dirty 노드들을 인덱스 순으로 정렬하면 조상 노드가 항상 하위 노드보다 먼저 처리되므로,
+    이미 갱신한 서브트리 구간에 포함된 dirty 노드는 다시 계산하지 않고 건너뛸 수 있음.
+  */
+  std::sort(dirtyNodes.begin(), dirtyNodes.end());
+
+  int updatedEnd = 0;
+  for (int dirtyNode : dirtyNodes)
+  {
+    dirtyFlags[dirtyNode] = 0;
+
+    if (dirtyNode < updatedEnd)
+    {
+      continue;
+    }
+
+    // 서브트리 구간 내의 노드들은 부모가 항상 앞에 있으므로 구간을 앞에서부터 순회하며 계산
+    for (int node = dirtyNode; node < subtreeEnds[dirtyNode]; node++)
+    {
+      const int parent = parents[node];
+      worldTransforms[node] = parent == NO_PARENT ? localTransforms[node] : worldTransforms[parent] * localTransforms[node];
+      updatedNodes.push_back(node);
+    }
+
+    updatedEnd = subtreeEnds[dirtyNode];
+  }
+
+  dirtyNodes.clear();
+
+  return updatedNodes.size();
+}
+
+const std::vector<int> &SceneGraph::getUpdatedNodes() const
+{
+  return updatedNodes;
+}
+
+const glm::mat4 &SceneGraph::getLocalTransform(int node) const
+{
+  return localTransforms.at(node);
+}
+
+const glm::mat4 &SceneGraph::getWorldTransform(int node) const
+{
+  return worldTransforms.at(node);
+}
+
+int SceneGraph::getParent(int node) const
+{
+  return parents.at(node);
+}
+
+const std::string &SceneGraph::getName(int node) const
+{
+  return names.at(node);
+}
+
+int SceneGraph::findNode(const std::string &name) const
+{
+  for (size_t node = 0; node < names.size(); node++)
+  {
+    if (names[node] == name)
+    {
+      return static_cast<int>(node);
+    }
+  }
+
+  return -1;
+}
+
+size_t SceneGraph::getNodeCount() const
+{
+  return names.size();
+}
@@ -0,0 +1,76 @@
+#include "shader/pbr_shader_variants.hpp"
+#include "constants/ibl_constants.hpp"
+#include "constants/light_constants.hpp"
+
+PbrShaderVariants::PbrShaderVariants()
+    : cache(ShaderConstants::PBR_VERTEX_SOURCE, ShaderConstants::PBR_FRAGMENT_SOURCE),
+      iblEnabled(IBLConstants::IBL_VISIBILITY_DEFAULT),
+      lightCount(LightConstants::NUM_LIGHTS)
+{
+  // 기본 설정의 uniform material 및 instanced material 변형은 항상 사용되므로 미리 제출
+  prepare(false);
+  prepare(true);
+}
+
+void PbrShaderVariants::setIBLEnabled(bool iblEnabled)
+{
+  this->iblEnabled = iblEnabled;
+}
+
+void PbrShaderVariants::setLightCount(unsigned int lightCount)
+{
+  this->lightCount = lightCount < LightConstants::NUM_LIGHTS ? lightCount : LightConstants::NUM_LIGHTS;
+}
+
+ShaderVariant &PbrShaderVariants::acquire(bool instancedMaterial)
+{
+  // 매 프레임 호출되므로, 이미 생성된 변형은 defines 문자열을 만들지 않고 key 로만 조회
+  const std::uint32_t key = makeKey(iblEnabled, lightCount, instancedMaterial);
+  if (ShaderVariant *variant = cache.find(key))
+  {
+    return *variant;
+  }
+
+  return cache.acquire(key,
+                       makeDefines(iblEnabled, lightCount, instancedMaterial),
+                       makeLabel(iblEnabled, lightCount, instancedMaterial));
+}
+
+void PbrShaderVariants::prepare(bool instancedMaterial)
+{
+  cache.prepare(makeKey(iblEnabled, lightCount, instancedMaterial),
+                makeDefines(iblEnabled, lightCount, instancedMaterial),
+                makeLabel(iblEnabled, lightCount, instancedMaterial));
+}
+
+ShaderVariantCache &PbrShaderVariants::getCache()
+{
+  return cache;
+}
+
+std::uint32_t PbrShaderVariants::makeKey(bool iblEnabled, unsigned int lightCount, bool instancedMaterial)
+{
+  return (lightCount << 2) | (static_cast<std::uint32_t>(instancedMaterial) << 1) | static_cast<std::uint32_t>(iblEnabled);
+}
+
+std::vector<std::string> PbrShaderVariants::makeDefines(bool iblEnabled, unsigned int lightCount, bool instancedMaterial)
+{
+  std::vector<std::string> defines;
+  if (iblEnabled)
+  {
+    defines.push_back("IBL_ENABLED");
+  }
+  defines.push_back("LIGHT_COUNT " + std::to_string(lightCount));
+  if (instancedMaterial)
+  {
+    defines.push_back("INSTANCED_MATERIAL");
+  }
+  return defines;
+}
+
+std::string PbrShaderVariants::makeLabel(bool iblEnabled, unsigned int lightCount, bool instancedMaterial)
+{
+  return std::string(iblEnabled ? "IBL" : "no IBL") + ", " +
+         std::to_string(lightCount) + (lightCount == 1 ? " light, " : " lights, ") +
+         (instancedMaterial ? "instanced" : "uniform") + " material";
+}
@@ -0,0 +1,209 @@
+#include "shader/program_binary_cache.hpp"
+#include "gl_context/gl_extensions.hpp"
+#include "constants/shader_constants.hpp"
+#include <spdlog/spdlog.h>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+namespace
+{
+  /*
+    캐시 파일 앞에 기록하는 헤더
+
+    -> key 까지 함께 기록하여, 파일 이름만 같고 내용이 다른 (ex> 기록 도중 종료되어 잘린) 파일을 걸러냄.
+  */
+  struct ProgramBinaryHeader
+  {
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint64_t key;
+    std::uint32_t binaryFormat;
+    std::uint32_t binaryLength;
+  };
+
+  // 64-bit FNV-1a 에 문자열을 이어서 섞음 (hash 에 이전 결과를 전달하여 여러 문자열을 연결)
+  std::uint64_t hashString(std::uint64_t hash, std::string_view text)
+  {
+    for (char c : text)
+    {
+      hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+    }
+
+    // 문자열 경계를 섞어서 ("ab", "c") 와 ("a", "bc") 가 같은 값이 되지 않도록 함
+    return (hash ^ 0xffu) * 1099511628211ull;
+  }
+
+  std::string getGLString(GLenum name)
+  {
+    const char *value = reinterpret_cast<const char *>(glGetString(name));
+    return value ? value : "";
+  }
+} // namespace
+
+ProgramBinaryCache &ProgramBinaryCache::getInstance()
+{
+  static ProgramBinaryCache instance;
+  return instance;
+}
+
+std::uint64_t ProgramBinaryCache::makeKey(std::string_view vertexSource, std::string_view fragmentSource)
+{
+  // 드라이버 정보는 실행 중에 바뀌지 않으므로 한번만 조회하여 hashing
+  if (!driverHashed)
+  {
+    driverHash = 14695981039346656037ull;
+    driverHash = hashString(driverHash, getGLString(GL_VENDOR));
+    driverHash = hashString(driverHash, getGLString(GL_RENDERER));
+    driverHash = hashString(driverHash, getGLString(GL_VERSION));
+    driverHashed = true;
+  }
+
+  std::uint64_t key = driverHash;
+  key = hashString(key, vertexSource);
+  key = hashString(key, fragmentSource);
+  return key;
+}
+
+bool ProgramBinaryCache::load(std::uint64_t key, GLuint program)
+{
+  if (!GLExtensions::hasProgramBinary())
+  {
+    return false;
+  }
+
+  const std::string path = getCachePath(key);
+  std::ifstream file(path, std::ios::binary);
+  if (!file.is_open())
+  {
+    return false;
+  }
+
+  auto loadStart = std::chrono::steady_clock::now();
+
+  ProgramBinaryHeader header{};
+  std::vector<char> binary;
+  bool valid = static_cast<bool>(file.read(reinterpret_cast<char *>(&header), sizeof(header))) &&
+               header.magic == ShaderConstants::PROGRAM_BINARY_MAGIC &&
+               header.version == ShaderConstants::PROGRAM_BINARY_VERSION &&
+               header.key == key &&
+               header.binaryLength > 0;
+
+  if (valid)
+  {
+    binary.resize(header.binaryLength);
+    valid = static_cast<bool>(file.read(binary.data(), static_cast<std::streamsize>(binary.size())));
+  }
+  file.close();
+
+  // 드라이버가 바이너리를 받아들였는지는 링크 상태로 확인 (드라이버 업데이트 등으로 거부되면 GL_FALSE)
+  if (valid)
+  {
+    GLExtensions::programBinary(program, header.binaryFormat, binary.data(), static_cast<GLsizei>(binary.size()));
+
+    GLint linkStatus = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+    valid = linkStatus == GL_TRUE;
+  }
+
+  if (!valid)
+  {
+    // 유효하지 않은 캐시 파일은 지워두고, 소스로부터 다시 컴파일한 바이너리로 교체되도록 함
+    spdlog::warn("Invalid program binary cache, recompiling : {}", path);
+    std::error_code error;
+    std::filesystem::remove(path, error);
+    stats.invalidCount++;
+    return false;
+  }
+
+  stats.loadedCount++;
+  stats.loadTimeMs += std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - loadStart).count();
+  return true;
+}
+
+void ProgramBinaryCache::prepareForLink(GLuint program) const
+{
+  if (GLExtensions::hasProgramBinary())
+  {
+    GLExtensions::programParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+  }
+}
+
+void ProgramBinaryCache::store(std::uint64_t key, GLuint program)
+{
+  if (!GLExtensions::hasProgramBinary())
+  {
+    return;
+  }
+
+  GLint binaryLength = 0;
+  glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+  if (binaryLength <= 0)
+  {
+    return;
+  }
+
+  std::vector<char> binary(static_cast<size_t>(binaryLength));
+  GLsizei writtenLength = 0;
+  GLenum binaryFormat = GL_NONE;
+  GLExtensions::getProgramBinary(program, binaryLength, &writtenLength, &binaryFormat, binary.data());
+  if (writtenLength <= 0)
+  {
+    return;
+  }
+
+  std::error_code error;
+  std::filesystem::create_directories(ShaderConstants::PROGRAM_BINARY_CACHE_DIRECTORY, error);
+
+  /*
+    임시 파일에 모두 기록한 뒤 이름을 바꿔서, 기록 도중 종료되더라도 잘린 파일이 캐시 파일 이름으로 남지 않도록 함.
+  */
+  const std::string path = getCachePath(key);
+  const std::string tempPath = path + ".tmp";
+  {
+    std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+      spdlog::warn("Failed to write program binary cache : {}", tempPath);
+      return;
+    }
+
+    ProgramBinaryHeader header{
+        ShaderConstants::PROGRAM_BINARY_MAGIC,
+        ShaderConstants::PROGRAM_BINARY_VERSION,
+        key,
+        static_cast<std::uint32_t>(binaryFormat),
+        static_cast<std::uint32_t>(writtenLength)};
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(binary.data(), writtenLength);
+  }
+
+  std::filesystem::rename(tempPath, path, error);
+  if (error)
+  {
+    spdlog::warn("Failed to write program binary cache : {} ({})", path, error.message());
+    std::filesystem::remove(tempPath, error);
+  }
+}
+
+void ProgramBinaryCache::recordCompile(float submitTimeMs, float linkWaitTimeMs, float overlapTimeMs)
+{
+  stats.compiledCount++;
+  stats.compileTimeMs += submitTimeMs + linkWaitTimeMs;
+  stats.linkWaitTimeMs += linkWaitTimeMs;
+  stats.overlapTimeMs += overlapTimeMs;
+}
+
+const ProgramBinaryCacheStats &ProgramBinaryCache::getStats() const
+{
+  return stats;
+}
+
+std::string ProgramBinaryCache::getCachePath(std::uint64_t key) const
+{
+  char fileName[32];
+  std::snprintf(fileName, sizeof(fileName), "%016llx", static_cast<unsigned long long>(key));
+  return (std::filesystem::path(ShaderConstants::PROGRAM_BINARY_CACHE_DIRECTORY) / (std::string(fileName) + ShaderConstants::PROGRAM_BINARY_FILE_EXTENSION)).string();
+}
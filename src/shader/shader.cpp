@@ -1,150 +1,607 @@
 #include "shader/shader.hpp"
+#include "shader/program_binary_cache.hpp"
+#include "shader/shader_sources.hpp"
+#include "constants/shader_constants.hpp"
+#include "gl_context/gl_extensions.hpp"
+#include <spdlog/spdlog.h>
+#include <chrono>
+#include <algorithm>
+#include <utility>
 
 // Shader 클래스 생성자
-Shader::Shader(const GLchar *vertexPath, const GLchar *fragmentPath)
+Shader::Shader(const GLchar *vertexName, const GLchar *fragmentName)
+    : Shader(vertexName, fragmentName, {})
 {
-  // 쉐이더 코드를 std::string 타입으로 파싱하여 저장할 변수 선언
-  std::string vertexCode;
-  std::string fragmentCode;
+}
+
+Shader::Shader(const GLchar *vertexName, const GLchar *fragmentName, const std::vector<std::string> &defines)
+    : vertexName(vertexName), fragmentName(fragmentName), defines(defines)
+{
+  /*
+    실행 파일에 포함된 쉐이더 소스 조회
 
-  // std::ifstream을 사용하여 파일 읽기
-  std::ifstream vShaderFile;
-  std::ifstream fShaderFile;
+    -> 포함된 소스는 복사 없이 그대로 컴파일하고, override 파일을 읽거나 #define 을 삽입한 경우에만 storage 에 소스를 저장함.
+  */
+  std::string vertexStorage;
+  std::string fragmentStorage;
+  std::string_view vertexCode = ShaderSources::load(vertexName, vertexStorage);
+  std::string_view fragmentCode = ShaderSources::load(fragmentName, fragmentStorage);
 
-  // 파일 열기와 예외 처리
-  vShaderFile.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-  fShaderFile.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+  /*
+    소스를 찾지 못하면 컴파일하지 않고 링크되지 않은 빈 프로그램으로 남겨둠
+
+    -> reload 중이면 pollReload() 가 링크 실패로 판단하여 기존 프로그램을 유지함. (저장 중에 잠시 비어있는 파일 등)
+  */
+  if (vertexCode.empty() || fragmentCode.empty())
+  {
+    spdlog::error("Shader source not found : {}, {}", vertexName, fragmentName);
+    ID = glCreateProgram();
+    return;
+  }
 
-  try
+  // 쉐이더 변형을 결정하는 #define 들을 삽입 (캐시 key 도 삽입된 소스로 생성되므로 변형마다 다른 바이너리가 저장됨)
+  if (!defines.empty())
   {
-    // 파일 열기
-    vShaderFile.open(vertexPath);
-    fShaderFile.open(fragmentPath);
+    vertexStorage = injectDefines(vertexCode, defines);
+    vertexCode = vertexStorage;
+    fragmentStorage = injectDefines(fragmentCode, defines);
+    fragmentCode = fragmentStorage;
+  }
 
-    // 파일 스트림을 문자열로 읽기
-    std::stringstream vShaderStream, fShaderStream;
-    vShaderStream << vShaderFile.rdbuf();
-    fShaderStream << fShaderFile.rdbuf();
+  /*
+    같은 소스와 드라이버로 링크해둔 프로그램 바이너리가 캐시에 있으면 컴파일 및 링크 없이 바로 불러옴.
 
-    // 파일 스트림 닫기
-    vShaderFile.close();
-    fShaderFile.close();
+    -> 캐시 파일이 없거나 유효하지 않으면 소스로부터 컴파일 및 링크한 뒤 다음 실행을 위해 바이너리를 저장함.
+  */
+  ProgramBinaryCache &binaryCache = ProgramBinaryCache::getInstance();
+  const std::uint64_t cacheKey = binaryCache.makeKey(vertexCode, fragmentCode);
 
-    // 문자열로 파싱
-    vertexCode = vShaderStream.str();
-    fragmentCode = fShaderStream.str();
-  }
-  catch (std::ifstream::failure &e)
+  ID = glCreateProgram();
+  if (binaryCache.load(cacheKey, ID))
   {
-    std::cout << "ERROR::SHADER::FILE_NOT_SUCCESSFULLY_READ" << e.what() << std::endl;
+    // uniform 변수를 전송할 때마다 glGetUniformLocation() 을 호출하지 않도록 링크 직후 모든 uniform location 을 조회해 둠
+    introspectUniforms();
+    return;
   }
 
-  // C 스타일 문자열로 변환
-  const char *vShaderCode = vertexCode.c_str();
-  const char *fShaderCode = fragmentCode.c_str();
+  auto submitStart = std::chrono::steady_clock::now();
 
-  // 쉐이더 객체 생성 및 컴파일
-  unsigned int vertex, fragment;
+  // 소스가 null 문자로 끝나지 않을 수 있으므로 (실행 파일에 포함된 소스의 view) 길이를 함께 전달
+  const char *vShaderCode = vertexCode.data();
+  const char *fShaderCode = fragmentCode.data();
+  const GLint vShaderLength = static_cast<GLint>(vertexCode.size());
+  const GLint fShaderLength = static_cast<GLint>(fragmentCode.size());
 
-  // 버텍스 쉐이더 생성 및 컴파일
-  vertex = glCreateShader(GL_VERTEX_SHADER);
-  glShaderSource(vertex, 1, &vShaderCode, NULL);
-  glCompileShader(vertex);
-  checkCompileErrors(vertex, "VERTEX");
+  // 버텍스 쉐이더 생성 및 컴파일 (컴파일 에러는 링크 결과를 조회할 때 함께 검사)
+  pendingLink.vertex = glCreateShader(GL_VERTEX_SHADER);
+  glShaderSource(pendingLink.vertex, 1, &vShaderCode, &vShaderLength);
+  glCompileShader(pendingLink.vertex);
 
   // 프래그먼트 쉐이더 생성 및 컴파일
-  fragment = glCreateShader(GL_FRAGMENT_SHADER);
-  glShaderSource(fragment, 1, &fShaderCode, NULL);
-  glCompileShader(fragment);
-  checkCompileErrors(fragment, "FRAGMENT");
+  pendingLink.fragment = glCreateShader(GL_FRAGMENT_SHADER);
+  glShaderSource(pendingLink.fragment, 1, &fShaderCode, &fShaderLength);
+  glCompileShader(pendingLink.fragment);
 
-  // 쉐이더 프로그램 객체 생성 및 쉐이더 객체 연결
-  ID = glCreateProgram();
-  glAttachShader(ID, vertex);
-  glAttachShader(ID, fragment);
+  // 쉐이더 프로그램 객체에 쉐이더 객체 연결 및 링크 (링크 후 바이너리를 꺼낼 수 있도록 hint 설정)
+  glAttachShader(ID, pendingLink.vertex);
+  glAttachShader(ID, pendingLink.fragment);
+  binaryCache.prepareForLink(ID);
   glLinkProgram(ID);
-  checkCompileErrors(ID, "PROGRAM");
 
-  // 쉐이더 객체 삭제
-  glDeleteShader(vertex);
-  glDeleteShader(fragment);
+  pendingLink.cacheKey = cacheKey;
+  pendingLink.submitEnd = std::chrono::steady_clock::now();
+  pendingLink.submitTimeMs = std::chrono::duration<float, std::milli>(pendingLink.submitEnd - submitStart).count();
+  linkPending = true;
+
+  // 결과 조회를 지연하지 않으면 이전처럼 생성자에서 컴파일 및 링크가 끝날 때까지 기다림
+  if (!ShaderConstants::DEFERRED_LINK_ENABLED)
+  {
+    finishLink();
+  }
 }
 
 // Shader 클래스 소멸자
 Shader::~Shader()
 {
+  // 한번도 사용되지 않아 링크 결과를 조회하지 않은 프로그램이면 남아있는 쉐이더 객체도 삭제
+  if (linkPending)
+  {
+    glDeleteShader(pendingLink.vertex);
+    glDeleteShader(pendingLink.fragment);
+  }
+
   // 쉐이더 프로그램 객체 메모리 반납
   glDeleteProgram(ID);
 }
 
+bool Shader::isLinkComplete() const
+{
+  if (!linkPending || !GLExtensions::hasParallelShaderCompile())
+  {
+    return true;
+  }
+
+  // GL_COMPLETION_STATUS_KHR 는 드라이버의 컴파일 스레드를 기다리지 않고 바로 반환됨
+  GLint completed = GL_FALSE;
+  glGetProgramiv(ID, GL_COMPLETION_STATUS_KHR, &completed);
+  return completed == GL_TRUE;
+}
+
 // ShaderProgram 객체 활성화
 void Shader::use()
 {
+  waitForLink();
   glUseProgram(ID);
 }
 
+GLint Shader::getUniformLocation(std::string_view name) const
+{
+  waitForLink();
+  const UniformSlot *uniform = findUniform(name);
+  return uniform ? uniform->location : -1;
+}
+
+size_t Shader::getActiveUniformCount() const
+{
+  waitForLink();
+  return uniformCount;
+}
+
+void Shader::set(UniformHandle<bool> handle, bool value) const
+{
+  glUniform1i(handle.location, (int)value);
+}
+
+void Shader::set(UniformHandle<int> handle, int value) const
+{
+  glUniform1i(handle.location, value);
+}
+
+void Shader::set(UniformHandle<float> handle, float value) const
+{
+  glUniform1f(handle.location, value);
+}
+
+void Shader::set(UniformHandle<glm::vec2> handle, const glm::vec2 &value) const
+{
+  glUniform2fv(handle.location, 1, &value[0]);
+}
+
+void Shader::set(UniformHandle<glm::vec3> handle, const glm::vec3 &value) const
+{
+  glUniform3fv(handle.location, 1, &value[0]);
+}
+
+void Shader::set(UniformHandle<glm::vec4> handle, const glm::vec4 &value) const
+{
+  glUniform4fv(handle.location, 1, &value[0]);
+}
+
+void Shader::set(UniformHandle<glm::mat2> handle, const glm::mat2 &mat) const
+{
+  glUniformMatrix2fv(handle.location, 1, GL_FALSE, &mat[0][0]);
+}
+
+void Shader::set(UniformHandle<glm::mat3> handle, const glm::mat3 &mat) const
+{
+  glUniformMatrix3fv(handle.location, 1, GL_FALSE, &mat[0][0]);
+}
+
+void Shader::set(UniformHandle<glm::mat4> handle, const glm::mat4 &mat) const
+{
+  glUniformMatrix4fv(handle.location, 1, GL_FALSE, &mat[0][0]);
+}
+
 // 유니폼 변수 관련 유틸리티
-void Shader::setBool(const std::string &name, bool value) const
+void Shader::setBool(std::string_view name, bool value) const
 {
-  glUniform1i(glGetUniformLocation(ID, name.c_str()), (int)value);
+  glUniform1i(getUniformLocation(name), (int)value);
 }
 
-void Shader::setInt(const std::string &name, int value) const
+void Shader::setInt(std::string_view name, int value) const
 {
-  glUniform1i(glGetUniformLocation(ID, name.c_str()), value);
+  glUniform1i(getUniformLocation(name), value);
 }
 
-void Shader::setFloat(const std::string &name, float value) const
+void Shader::setFloat(std::string_view name, float value) const
 {
-  glUniform1f(glGetUniformLocation(ID, name.c_str()), value);
+  glUniform1f(getUniformLocation(name), value);
 }
 
-void Shader::setVec2(const std::string &name, const glm::vec2 &value) const
+void Shader::setVec2(std::string_view name, const glm::vec2 &value) const
 {
-  glUniform2fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]);
+  glUniform2fv(getUniformLocation(name), 1, &value[0]);
 }
 
-void Shader::setVec2(const std::string &name, float x, float y) const
+void Shader::setVec2(std::string_view name, float x, float y) const
 {
-  glUniform2f(glGetUniformLocation(ID, name.c_str()), x, y);
+  glUniform2f(getUniformLocation(name), x, y);
 }
 
-void Shader::setVec3(const std::string &name, const glm::vec3 &value) const
+void Shader::setVec3(std::string_view name, const glm::vec3 &value) const
 {
-  glUniform3fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]);
+  glUniform3fv(getUniformLocation(name), 1, &value[0]);
 }
 
-void Shader::setVec3(const std::string &name, float x, float y, float z) const
+void Shader::setVec3(std::string_view name, float x, float y, float z) const
 {
-  glUniform3f(glGetUniformLocation(ID, name.c_str()), x, y, z);
+  glUniform3f(getUniformLocation(name), x, y, z);
 }
 
-void Shader::setVec4(const std::string &name, const glm::vec4 &value) const
+void Shader::setVec4(std::string_view name, const glm::vec4 &value) const
 {
-  glUniform4fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]);
+  glUniform4fv(getUniformLocation(name), 1, &value[0]);
 }
 
-void Shader::setVec4(const std::string &name, float x, float y, float z, float w) const
+void Shader::setVec4(std::string_view name, float x, float y, float z, float w) const
 {
-  glUniform4f(glGetUniformLocation(ID, name.c_str()), x, y, z, w);
+  glUniform4f(getUniformLocation(name), x, y, z, w);
 }
 
-void Shader::setMat2(const std::string &name, const glm::mat2 &mat) const
+void Shader::setMat2(std::string_view name, const glm::mat2 &mat) const
 {
-  glUniformMatrix2fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+  glUniformMatrix2fv(getUniformLocation(name), 1, GL_FALSE, &mat[0][0]);
 }
 
-void Shader::setMat3(const std::string &name, const glm::mat3 &mat) const
+void Shader::setMat3(std::string_view name, const glm::mat3 &mat) const
 {
-  glUniformMatrix3fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+  glUniformMatrix3fv(getUniformLocation(name), 1, GL_FALSE, &mat[0][0]);
 }
 
-void Shader::setMat4(const std::string &name, const glm::mat4 &mat) const
+void Shader::setMat4(std::string_view name, const glm::mat4 &mat) const
 {
-  glUniformMatrix4fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+  glUniformMatrix4fv(getUniformLocation(name), 1, GL_FALSE, &mat[0][0]);
 }
 
 // 쉐이더 객체 및 쉐이더 프로그램 객체의 컴파일 및 링킹 에러 대응
+void Shader::setUniformBlockBinding(const std::string &name, GLuint bindingPoint) const
+{
+  // GLSL 330 에서는 layout(binding = N) 을 사용할 수 없으므로, 프로그램 링크 후 uniform block 인덱스를 조회해서 연결함
+  waitForLink();
+  GLuint blockIndex = glGetUniformBlockIndex(ID, name.c_str());
+  if (blockIndex != GL_INVALID_INDEX)
+  {
+    glUniformBlockBinding(ID, blockIndex, bindingPoint);
+  }
+}
+
+void Shader::finishLink() const
+{
+  auto waitStart = std::chrono::steady_clock::now();
+  const float overlapTimeMs = std::chrono::duration<float, std::milli>(waitStart - pendingLink.submitEnd).count();
+
+  // 컴파일 및 링크 결과 조회 (드라이버가 아직 컴파일 중이면 여기서 끝날 때까지 기다림)
+  checkCompileErrors(pendingLink.vertex, "VERTEX");
+  checkCompileErrors(pendingLink.fragment, "FRAGMENT");
+  checkCompileErrors(ID, "PROGRAM");
+
+  GLint linkStatus = GL_FALSE;
+  glGetProgramiv(ID, GL_LINK_STATUS, &linkStatus);
+  const float linkWaitTimeMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - waitStart).count();
+
+  // 쉐이더 객체 분리 및 삭제
+  glDetachShader(ID, pendingLink.vertex);
+  glDetachShader(ID, pendingLink.fragment);
+  glDeleteShader(pendingLink.vertex);
+  glDeleteShader(pendingLink.fragment);
+  linkPending = false;
+
+  ProgramBinaryCache &binaryCache = ProgramBinaryCache::getInstance();
+  binaryCache.recordCompile(pendingLink.submitTimeMs, linkWaitTimeMs, overlapTimeMs);
+  if (linkStatus == GL_TRUE)
+  {
+    binaryCache.store(pendingLink.cacheKey, ID);
+  }
+
+  // uniform 변수를 전송할 때마다 glGetUniformLocation() 을 호출하지 않도록 링크 직후 모든 uniform location 을 조회해 둠
+  introspectUniforms();
+}
+
+bool Shader::usesSource(std::string_view fileName) const
+{
+  return fileName == vertexName || fileName == fragmentName;
+}
+
+void Shader::beginReload()
+{
+  // 새 프로그램도 결과 조회가 지연되므로, 컴파일 및 링크는 pollReload() 에서 끝났는지 확인할 때까지 드라이버에서 진행됨
+  reloadCandidate = std::make_unique<Shader>(vertexName.c_str(), fragmentName.c_str(), defines);
+}
+
+ShaderReloadResult Shader::pollReload()
+{
+  if (!reloadCandidate)
+  {
+    return ShaderReloadResult::None;
+  }
+
+  if (!reloadCandidate->isLinkComplete())
+  {
+    return ShaderReloadResult::Pending;
+  }
+
+  // 컴파일 에러 로그는 링크 결과를 조회하면서 출력됨
+  reloadCandidate->waitForLink();
+
+  GLint linkStatus = GL_FALSE;
+  glGetProgramiv(reloadCandidate->ID, GL_LINK_STATUS, &linkStatus);
+  if (linkStatus != GL_TRUE)
+  {
+    spdlog::warn("Shader reload failed, keeping previous program : {}, {}", vertexName, fragmentName);
+    reloadCandidate.reset();
+    return ShaderReloadResult::Failed;
+  }
+
+  // 기존 프로그램에 설정된 상태를 새 프로그램에 복사한 뒤, 프로그램 객체 및 uniform 테이블을 통째로 교체
+  waitForLink();
+  copyProgramState(*reloadCandidate);
+
+  std::swap(ID, reloadCandidate->ID);
+  std::swap(uniformSlots, reloadCandidate->uniformSlots);
+  std::swap(uniformCount, reloadCandidate->uniformCount);
+  revision++;
+
+  // 기존 프로그램 객체를 넘겨받은 candidate 를 삭제하여 메모리 반납
+  reloadCandidate.reset();
+
+  spdlog::info("Shader reloaded : {}, {}", vertexName, fragmentName);
+  return ShaderReloadResult::Swapped;
+}
+
+std::uint32_t Shader::getRevision() const
+{
+  return revision;
+}
+
+std::string Shader::injectDefines(std::string_view source, const std::vector<std::string> &defines)
+{
+  // #version 은 소스의 첫 번째 지시문이어야 하므로 그 다음 줄에 삽입 (#version 이 없으면 맨 앞에 삽입)
+  size_t insertPosition = 0;
+  size_t versionLine = 0;
+  const size_t versionPosition = source.find("#version");
+  if (versionPosition != std::string_view::npos)
+  {
+    const size_t lineEnd = source.find('\n', versionPosition);
+    insertPosition = lineEnd == std::string_view::npos ? source.size() : lineEnd + 1;
+    versionLine = static_cast<size_t>(std::count(source.begin(), source.begin() + static_cast<std::ptrdiff_t>(versionPosition), '\n')) + 1;
+  }
+
+  std::string injected;
+  for (const std::string &define : defines)
+  {
+    injected += "#define " + define + "\n";
+  }
+  injected += "#line " + std::to_string(versionLine + 1) + "\n";
+
+  std::string result(source);
+  if (insertPosition == source.size() && !source.empty() && source.back() != '\n')
+  {
+    injected.insert(injected.begin(), '\n');
+  }
+  result.insert(insertPosition, injected);
+  return result;
+}
+
+void Shader::introspectUniforms() const
+{
+  GLint activeUniformCount = 0;
+  GLint maxNameLength = 0;
+  glGetProgramiv(ID, GL_ACTIVE_UNIFORMS, &activeUniformCount);
+  glGetProgramiv(ID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+
+  // 테이블 크기를 정하기 위해 (이름, location) 쌍들을 먼저 모아둠
+  struct ActiveUniform
+  {
+    std::string name;
+    GLint location;
+    GLenum type;
+  };
+  std::vector<ActiveUniform> uniforms;
+  std::vector<GLchar> nameBuffer(static_cast<size_t>(std::max(maxNameLength, 1)));
+  for (GLint i = 0; i < activeUniformCount; i++)
+  {
+    GLsizei length = 0;
+    GLint size = 0;
+    GLenum type = GL_NONE;
+    glGetActiveUniform(ID, static_cast<GLuint>(i), maxNameLength, &length, &size, &type, nameBuffer.data());
+
+    // uniform block 의 멤버는 location 을 갖지 않으므로 제외
+    std::string name(nameBuffer.data(), static_cast<size_t>(length));
+    GLint location = glGetUniformLocation(ID, name.c_str());
+    if (location == -1)
+    {
+      continue;
+    }
+
+    /*
+      배열 uniform 은 "name[0]" 이름 하나로 조회되므로, "name" 과 각 원소 이름을 모두 등록함.
+
+      -> 원소들의 location 이 연속된다는 보장이 없으므로 원소마다 location 을 조회함.
+    */
+    const std::string arraySuffix = "[0]";
+    if (name.size() > arraySuffix.size() && name.compare(name.size() - arraySuffix.size(), arraySuffix.size(), arraySuffix) == 0)
+    {
+      std::string baseName = name.substr(0, name.size() - arraySuffix.size());
+      uniforms.push_back({baseName, location, type});
+      for (GLint element = 0; element < size; element++)
+      {
+        std::string elementName = baseName + "[" + std::to_string(element) + "]";
+        uniforms.push_back({elementName, glGetUniformLocation(ID, elementName.c_str()), type});
+      }
+    }
+    else
+    {
+      uniforms.push_back({name, location, type});
+    }
+  }
+
+  // slot 의 절반 이하만 사용하도록 uniform 개수의 2배 이상인 2의 거듭제곱 크기로 테이블 생성
+  size_t capacity = 8;
+  while (capacity < uniforms.size() * 2)
+  {
+    capacity *= 2;
+  }
+  uniformSlots.assign(capacity, UniformSlot());
+  uniformCount = 0;
+
+  for (const auto &uniform : uniforms)
+  {
+    insertUniform(uniform.name, uniform.location, uniform.type);
+  }
+}
+
+void Shader::insertUniform(const std::string &name, GLint location, GLenum type) const
+{
+  const std::uint64_t hash = hashName(name);
+  const size_t mask = uniformSlots.size() - 1;
+  for (size_t slot = hash & mask;; slot = (slot + 1) & mask)
+  {
+    UniformSlot &uniform = uniformSlots[slot];
+    if (!uniform.occupied)
+    {
+      uniform.hash = hash;
+      uniform.name = name;
+      uniform.location = location;
+      uniform.type = type;
+      uniform.occupied = true;
+      uniformCount++;
+      return;
+    }
+
+    // 같은 이름이 이미 등록되어 있으면 (ex> 크기가 1 인 배열의 "name" 과 "name[0]") 무시
+    if (uniform.hash == hash && uniform.name == name)
+    {
+      return;
+    }
+  }
+}
+
+const Shader::UniformSlot *Shader::findUniform(std::string_view name) const
+{
+  if (uniformSlots.empty())
+  {
+    return nullptr;
+  }
+
+  const std::uint64_t hash = hashName(name);
+  const size_t mask = uniformSlots.size() - 1;
+  for (size_t slot = hash & mask;; slot = (slot + 1) & mask)
+  {
+    const UniformSlot &uniform = uniformSlots[slot];
+    if (!uniform.occupied)
+    {
+      return nullptr;
+    }
+
+    if (uniform.hash == hash && uniform.name == name)
+    {
+      return &uniform;
+    }
+  }
+}
+
+void Shader::copyProgramState(const Shader &target) const
+{
+  /*
+    uniform 값은 프로그램 객체마다 따로 저장되므로, 기존 프로그램에서 glGetUniform*v() 로 읽어서 새 프로그램에 전송함.
+
+    -> glUniform*() 은 현재 바인딩된 프로그램에 적용되므로 잠시 target 을 바인딩한 뒤 원래 프로그램으로 되돌림.
+    -> 배열 uniform 은 "name" 과 "name[0]" 이 같은 location 이므로 같은 값이 두 번 복사될 수 있지만 결과는 같음.
+  */
+  GLint previousProgram = 0;
+  glGetIntegerv(GL_CURRENT_PROGRAM, &previousProgram);
+  glUseProgram(target.ID);
+
+  GLfloat floats[16];
+  GLint ints[4];
+  for (const UniformSlot &uniform : uniformSlots)
+  {
+    if (!uniform.occupied)
+    {
+      continue;
+    }
+
+    const UniformSlot *targetUniform = target.findUniform(uniform.name);
+    if (!targetUniform || targetUniform->type != uniform.type)
+    {
+      continue;
+    }
+
+    const GLint location = targetUniform->location;
+    switch (uniform.type)
+    {
+    case GL_FLOAT:
+      glGetUniformfv(ID, uniform.location, floats);
+      glUniform1fv(location, 1, floats);
+      break;
+    case GL_FLOAT_VEC2:
+      glGetUniformfv(ID, uniform.location, floats);
+      glUniform2fv(location, 1, floats);
+      break;
+    case GL_FLOAT_VEC3:
+      glGetUniformfv(ID, uniform.location, floats);
+      glUniform3fv(location, 1, floats);
+      break;
+    case GL_FLOAT_VEC4:
+      glGetUniformfv(ID, uniform.location, floats);
+      glUniform4fv(location, 1, floats);
+      break;
+    case GL_FLOAT_MAT2:
+      glGetUniformfv(ID, uniform.location, floats);
+      glUniformMatrix2fv(location, 1, GL_FALSE, floats);
+      break;
+    case GL_FLOAT_MAT3:
+      glGetUniformfv(ID, uniform.location, floats);
+      glUniformMatrix3fv(location, 1, GL_FALSE, floats);
+      break;
+    case GL_FLOAT_MAT4:
+      glGetUniformfv(ID, uniform.location, floats);
+      glUniformMatrix4fv(location, 1, GL_FALSE, floats);
+      break;
+    case GL_INT:
+    case GL_BOOL:
+    case GL_SAMPLER_2D:
+    case GL_SAMPLER_CUBE:
+      glGetUniformiv(ID, uniform.location, ints);
+      glUniform1iv(location, 1, ints);
+      break;
+    default:
+      // 나머지 타입은 이 프로젝트의 쉐이더에서 사용하지 않으므로 복사하지 않음
+      break;
+    }
+  }
+
+  glUseProgram(static_cast<GLuint>(previousProgram));
+
+  // uniform block binding 도 프로그램 객체마다 따로 저장되므로 같은 이름의 block 에 같은 binding point 를 연결
+  GLint blockCount = 0;
+  GLint maxBlockNameLength = 0;
+  glGetProgramiv(ID, GL_ACTIVE_UNIFORM_BLOCKS, &blockCount);
+  glGetProgramiv(ID, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &maxBlockNameLength);
+
+  std::vector<GLchar> nameBuffer(static_cast<size_t>(std::max(maxBlockNameLength, 1)));
+  for (GLint i = 0; i < blockCount; i++)
+  {
+    GLsizei length = 0;
+    glGetActiveUniformBlockName(ID, static_cast<GLuint>(i), maxBlockNameLength, &length, nameBuffer.data());
+
+    GLint bindingPoint = 0;
+    glGetActiveUniformBlockiv(ID, static_cast<GLuint>(i), GL_UNIFORM_BLOCK_BINDING, &bindingPoint);
+    target.setUniformBlockBinding(std::string(nameBuffer.data(), static_cast<size_t>(length)), static_cast<GLuint>(bindingPoint));
+  }
+}
+
+std::uint64_t Shader::hashName(std::string_view name)
+{
+  // 64-bit FNV-1a
+  std::uint64_t hash = 14695981039346656037ull;
+  for (char c : name)
+  {
+    hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+  }
+  return hash;
+}
+
 void Shader::checkCompileErrors(unsigned int shader, std::string type)
 {
   int success;
@@ -171,3 +628,20 @@ void Shader::checkCompileErrors(unsigned int shader, std::string type)
     }
   }
 }
+
+/*
+  컴파일 및 링크 결과 조회 지연
+
+  glCompileShader(), glLinkProgram() 은 작업을 드라이버에 제출만 하고 바로 반환될 수 있지만,
+  직후에 GL_COMPILE_STATUS, GL_LINK_STATUS 를 조회하면 드라이버는 결과를 알려주기 위해
+  그 자리에서 컴파일 및 링크를 끝까지 진행해야 함.
+
+  그래서 쉐이더를 하나씩 생성하면서 매번 결과를 조회하면 모든 프로그램이 순서대로 컴파일되지만,
+  모든 프로그램을 먼저 제출해두고 결과는 처음 사용할 때 조회하면
+  그 사이에 수행하는 HDR 이미지 디코딩, 모델 import 같은 CPU 작업과
+  드라이버의 컴파일 작업이 겹쳐서 진행될 수 있음.
+
+  -> KHR_parallel_shader_compile 을 지원하는 드라이버는 여러 스레드에서 프로그램들을 동시에 컴파일하므로 효과가 더 큼.
+  -> ShaderConstants::DEFERRED_LINK_ENABLED 를 false 로 바꾸면 생성자에서 바로 결과를 조회하는 이전 방식으로 동작하므로,
+  두 방식의 시작 시간을 비교하여 절약된 시간을 측정할 수 있음.
+*/
@@ -0,0 +1,41 @@
+#include "shader/shader_sources.hpp"
+#include "constants/shader_constants.hpp"
+#include <fstream>
+#include <sstream>
+
+// 빌드 시 생성되는 헤더 (cmake/embed_shaders.cmake 참고)
+#include <embedded_shader_data.hpp>
+
+namespace ShaderSources
+{
+  std::string_view findEmbedded(std::string_view name)
+  {
+    // 쉐이더 소스 개수가 적으므로 선형 탐색
+    for (const EmbeddedShaderData::Entry &entry : EmbeddedShaderData::ENTRIES)
+    {
+      if (name == entry.name)
+      {
+        return std::string_view(reinterpret_cast<const char *>(entry.data), entry.size);
+      }
+    }
+
+    return std::string_view();
+  }
+
+  std::string_view load(std::string_view name, std::string &storage)
+  {
+    if (ShaderConstants::SOURCE_OVERRIDE_ENABLED)
+    {
+      std::ifstream file(std::string(ShaderConstants::SHADER_SOURCE_DIRECTORY) + "/" + std::string(name), std::ios::binary);
+      if (file)
+      {
+        std::stringstream stream;
+        stream << file.rdbuf();
+        storage = stream.str();
+        return storage;
+      }
+    }
+
+    return findEmbedded(name);
+  }
+}
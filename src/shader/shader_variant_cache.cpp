@@ -0,0 +1,173 @@
+#include "shader/shader_variant_cache.hpp"
+#include <spdlog/spdlog.h>
+#include <chrono>
+
+ShaderVariantCache::ShaderVariantCache(const std::string &vertexName, const std::string &fragmentName)
+    : vertexName(vertexName), fragmentName(fragmentName)
+{
+}
+
+void ShaderVariantCache::addProgramInitializer(std::function<void(Shader &)> initializer)
+{
+  for (ShaderVariant *variant : variantOrder)
+  {
+    if (variant->initialized)
+    {
+      initializer(*variant->shader);
+    }
+  }
+
+  programInitializers.push_back(std::move(initializer));
+}
+
+ShaderVariant &ShaderVariantCache::acquire(std::uint32_t key, const std::vector<std::string> &defines, const std::string &label)
+{
+  ShaderVariant &variant = findOrCreate(key, defines, label);
+  initialize(variant);
+  return variant;
+}
+
+void ShaderVariantCache::prepare(std::uint32_t key, const std::vector<std::string> &defines, const std::string &label)
+{
+  findOrCreate(key, defines, label);
+}
+
+ShaderVariant *ShaderVariantCache::find(std::uint32_t key)
+{
+  auto found = variants.find(key);
+  if (found == variants.end())
+  {
+    return nullptr;
+  }
+
+  initialize(*found->second);
+  return found->second.get();
+}
+
+size_t ShaderVariantCache::size() const
+{
+  return variants.size();
+}
+
+void ShaderVariantCache::beginReload(std::string_view fileName)
+{
+  // 모든 변형이 같은 소스를 사용하므로 첫 번째 변형으로만 검사
+  if (variantOrder.empty() || !variantOrder.front()->shader->usesSource(fileName))
+  {
+    return;
+  }
+
+  for (ShaderVariant *variant : variantOrder)
+  {
+    variant->shader->beginReload();
+  }
+}
+
+void ShaderVariantCache::pollReloads()
+{
+  for (ShaderVariant *variant : variantOrder)
+  {
+    variant->shader->pollReload();
+  }
+}
+
+void ShaderVariantCache::beginFrame()
+{
+  frameIndex = (frameIndex + 1) % frameTimers.size();
+  FrameTimers &frame = frameTimers[frameIndex];
+
+  /*
+    이 slot 은 VARIANT_TIMER_FRAMES 프레임 전에 기록되었으므로 대부분 결과가 준비되어 있음.
+
+    -> 마지막 구간의 종료 시각이 준비되었으면 그 이전 query 들도 모두 준비된 것이므로 마지막 것만 확인하고,
+    아직 준비되지 않았으면 렌더링 루프를 멈추지 않도록 이번에는 읽지 않고 버림.
+  */
+  if (frame.usedCount > 0 && frame.spans[frame.usedCount - 1].end->isResultAvailable())
+  {
+    for (size_t i = 0; i < frame.usedCount; i++)
+    {
+      frame.spans[i].variant->gpuTimeMs = 0.0f;
+    }
+
+    for (size_t i = 0; i < frame.usedCount; i++)
+    {
+      const TimerSpan &span = frame.spans[i];
+      const GLuint64 begin = span.begin->getResult();
+      const GLuint64 end = span.end->getResult();
+      span.variant->gpuTimeMs += end > begin ? static_cast<float>(end - begin) * 1e-6f : 0.0f;
+    }
+  }
+
+  frame.usedCount = 0;
+}
+
+void ShaderVariantCache::beginGpuTimer(ShaderVariant &variant)
+{
+  FrameTimers &frame = frameTimers[frameIndex];
+  if (frame.usedCount == frame.spans.size())
+  {
+    TimerSpan span;
+    span.begin = std::make_unique<QueryObject>(GL_TIMESTAMP);
+    span.end = std::make_unique<QueryObject>(GL_TIMESTAMP);
+    frame.spans.push_back(std::move(span));
+  }
+
+  TimerSpan &span = frame.spans[frame.usedCount];
+  span.variant = &variant;
+  span.begin->recordTimestamp();
+}
+
+void ShaderVariantCache::endGpuTimer()
+{
+  FrameTimers &frame = frameTimers[frameIndex];
+  frame.spans[frame.usedCount].end->recordTimestamp();
+  frame.usedCount++;
+}
+
+void ShaderVariantCache::getVariantStats(std::vector<ShaderVariantStats> &stats) const
+{
+  for (const ShaderVariant *variant : variantOrder)
+  {
+    stats.push_back({variant->label.c_str(), variant->gpuTimeMs});
+  }
+}
+
+ShaderVariant &ShaderVariantCache::findOrCreate(std::uint32_t key, const std::vector<std::string> &defines, const std::string &label)
+{
+  auto found = variants.find(key);
+  if (found != variants.end())
+  {
+    return *found->second;
+  }
+
+  auto submitStart = std::chrono::steady_clock::now();
+
+  auto variant = std::make_unique<ShaderVariant>();
+  variant->shader = std::make_unique<Shader>(vertexName.c_str(), fragmentName.c_str(), defines);
+  variant->key = key;
+  variant->label = label;
+
+  spdlog::info("Shader variant created : {} ({:.2f} ms)",
+               label,
+               std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - submitStart).count());
+
+  ShaderVariant &created = *variant;
+  variantOrder.push_back(&created);
+  variants.emplace(key, std::move(variant));
+  return created;
+}
+
+void ShaderVariantCache::initialize(ShaderVariant &variant)
+{
+  if (variant.initialized)
+  {
+    return;
+  }
+
+  // 초기화 함수들은 uniform 전송 등으로 링크 결과가 필요하므로, 제출만 해둔 변형은 여기서 링크가 끝날 때까지 기다림
+  for (const auto &initializer : programInitializers)
+  {
+    initializer(*variant.shader);
+  }
+  variant.initialized = true;
+}
@@ -0,0 +1,108 @@
+#include "shader/shader_watcher.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+
+#if defined(__linux__)
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <climits>
+#include <cerrno>
+#include <cstring>
+#endif
+
+ShaderWatcher::ShaderWatcher()
+    : inotifyFd(-1),
+      watchDescriptor(-1)
+{
+}
+
+ShaderWatcher::~ShaderWatcher()
+{
+  close();
+}
+
+bool ShaderWatcher::watch(const std::string &directory)
+{
+  close();
+
+#if defined(__linux__)
+  inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (inotifyFd == -1)
+  {
+    spdlog::warn("Shader hot reload disabled : inotify_init1 failed ({})", std::strerror(errno));
+    return false;
+  }
+
+  watchDescriptor = inotify_add_watch(inotifyFd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+  if (watchDescriptor == -1)
+  {
+    spdlog::warn("Shader hot reload disabled : cannot watch {} ({})", directory, std::strerror(errno));
+    close();
+    return false;
+  }
+
+  // 이벤트 하나의 최대 크기 (이름은 NAME_MAX 바이트 + null 문자) 의 여러 배로 버퍼 생성
+  eventBuffer.resize(16 * (sizeof(inotify_event) + NAME_MAX + 1));
+
+  spdlog::info("Shader hot reload : watching {}", directory);
+  return true;
+#else
+  spdlog::info("Shader hot reload is not supported on this platform : {}", directory);
+  return false;
+#endif
+}
+
+void ShaderWatcher::poll(std::vector<std::string> &changedFiles)
+{
+#if defined(__linux__)
+  if (inotifyFd == -1)
+  {
+    return;
+  }
+
+  const size_t firstChanged = changedFiles.size();
+
+  // non-blocking fd 이므로 읽을 이벤트가 없으면 -1 (EAGAIN) 을 반환하고 반복문이 끝남
+  for (;;)
+  {
+    const ssize_t length = read(inotifyFd, eventBuffer.data(), eventBuffer.size());
+    if (length <= 0)
+    {
+      break;
+    }
+
+    for (ssize_t offset = 0; offset < length;)
+    {
+      const inotify_event *event = reinterpret_cast<const inotify_event *>(eventBuffer.data() + offset);
+      offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+      if (event->len == 0 || (event->mask & IN_ISDIR))
+      {
+        continue;
+      }
+
+      // 에디터가 한번 저장할 때 여러 이벤트가 발생할 수 있으므로 같은 파일은 한번만 추가
+      std::string fileName(event->name);
+      if (std::find(changedFiles.begin() + static_cast<std::ptrdiff_t>(firstChanged), changedFiles.end(), fileName) == changedFiles.end())
+      {
+        changedFiles.push_back(std::move(fileName));
+      }
+    }
+  }
+#else
+  (void)changedFiles;
+#endif
+}
+
+void ShaderWatcher::close()
+{
+#if defined(__linux__)
+  if (inotifyFd != -1)
+  {
+    // fd 를 닫으면 등록된 watch 도 함께 제거됨
+    ::close(inotifyFd);
+  }
+#endif
+  inotifyFd = -1;
+  watchDescriptor = -1;
+}
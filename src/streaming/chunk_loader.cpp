@@ -0,0 +1,114 @@
+#include "streaming/chunk_loader.hpp"
+#include <spdlog/spdlog.h>
+#include <stdexcept>
+
+ChunkLoader::ChunkLoader(const ChunkedMeshFile &file, size_t threadCount)
+    : file(file)
+{
+  threads.reserve(threadCount);
+  for (size_t i = 0; i < threadCount; i++)
+  {
+    threads.emplace_back(&ChunkLoader::ioLoop, this);
+  }
+}
+
+ChunkLoader::~ChunkLoader()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+  requestAvailable.notify_all();
+
+  for (std::thread &thread : threads)
+  {
+    thread.join();
+  }
+}
+
+void ChunkLoader::cancelRequests(std::vector<size_t> &cancelled)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  cancelled.insert(cancelled.end(), requests.begin(), requests.end());
+  requests.clear();
+}
+
+void ChunkLoader::addRequests(const std::vector<size_t> &chunks)
+{
+  if (chunks.empty())
+  {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    requests.insert(requests.end(), chunks.begin(), chunks.end());
+  }
+  requestAvailable.notify_all();
+}
+
+bool ChunkLoader::poll(LoadedChunk &loaded)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  if (completed.empty())
+  {
+    return false;
+  }
+
+  loaded = std::move(completed.front());
+  completed.pop_front();
+  return true;
+}
+
+size_t ChunkLoader::getReadBytes() const
+{
+  return readBytes.load(std::memory_order_relaxed);
+}
+
+void ChunkLoader::ioLoop()
+{
+  // 스레드마다 자신의 파일 스트림을 열어서 다른 I/O 스레드와 seek 위치가 섞이지 않도록 함
+  std::ifstream stream;
+  try
+  {
+    stream = file.openStream();
+  }
+  catch (const std::runtime_error &e)
+  {
+    spdlog::error("{}", e.what());
+  }
+
+  while (true)
+  {
+    LoadedChunk loaded;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      requestAvailable.wait(lock, [this]()
+                            { return stopping || !requests.empty(); });
+      if (stopping)
+      {
+        return;
+      }
+
+      loaded.chunk = requests.front();
+      requests.pop_front();
+    }
+
+    // 파일 읽기는 lock 을 잡지 않은 상태에서 수행
+    try
+    {
+      file.readChunk(stream, loaded.chunk, loaded.data);
+      readBytes.fetch_add(file.getChunks()[loaded.chunk].getByteSize(), std::memory_order_relaxed);
+    }
+    catch (const std::runtime_error &e)
+    {
+      spdlog::error("{}", e.what());
+      loaded.failed = true;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      completed.push_back(std::move(loaded));
+    }
+  }
+}
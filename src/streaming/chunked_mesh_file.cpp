@@ -0,0 +1,80 @@
+#include "streaming/chunked_mesh_file.hpp"
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+static_assert(std::is_trivially_copyable_v<ChunkedMeshHeader>, "ChunkedMeshHeader must be trivially copyable");
+static_assert(std::is_trivially_copyable_v<ChunkNode>, "ChunkNode must be trivially copyable");
+static_assert(std::is_trivially_copyable_v<ChunkRecord>, "ChunkRecord must be trivially copyable");
+
+ChunkedMeshFile::ChunkedMeshFile(const std::string &path)
+    : path(path)
+{
+  std::ifstream stream = openStream();
+
+  stream.read(reinterpret_cast<char *>(&header), sizeof(header));
+  if (!stream || std::memcmp(header.magic, ChunkedMeshFormat::MAGIC, sizeof(header.magic)) != 0)
+  {
+    throw std::runtime_error("Invalid chunked mesh file: " + path);
+  }
+
+  if (header.version != ChunkedMeshFormat::VERSION || header.vertexStride != sizeof(ChunkVertexData))
+  {
+    throw std::runtime_error("Unsupported chunked mesh file version: " + path);
+  }
+
+  // 노드 계층 구조 및 chunk 테이블은 파일 끝에 연속으로 저장되어 있음
+  nodes.resize(header.nodeCount);
+  chunks.resize(header.chunkCount);
+
+  stream.seekg(static_cast<std::streamoff>(header.tableOffset));
+  stream.read(reinterpret_cast<char *>(nodes.data()), static_cast<std::streamsize>(nodes.size() * sizeof(ChunkNode)));
+  stream.read(reinterpret_cast<char *>(chunks.data()), static_cast<std::streamsize>(chunks.size() * sizeof(ChunkRecord)));
+  if (!stream)
+  {
+    throw std::runtime_error("Failed to read chunked mesh tables: " + path);
+  }
+}
+
+const ChunkedMeshHeader &ChunkedMeshFile::getHeader() const
+{
+  return header;
+}
+
+const std::vector<ChunkNode> &ChunkedMeshFile::getNodes() const
+{
+  return nodes;
+}
+
+const std::vector<ChunkRecord> &ChunkedMeshFile::getChunks() const
+{
+  return chunks;
+}
+
+std::ifstream ChunkedMeshFile::openStream() const
+{
+  std::ifstream stream(path, std::ios::binary);
+  if (!stream)
+  {
+    throw std::runtime_error("Failed to open chunked mesh file: " + path);
+  }
+  return stream;
+}
+
+void ChunkedMeshFile::readChunk(std::ifstream &stream, size_t chunk, ChunkData &data) const
+{
+  const ChunkRecord &record = chunks[chunk];
+
+  // payload 는 정점 배열 바로 뒤에 인덱스 배열이 이어서 저장되어 있음
+  data.vertices.resize(record.vertexCount);
+  data.indices.resize(record.indexCount);
+
+  stream.clear();
+  stream.seekg(static_cast<std::streamoff>(record.offset));
+  stream.read(reinterpret_cast<char *>(data.vertices.data()), static_cast<std::streamsize>(data.vertices.size() * sizeof(ChunkVertexData)));
+  stream.read(reinterpret_cast<char *>(data.indices.data()), static_cast<std::streamsize>(data.indices.size() * sizeof(ChunkIndexType)));
+  if (!stream)
+  {
+    throw std::runtime_error("Failed to read chunk " + std::to_string(chunk) + " from " + path);
+  }
+}
@@ -0,0 +1,690 @@
+#include "streaming/chunked_mesh_writer.hpp"
+#include "streaming/chunked_mesh_file.hpp"
+#include "mesh/vertex_packing.hpp"
+#include "mesh/bounding_volume.hpp"
+
+#include <assimp/Importer.hpp>
+#include <assimp/scene.h>
+#include <assimp/postprocess.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+
+namespace
+{
+  constexpr unsigned int INVALID_LOCAL_INDEX = std::numeric_limits<unsigned int>::max();
+
+  // out-of-core 분할 시 무게중심 분포를 집계할 histogram bin 개수
+  constexpr size_t SPLIT_BINS = 256;
+
+  BoundingBox mergeBoundingBoxes(const BoundingBox &a, const BoundingBox &b)
+  {
+    return {glm::min(a.min, b.min), glm::max(a.max, b.max)};
+  }
+
+  int getLongestAxis(const BoundingBox &box)
+  {
+    const glm::vec3 extent = box.max - box.min;
+    return extent.x >= extent.y && extent.x >= extent.z ? 0 : (extent.y >= extent.z ? 1 : 2);
+  }
+
+  // convert() 의 cancelRequested 가 켜졌을 때 batch 사이에서 변환을 중단하기 위한 예외 (convert() 밖으로 전파되지 않음)
+  struct ConversionCancelled
+  {
+  };
+
+  void checkCancelled(const std::atomic<bool> *cancelRequested)
+  {
+    if (cancelRequested && cancelRequested->load(std::memory_order_relaxed))
+    {
+      throw ConversionCancelled{};
+    }
+  }
+
+  /**
+   * 삼각형 목록을 재귀적으로 나누며 노드 계층 구조를 만들고, leaf 노드의 chunk payload 를 곧바로 파일에 기록하는 클래스
+   *
+   * chunk 마다 정점을 지역 인덱스로 다시 매기기 위한 배열은 전체 정점 개수만큼 한번만 할당하고,
+   * chunk 를 기록할 때 사용한 항목만 되돌려서 재사용함.
+   *
+   * -> 노드 및 chunk 테이블은 ChunkFileWriter 가 소유하므로, out-of-core 분할로 만든 상위 노드들 아래에 하위 트리를 이어서 추가할 수 있음.
+   */
+  class ChunkBuilder
+  {
+  public:
+    ChunkBuilder(std::ofstream &stream,
+                 const std::vector<VertexData> &vertices,
+                 const std::vector<unsigned int> &indices,
+                 size_t maxTrianglesPerChunk,
+                 std::vector<ChunkNode> &nodes,
+                 std::vector<ChunkRecord> &chunks)
+        : nodes(nodes), chunks(chunks), stream(stream), vertices(vertices), indices(indices), maxTriangles(maxTrianglesPerChunk), localIndexOf(vertices.size(), INVALID_LOCAL_INDEX)
+    {
+      const size_t triangleCount = indices.size() / 3;
+      triangles.resize(triangleCount);
+      centroids.resize(triangleCount);
+      for (size_t t = 0; t < triangleCount; t++)
+      {
+        triangles[t] = static_cast<unsigned int>(t);
+        centroids[t] = (vertices[indices[t * 3 + 0]].Position + vertices[indices[t * 3 + 1]].Position + vertices[indices[t * 3 + 2]].Position) / 3.0f;
+      }
+    }
+
+    // triangles[begin, end) 구간의 노드를 전위 순회 순서로 추가하고 노드의 bounding box 반환
+    BoundingBox buildNode(size_t begin, size_t end)
+    {
+      const size_t node = nodes.size();
+      nodes.push_back({});
+
+      BoundingBox bounds;
+      if (end - begin <= maxTriangles)
+      {
+        nodes[node].chunk = static_cast<std::int32_t>(chunks.size());
+        bounds = writeChunk(begin, end);
+      }
+      else
+      {
+        // 무게중심들의 AABB 에서 가장 긴 축을 기준으로 중앙값 위치에서 삼각형들을 두 그룹으로 나눔
+        BoundingBox centroidBounds{centroids[triangles[begin]], centroids[triangles[begin]]};
+        for (size_t i = begin; i < end; i++)
+        {
+          centroidBounds.min = glm::min(centroidBounds.min, centroids[triangles[i]]);
+          centroidBounds.max = glm::max(centroidBounds.max, centroids[triangles[i]]);
+        }
+
+        const int axis = getLongestAxis(centroidBounds);
+
+        const size_t middle = begin + (end - begin) / 2;
+        std::nth_element(triangles.begin() + begin, triangles.begin() + middle, triangles.begin() + end,
+                         [this, axis](unsigned int a, unsigned int b)
+                         { return centroids[a][axis] < centroids[b][axis]; });
+
+        nodes[node].chunk = -1;
+        bounds = mergeBoundingBoxes(buildNode(begin, middle), buildNode(middle, end));
+      }
+
+      nodes[node].bounds = bounds;
+      nodes[node].subtreeEnd = static_cast<std::uint32_t>(nodes.size());
+      return bounds;
+    }
+
+  private:
+    std::vector<ChunkNode> &nodes;
+    std::vector<ChunkRecord> &chunks;
+
+    std::ofstream &stream;
+    const std::vector<VertexData> &vertices;
+    const std::vector<unsigned int> &indices;
+    size_t maxTriangles;
+
+    std::vector<unsigned int> triangles;
+    std::vector<glm::vec3> centroids;
+    std::vector<unsigned int> localIndexOf;
+
+    // chunk 하나를 구성하는 데 재사용하는 배열들
+    std::vector<unsigned int> chunkVertexIndices;
+    std::vector<VertexData> chunkVertices;
+    std::vector<ChunkVertexData> packedVertices;
+    std::vector<ChunkIndexType> chunkIndices;
+    std::vector<glm::vec3> chunkPositions;
+
+    // triangles[begin, end) 구간을 chunk 로 기록하고 chunk 의 bounding box 반환
+    BoundingBox writeChunk(size_t begin, size_t end)
+    {
+      chunkVertexIndices.clear();
+      chunkIndices.clear();
+      for (size_t i = begin; i < end; i++)
+      {
+        for (int k = 0; k < 3; k++)
+        {
+          unsigned int vertex = indices[triangles[i] * 3 + k];
+          if (localIndexOf[vertex] == INVALID_LOCAL_INDEX)
+          {
+            localIndexOf[vertex] = static_cast<unsigned int>(chunkVertexIndices.size());
+            chunkVertexIndices.push_back(vertex);
+          }
+          chunkIndices.push_back(static_cast<ChunkIndexType>(localIndexOf[vertex]));
+        }
+      }
+
+      chunkVertices.clear();
+      chunkPositions.clear();
+      for (unsigned int vertex : chunkVertexIndices)
+      {
+        chunkVertices.push_back(vertices[vertex]);
+        chunkPositions.push_back(vertices[vertex].Position);
+        localIndexOf[vertex] = INVALID_LOCAL_INDEX;
+      }
+
+      // chunk 마다 position 양자화 범위를 따로 잡아서 정밀도를 높임
+      ChunkRecord record;
+      record.offset = static_cast<std::uint64_t>(stream.tellp());
+      record.vertexCount = static_cast<std::uint32_t>(chunkVertices.size());
+      record.indexCount = static_cast<std::uint32_t>(chunkIndices.size());
+      record.dequantization = VertexPacking::pack(chunkVertices, packedVertices);
+      record.sphere = computeBoundingSphere(chunkPositions);
+      chunks.push_back(record);
+
+      stream.write(reinterpret_cast<const char *>(packedVertices.data()), static_cast<std::streamsize>(packedVertices.size() * sizeof(ChunkVertexData)));
+      stream.write(reinterpret_cast<const char *>(chunkIndices.data()), static_cast<std::streamsize>(chunkIndices.size() * sizeof(ChunkIndexType)));
+
+      return computeBoundingBox(chunkPositions);
+    }
+  };
+
+  /**
+   * chunk 파일 하나를 기록하는 클래스
+   *
+   * 헤더 자리를 비워두고 payload 를 순차적으로 기록한 뒤, finish() 에서 테이블과 헤더를 기록하고 "<path>.partial" 을 path 로 이름을 바꿈.
+   * (finish() 전에 소멸되면 기록 중이던 파일을 지움)
+   */
+  class ChunkFileWriter
+  {
+  public:
+    ChunkFileWriter(const std::string &path, size_t maxTrianglesPerChunk)
+        : path(path), partialPath(path + ".partial"), maxTriangles(maxTrianglesPerChunk)
+    {
+      // chunk 의 정점 개수는 최대 삼각형 개수의 3배이므로 16-bit 인덱스 범위를 넘지 않아야 함
+      if (maxTrianglesPerChunk == 0 || maxTrianglesPerChunk * 3 > MAX_SHORT_INDEXED_VERTICES)
+      {
+        throw std::invalid_argument("Chunk triangle count must be in (0, MAX_SHORT_INDEXED_VERTICES / 3].");
+      }
+
+      stream.open(partialPath, std::ios::binary | std::ios::trunc);
+      if (!stream)
+      {
+        throw std::runtime_error("Failed to create chunked mesh file: " + partialPath);
+      }
+
+      // 테이블 위치를 알 수 없으므로 헤더 자리를 먼저 비워두고 payload 를 순차적으로 기록
+      std::copy(std::begin(ChunkedMeshFormat::MAGIC), std::end(ChunkedMeshFormat::MAGIC), header.magic);
+      header.version = ChunkedMeshFormat::VERSION;
+      header.vertexStride = sizeof(ChunkVertexData);
+      stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    }
+
+    ~ChunkFileWriter()
+    {
+      if (!finished)
+      {
+        stream.close();
+        std::error_code error;
+        std::filesystem::remove(partialPath, error);
+      }
+    }
+
+    ChunkFileWriter(const ChunkFileWriter &) = delete;
+    ChunkFileWriter &operator=(const ChunkFileWriter &) = delete;
+
+    // 메모리에 올린 삼각형들을 하위 트리로 추가하고 chunk payload 들을 기록
+    BoundingBox buildInMemory(const std::vector<VertexData> &vertices, const std::vector<unsigned int> &indices)
+    {
+      ChunkBuilder builder(stream, vertices, indices, maxTriangles, nodes, chunks);
+      return builder.buildNode(0, indices.size() / 3);
+    }
+
+    // 하위 트리를 추가하기 전에 내부 노드 자리를 추가하고 인덱스 반환 (하위 트리를 모두 추가한 뒤 endInternalNode() 호출)
+    size_t beginInternalNode()
+    {
+      nodes.push_back({});
+      nodes.back().chunk = -1;
+      return nodes.size() - 1;
+    }
+
+    void endInternalNode(size_t node, const BoundingBox &bounds)
+    {
+      nodes[node].bounds = bounds;
+      nodes[node].subtreeEnd = static_cast<std::uint32_t>(nodes.size());
+    }
+
+    void finish(const BoundingBox &bounds, size_t triangleCount)
+    {
+      header.bounds = bounds;
+      header.nodeCount = static_cast<std::uint32_t>(nodes.size());
+      header.chunkCount = static_cast<std::uint32_t>(chunks.size());
+      header.tableOffset = static_cast<std::uint64_t>(stream.tellp());
+      stream.write(reinterpret_cast<const char *>(nodes.data()), static_cast<std::streamsize>(nodes.size() * sizeof(ChunkNode)));
+      stream.write(reinterpret_cast<const char *>(chunks.data()), static_cast<std::streamsize>(chunks.size() * sizeof(ChunkRecord)));
+
+      stream.seekp(0);
+      stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+      stream.close();
+      if (!stream)
+      {
+        throw std::runtime_error("Failed to write chunked mesh file: " + partialPath);
+      }
+
+      std::filesystem::rename(partialPath, path);
+      finished = true;
+
+      spdlog::info("Chunked mesh <{}> written ({} triangles in {} chunks, {} nodes, {:.1f} MB)",
+                   path,
+                   triangleCount,
+                   chunks.size(),
+                   nodes.size(),
+                   static_cast<double>(header.tableOffset) / (1024.0 * 1024.0));
+    }
+
+  private:
+    std::string path;
+    std::string partialPath;
+    size_t maxTriangles;
+
+    std::ofstream stream;
+    ChunkedMeshHeader header{};
+    std::vector<ChunkNode> nodes;
+    std::vector<ChunkRecord> chunks;
+    bool finished = false;
+  };
+
+  /**
+   * out-of-core 분할 시 임시 파일에 기록되는 삼각형 하나 (인덱스 없이 세 정점을 그대로 저장)
+   *
+   * -> 정점은 VertexData{} 로 0 초기화한 뒤 값을 채우므로, 같은 정점은 바이트 단위로도 같음. (메모리에 올릴 때 중복 정점 제거에 사용)
+   */
+  struct SoupTriangle
+  {
+    VertexData vertices[3];
+
+    glm::vec3 getCentroid() const
+    {
+      return (vertices[0].Position + vertices[1].Position + vertices[2].Position) / 3.0f;
+    }
+  };
+
+  static_assert(std::is_trivially_copyable_v<SoupTriangle>, "SoupTriangle must be trivially copyable");
+
+  // 삼각형들이 기록된 임시 파일 및 삼각형 개수, 무게중심들의 AABB
+  struct TriangleBucket
+  {
+    std::string path;
+    size_t triangleCount = 0;
+    BoundingBox centroidBounds;
+  };
+
+  // VertexData 를 바이트 단위로 비교하는 hash 및 equal (VertexData 에는 padding 이 없음)
+  struct VertexDataHash
+  {
+    size_t operator()(const VertexData &vertex) const
+    {
+      // FNV-1a
+      const unsigned char *bytes = reinterpret_cast<const unsigned char *>(&vertex);
+      std::uint64_t hash = 14695981039346656037ull;
+      for (size_t i = 0; i < sizeof(VertexData); i++)
+      {
+        hash = (hash ^ bytes[i]) * 1099511628211ull;
+      }
+      return static_cast<size_t>(hash);
+    }
+  };
+
+  struct VertexDataEqual
+  {
+    bool operator()(const VertexData &a, const VertexData &b) const
+    {
+      return std::memcmp(&a, &b, sizeof(VertexData)) == 0;
+    }
+  };
+
+  /**
+   * 원본 Scene 의 삼각형들을 임시 파일들로 나눠가며 chunk 파일의 상위 노드들을 만들고,
+   * 메모리에 올릴 수 있는 크기가 된 임시 파일만 ChunkFileWriter::buildInMemory() 로 하위 트리를 기록하는 클래스
+   *
+   * 임시 파일은 사용이 끝나는 즉시 지우고, 중간에 예외가 발생해도 소멸자에서 남은 임시 파일들을 지움.
+   */
+  class OutOfCoreBuilder
+  {
+  public:
+    OutOfCoreBuilder(ChunkFileWriter &fileWriter, const std::string &tempPrefix, size_t maxTrianglesInMemory, size_t batchTriangles, const std::atomic<bool> *cancelRequested)
+        : fileWriter(fileWriter), tempPrefix(tempPrefix), maxTrianglesInMemory(maxTrianglesInMemory), batchTriangles(batchTriangles), cancelRequested(cancelRequested)
+    {
+      batch.reserve(batchTriangles);
+    }
+
+    ~OutOfCoreBuilder()
+    {
+      for (const std::string &path : tempPaths)
+      {
+        std::error_code error;
+        std::filesystem::remove(path, error);
+      }
+    }
+
+    OutOfCoreBuilder(const OutOfCoreBuilder &) = delete;
+    OutOfCoreBuilder &operator=(const OutOfCoreBuilder &) = delete;
+
+    // Assimp Scene 의 모든 삼각형을 batchTriangles 개씩 임시 파일에 기록
+    TriangleBucket spill(const aiScene &scene)
+    {
+      BucketWriter writer(*this);
+      for (unsigned int m = 0; m < scene.mNumMeshes; m++)
+      {
+        const aiMesh *mesh = scene.mMeshes[m];
+        for (unsigned int i = 0; i < mesh->mNumFaces; i++)
+        {
+          // aiProcess_Triangulate 후에도 남을 수 있는 점, 선 primitive 는 제외
+          const aiFace &face = mesh->mFaces[i];
+          if (face.mNumIndices != 3)
+          {
+            continue;
+          }
+
+          SoupTriangle triangle;
+          for (int k = 0; k < 3; k++)
+          {
+            triangle.vertices[k] = makeVertex(*mesh, face.mIndices[k]);
+          }
+          writer.add(triangle);
+        }
+      }
+      return writer.close();
+    }
+
+    // bucket 의 삼각형들로 하위 트리를 만들고 bounding box 반환 (bucket 의 임시 파일은 지워짐)
+    BoundingBox build(const TriangleBucket &bucket)
+    {
+      if (bucket.triangleCount <= maxTrianglesInMemory)
+      {
+        return buildInMemory(bucket);
+      }
+
+      TriangleBucket left;
+      TriangleBucket right;
+      split(bucket, left, right);
+
+      const size_t node = fileWriter.beginInternalNode();
+      const BoundingBox bounds = mergeBoundingBoxes(build(left), build(right));
+      fileWriter.endInternalNode(node, bounds);
+      return bounds;
+    }
+
+  private:
+    ChunkFileWriter &fileWriter;
+    std::string tempPrefix;
+    size_t maxTrianglesInMemory;
+    size_t batchTriangles;
+    const std::atomic<bool> *cancelRequested;
+
+    std::vector<std::string> tempPaths;
+    size_t nextTempIndex = 0;
+
+    // 임시 파일을 읽고 쓰는 데 재사용하는 batch 배열
+    std::vector<SoupTriangle> batch;
+
+    // 삼각형들을 batchTriangles 개씩 모아서 새 임시 파일에 기록하는 클래스
+    class BucketWriter
+    {
+    public:
+      explicit BucketWriter(OutOfCoreBuilder &builder)
+          : builder(builder)
+      {
+        bucket.path = builder.tempPrefix + std::to_string(builder.nextTempIndex++);
+        builder.tempPaths.push_back(bucket.path);
+
+        stream.open(bucket.path, std::ios::binary | std::ios::trunc);
+        if (!stream)
+        {
+          throw std::runtime_error("Failed to create temporary chunk file: " + bucket.path);
+        }
+        pending.reserve(builder.batchTriangles);
+      }
+
+      void add(const SoupTriangle &triangle)
+      {
+        const glm::vec3 centroid = triangle.getCentroid();
+        if (bucket.triangleCount == 0)
+        {
+          bucket.centroidBounds = {centroid, centroid};
+        }
+        bucket.centroidBounds.min = glm::min(bucket.centroidBounds.min, centroid);
+        bucket.centroidBounds.max = glm::max(bucket.centroidBounds.max, centroid);
+        bucket.triangleCount++;
+
+        pending.push_back(triangle);
+        if (pending.size() >= builder.batchTriangles)
+        {
+          flush();
+        }
+      }
+
+      TriangleBucket close()
+      {
+        flush();
+        stream.close();
+        if (!stream)
+        {
+          throw std::runtime_error("Failed to write temporary chunk file: " + bucket.path);
+        }
+        return bucket;
+      }
+
+    private:
+      OutOfCoreBuilder &builder;
+      TriangleBucket bucket;
+      std::ofstream stream;
+      std::vector<SoupTriangle> pending;
+
+      void flush()
+      {
+        stream.write(reinterpret_cast<const char *>(pending.data()), static_cast<std::streamsize>(pending.size() * sizeof(SoupTriangle)));
+        pending.clear();
+        builder.checkCancelled();
+      }
+    };
+
+    void checkCancelled() const
+    {
+      ::checkCancelled(cancelRequested);
+    }
+
+    // bucket 의 삼각형들을 batchTriangles 개씩 읽어서 function(batch) 호출
+    template <typename Function>
+    void readBucket(const TriangleBucket &bucket, Function &&function)
+    {
+      std::ifstream stream(bucket.path, std::ios::binary);
+      size_t remaining = bucket.triangleCount;
+      while (remaining > 0)
+      {
+        batch.resize(std::min(remaining, batchTriangles));
+        stream.read(reinterpret_cast<char *>(batch.data()), static_cast<std::streamsize>(batch.size() * sizeof(SoupTriangle)));
+        if (!stream)
+        {
+          throw std::runtime_error("Failed to read temporary chunk file: " + bucket.path);
+        }
+
+        function(batch);
+        remaining -= batch.size();
+        checkCancelled();
+      }
+    }
+
+    void removeBucket(const TriangleBucket &bucket)
+    {
+      std::error_code error;
+      std::filesystem::remove(bucket.path, error);
+    }
+
+    /**
+     * 무게중심들의 AABB 에서 가장 긴 축의 histogram 으로 삼각형 개수가 절반에 가장 가까운 bin 경계를 찾아서 bucket 을 두 임시 파일로 나눔
+     *
+     * -> 메모리에 올리지 않고 정확한 중앙값을 구할 수 없으므로 bin 경계 단위의 근사 중앙값을 사용함.
+     * -> 무게중심이 한 bin 에 몰려 있어 한쪽이 1/8 보다 작아지면, 기록된 순서대로 절반씩 나눠서 트리가 깊어지지 않도록 함.
+     */
+    void split(const TriangleBucket &bucket, TriangleBucket &left, TriangleBucket &right)
+    {
+      const int axis = getLongestAxis(bucket.centroidBounds);
+      const float axisMin = bucket.centroidBounds.min[axis];
+      const float axisExtent = bucket.centroidBounds.max[axis] - axisMin;
+      const float binScale = axisExtent > 0.0f ? static_cast<float>(SPLIT_BINS) / axisExtent : 0.0f;
+
+      auto getBin = [&](const SoupTriangle &triangle)
+      {
+        const float position = (triangle.getCentroid()[axis] - axisMin) * binScale;
+        return std::min(static_cast<size_t>(std::max(position, 0.0f)), SPLIT_BINS - 1);
+      };
+
+      std::array<size_t, SPLIT_BINS> binCounts{};
+      readBucket(bucket, [&](const std::vector<SoupTriangle> &triangles)
+                 {
+                   for (const SoupTriangle &triangle : triangles)
+                   {
+                     binCounts[getBin(triangle)]++;
+                   }
+                 });
+
+      // [0, splitBin) 의 bin 들을 왼쪽으로 보냄
+      const size_t half = bucket.triangleCount / 2;
+      size_t splitBin = 0;
+      size_t leftCount = 0;
+      size_t bestDistance = std::numeric_limits<size_t>::max();
+      size_t cumulative = 0;
+      for (size_t bin = 1; bin < SPLIT_BINS; bin++)
+      {
+        cumulative += binCounts[bin - 1];
+        const size_t distance = cumulative > half ? cumulative - half : half - cumulative;
+        if (distance < bestDistance)
+        {
+          bestDistance = distance;
+          splitBin = bin;
+          leftCount = cumulative;
+        }
+      }
+
+      const size_t minimumSide = bucket.triangleCount / 8;
+      const bool splitByOrder = std::min(leftCount, bucket.triangleCount - leftCount) < std::max<size_t>(minimumSide, 1);
+
+      BucketWriter leftWriter(*this);
+      BucketWriter rightWriter(*this);
+      size_t index = 0;
+      readBucket(bucket, [&](const std::vector<SoupTriangle> &triangles)
+                 {
+                   for (const SoupTriangle &triangle : triangles)
+                   {
+                     const bool toLeft = splitByOrder ? index < half : getBin(triangle) < splitBin;
+                     (toLeft ? leftWriter : rightWriter).add(triangle);
+                     index++;
+                   }
+                 });
+
+      left = leftWriter.close();
+      right = rightWriter.close();
+      removeBucket(bucket);
+    }
+
+    // bucket 의 삼각형들을 중복 정점을 합친 정점 및 인덱스 배열로 읽어들여서 하위 트리를 기록
+    BoundingBox buildInMemory(const TriangleBucket &bucket)
+    {
+      std::vector<VertexData> vertices;
+      std::vector<unsigned int> indices;
+      std::unordered_map<VertexData, unsigned int, VertexDataHash, VertexDataEqual> vertexIndices;
+      indices.reserve(bucket.triangleCount * 3);
+      vertexIndices.reserve(bucket.triangleCount * 3);
+
+      readBucket(bucket, [&](const std::vector<SoupTriangle> &triangles)
+                 {
+                   for (const SoupTriangle &triangle : triangles)
+                   {
+                     for (const VertexData &vertex : triangle.vertices)
+                     {
+                       auto [it, inserted] = vertexIndices.try_emplace(vertex, static_cast<unsigned int>(vertices.size()));
+                       if (inserted)
+                       {
+                         vertices.push_back(vertex);
+                       }
+                       indices.push_back(it->second);
+                     }
+                   }
+                 });
+
+      removeBucket(bucket);
+      return fileWriter.buildInMemory(vertices, indices);
+    }
+
+    static VertexData makeVertex(const aiMesh &mesh, unsigned int i)
+    {
+      VertexData vertex{};
+      vertex.Position = glm::vec3(mesh.mVertices[i].x, mesh.mVertices[i].y, mesh.mVertices[i].z);
+      if (mesh.HasNormals())
+      {
+        vertex.Normal = glm::vec3(mesh.mNormals[i].x, mesh.mNormals[i].y, mesh.mNormals[i].z);
+      }
+      if (mesh.mTextureCoords[0])
+      {
+        vertex.TexCoords = glm::vec2(mesh.mTextureCoords[0][i].x, mesh.mTextureCoords[0][i].y);
+        vertex.Tangent = glm::vec3(mesh.mTangents[i].x, mesh.mTangents[i].y, mesh.mTangents[i].z);
+        vertex.Bitangent = glm::vec3(mesh.mBitangents[i].x, mesh.mBitangents[i].y, mesh.mBitangents[i].z);
+      }
+      return vertex;
+    }
+  };
+}
+
+namespace ChunkedMeshWriter
+{
+  void write(const std::string &path, const std::vector<VertexData> &vertices, const std::vector<unsigned int> &indices, size_t maxTrianglesPerChunk)
+  {
+    ChunkFileWriter fileWriter(path, maxTrianglesPerChunk);
+
+    if (indices.size() < 3)
+    {
+      throw std::runtime_error("Cannot write an empty chunked mesh: " + path);
+    }
+
+    const BoundingBox bounds = fileWriter.buildInMemory(vertices, indices);
+    fileWriter.finish(bounds, indices.size() / 3);
+  }
+
+  bool convert(const std::string &modelPath,
+               const std::string &outputPath,
+               size_t maxTrianglesPerChunk,
+               size_t maxTrianglesInMemory,
+               size_t batchTriangles,
+               const std::atomic<bool> *cancelRequested)
+  {
+    if (maxTrianglesInMemory == 0 || batchTriangles == 0)
+    {
+      throw std::invalid_argument("Conversion triangle limits must be positive.");
+    }
+
+    ChunkFileWriter fileWriter(outputPath, maxTrianglesPerChunk);
+    OutOfCoreBuilder builder(fileWriter, outputPath + ".tmp", maxTrianglesInMemory, batchTriangles, cancelRequested);
+
+    try
+    {
+      // 노드 계층 구조의 변환을 정점에 미리 적용하여 모든 mesh 를 하나의 좌표계로 합침
+      Assimp::Importer importer;
+      const aiScene *scene = importer.ReadFile(modelPath, aiProcess_Triangulate | aiProcess_JoinIdenticalVertices | aiProcess_GenSmoothNormals | aiProcess_FlipUVs | aiProcess_CalcTangentSpace | aiProcess_PreTransformVertices);
+      if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode)
+      {
+        throw std::runtime_error("Failed to import " + modelPath + ": " + importer.GetErrorString());
+      }
+
+      // 삼각형들을 임시 파일로 옮긴 뒤에는 Assimp Scene 이 필요 없으므로, 분할 및 chunk 기록 전에 해제하여 최대 메모리 사용량을 줄임
+      const TriangleBucket root = builder.spill(*scene);
+      importer.FreeScene();
+
+      if (root.triangleCount == 0)
+      {
+        throw std::runtime_error("Cannot write an empty chunked mesh: " + outputPath);
+      }
+
+      const BoundingBox bounds = builder.build(root);
+      fileWriter.finish(bounds, root.triangleCount);
+      return true;
+    }
+    catch (const ConversionCancelled &)
+    {
+      spdlog::info("Chunked mesh conversion of <{}> cancelled", modelPath);
+      return false;
+    }
+  }
+}
@@ -0,0 +1,372 @@
+#include "streaming/streaming_mesh.hpp"
+#include "constants/streaming_constants.hpp"
+#include <algorithm>
+#include <spdlog/spdlog.h>
+
+namespace
+{
+  // 점에서 AABB 까지의 거리 (점이 AABB 내부에 있으면 0)
+  float distanceToBox(const BoundingBox &box, const glm::vec3 &point)
+  {
+    return glm::length(glm::max(glm::max(box.min - point, point - box.max), glm::vec3(0.0f)));
+  }
+}
+
+StreamingMesh::StreamingMesh(const std::string &path, size_t memoryBudget, size_t ioThreadCount)
+    : file(path),
+      arena(getInitialVertexCount(file, memoryBudget), getInitialIndexCount(file, memoryBudget)),
+      memoryBudget(memoryBudget),
+      streamRadius(0.0f)
+{
+  // 내린 chunk 의 버퍼 영역은 fence 로 GPU 사용이 끝났음을 확인한 뒤에만 반납하므로 동기화 없이 업로드해도 안전함
+  arena.setUnsynchronizedUploads(true);
+
+  const size_t chunkCount = file.getChunks().size();
+  chunkStates.assign(chunkCount, ChunkState::UNLOADED);
+  chunkGeometries.resize(chunkCount);
+  keepFrames.assign(chunkCount, 0);
+
+  candidates.reserve(chunkCount);
+  requests.reserve(chunkCount);
+  cancelledRequests.reserve(chunkCount);
+  residentChunks.reserve(chunkCount);
+
+  stats.chunkCount = chunkCount;
+
+  loader = std::make_unique<ChunkLoader>(file, ioThreadCount);
+
+  spdlog::info("StreamingMesh <{}> opened ({} chunks, {} nodes)", path, chunkCount, file.getNodes().size());
+}
+
+StreamingMesh::~StreamingMesh()
+{
+  // 진행 중인 읽기가 끝날 때까지 기다린 뒤 I/O 스레드 종료
+  loader.reset();
+}
+
+void StreamingMesh::setMemoryBudget(size_t memoryBudget)
+{
+  this->memoryBudget = memoryBudget;
+}
+
+void StreamingMesh::setStreamRadius(float streamRadius)
+{
+  this->streamRadius = streamRadius;
+}
+
+const BoundingBox &StreamingMesh::getBounds() const
+{
+  return file.getHeader().bounds;
+}
+
+void StreamingMesh::update(const glm::vec3 &cameraPosition)
+{
+  frame++;
+  stats.uploadedBytes = 0;
+
+  retirePendingFrees();
+  selectChunks(cameraPosition);
+  evictChunks();
+  uploadChunks();
+  requestChunks();
+
+  stats.residentChunkCount = residentChunks.size();
+  stats.readBytes = loader->getReadBytes();
+}
+
+unsigned int StreamingMesh::draw(const Frustum &frustum)
+{
+  // 상주 중인 chunk 들의 bounding sphere 를 절두체와 비교하여 화면 밖의 chunk 는 그리지 않음
+  residentSpheres.resize(residentChunks.size());
+  for (size_t i = 0; i < residentChunks.size(); i++)
+  {
+    residentSpheres.set(i, file.getChunks()[residentChunks[i]].sphere);
+  }
+  frustum.cullSpheres(residentSpheres, residentVisibility);
+
+  stats.drawnChunkCount = 0;
+  if (GLExtensions::hasMultiDrawIndirect())
+  {
+    // 모든 chunk 가 하나의 arena 를 공유하므로 보이는 chunk 들을 한번의 multi draw indirect 로 그림
+    for (size_t i = 0; i < residentChunks.size(); i++)
+    {
+      if (!residentVisibility[i])
+      {
+        continue;
+      }
+
+      const std::uint32_t chunk = residentChunks[i];
+      const MeshGeometry &geometry = chunkGeometries[chunk];
+
+      DrawElementsIndirectCommand command;
+      command.count = static_cast<GLuint>(geometry.indexCount);
+      command.instanceCount = 1;
+      command.firstIndex = static_cast<GLuint>(geometry.firstIndex);
+      command.baseVertex = geometry.baseVertex;
+      command.baseInstance = static_cast<GLuint>(drawData.size());
+      drawCommands.push_back(command);
+
+      MeshDrawData data;
+      data.dequantization = file.getChunks()[chunk].dequantization;
+      drawData.push_back(data);
+    }
+
+    stats.drawnChunkCount = drawCommands.size();
+    arena.multiDraw(GL_TRIANGLES, drawCommands, drawData);
+
+    unsigned int drawCallCount = drawCommands.empty() ? 0 : 1;
+    drawCommands.clear();
+    drawData.clear();
+    return drawCallCount;
+  }
+
+  /*
+    multi draw indirect 를 지원하지 않으면 chunk 마다 dequantization 변환을 상수 attribute 로 전송하고 하나씩 그림
+
+    -> chunk 들은 scene graph 노드 변환이 없으므로 노드 world transform 및 노멀 행렬은 단위 행렬로 한번만 전송함.
+  */
+  const glm::mat4 identity(1.0f);
+  for (GLuint column = 0; column < 4; column++)
+  {
+    glVertexAttrib4fv(INSTANCE_MODEL_ATTRIBUTE_LOCATION + column, &identity[column][0]);
+  }
+  const glm::mat3 identityNormal(1.0f);
+  for (GLuint column = 0; column < 3; column++)
+  {
+    glVertexAttrib3fv(INSTANCE_NORMAL_MATRIX_ATTRIBUTE_LOCATION + column, &identityNormal[column][0]);
+  }
+
+  unsigned int drawCallCount = 0;
+  for (size_t i = 0; i < residentChunks.size(); i++)
+  {
+    if (!residentVisibility[i])
+    {
+      continue;
+    }
+
+    const std::uint32_t chunk = residentChunks[i];
+    const MeshGeometry &geometry = chunkGeometries[chunk];
+    const PositionDequantization &dequantization = file.getChunks()[chunk].dequantization;
+
+    glVertexAttrib3fv(POSITION_SCALE_ATTRIBUTE_LOCATION, &dequantization.scale[0]);
+    glVertexAttrib3fv(POSITION_OFFSET_ATTRIBUTE_LOCATION, &dequantization.offset[0]);
+
+    geometry.vao->bind();
+    glDrawElementsBaseVertex(GL_TRIANGLES, static_cast<GLsizei>(geometry.indexCount), geometry.indexType, (void *)(geometry.firstIndex * sizeof(ChunkIndexType)), geometry.baseVertex);
+    geometry.vao->unbind();
+
+    drawCallCount++;
+  }
+
+  stats.drawnChunkCount = drawCallCount;
+  return drawCallCount;
+}
+
+const StreamingStats &StreamingMesh::getStats() const
+{
+  return stats;
+}
+
+void StreamingMesh::retirePendingFrees()
+{
+  // fence 는 삽입된 순서대로 signaled 되므로 앞에서부터 확인
+  while (!pendingFrees.empty() && pendingFrees.front().fence->isSignaled())
+  {
+    for (const MeshGeometry &geometry : pendingFrees.front().geometries)
+    {
+      arena.free(geometry);
+    }
+
+    stats.residentBytes -= pendingFrees.front().bytes;
+    pendingFrees.pop_front();
+  }
+}
+
+void StreamingMesh::selectChunks(const glm::vec3 &cameraPosition)
+{
+  /*
+    chunk 계층 구조를 전위 순회하며 카메라로부터 유지 거리 이내의 chunk 들을 모음
+
+    -> 노드의 bounding box 가 유지 거리보다 멀면 하위 노드들을 subtreeEnd 로 한번에 건너뜀.
+  */
+  const float keepRadius = streamRadius * (1.0f + StreamingConstants::STREAM_RADIUS_HYSTERESIS);
+  const std::vector<ChunkNode> &nodes = file.getNodes();
+
+  candidates.clear();
+  size_t node = 0;
+  while (node < nodes.size())
+  {
+    const float distance = distanceToBox(nodes[node].bounds, cameraPosition);
+    if (distance > keepRadius)
+    {
+      node = nodes[node].subtreeEnd;
+      continue;
+    }
+
+    if (nodes[node].chunk >= 0)
+    {
+      candidates.push_back({distance, static_cast<std::uint32_t>(nodes[node].chunk)});
+    }
+    node++;
+  }
+
+  // 가까운 chunk 부터 메모리 예산이 허용하는 만큼만 유지 대상으로 표시
+  std::sort(candidates.begin(), candidates.end(), [](const ChunkCandidate &a, const ChunkCandidate &b)
+            { return a.distance < b.distance; });
+
+  size_t selectedBytes = 0;
+  for (const ChunkCandidate &candidate : candidates)
+  {
+    const size_t bytes = file.getChunks()[candidate.chunk].getByteSize();
+    if (selectedBytes + bytes > memoryBudget)
+    {
+      break;
+    }
+
+    selectedBytes += bytes;
+    keepFrames[candidate.chunk] = frame;
+  }
+}
+
+void StreamingMesh::evictChunks()
+{
+  // 유지 대상으로 선택되지 않은 상주 chunk 들을 내리고, 그 버퍼 영역은 fence 가 signaled 될 때까지 반납을 미룸
+  evictedGeometries.clear();
+  size_t evictedBytes = 0;
+
+  residentChunks.erase(std::remove_if(residentChunks.begin(), residentChunks.end(), [&](std::uint32_t chunk)
+                                      {
+                                        if (keepFrames[chunk] == frame)
+                                        {
+                                          return false;
+                                        }
+
+                                        evictedGeometries.push_back(chunkGeometries[chunk]);
+                                        evictedBytes += file.getChunks()[chunk].getByteSize();
+                                        chunkGeometries[chunk] = MeshGeometry();
+                                        chunkStates[chunk] = ChunkState::UNLOADED;
+                                        return true; }),
+                       residentChunks.end());
+
+  if (evictedGeometries.empty())
+  {
+    return;
+  }
+
+  // 지금까지 제출된 그리기 명령들이 내린 chunk 를 읽고 있을 수 있으므로 그 뒤에 fence 삽입
+  PendingFree pendingFree;
+  pendingFree.fence = std::make_unique<FenceObject>();
+  pendingFree.fence->bind();
+  pendingFree.geometries = evictedGeometries;
+  pendingFree.bytes = evictedBytes;
+  pendingFrees.push_back(std::move(pendingFree));
+}
+
+void StreamingMesh::uploadChunks()
+{
+  while (stats.uploadedBytes < StreamingConstants::UPLOAD_BYTES_PER_FRAME && loader->poll(loadedChunk))
+  {
+    const size_t chunk = loadedChunk.chunk;
+    const size_t bytes = file.getChunks()[chunk].getByteSize();
+    stats.loadingBytes -= bytes;
+    stats.loadingChunkCount--;
+
+    if (loadedChunk.failed)
+    {
+      chunkStates[chunk] = ChunkState::FAILED;
+      continue;
+    }
+
+    // 읽는 동안 카메라가 이동하여 더 이상 필요 없어진 chunk 는 업로드하지 않고 버림
+    if (keepFrames[chunk] != frame || stats.residentBytes + bytes > memoryBudget)
+    {
+      chunkStates[chunk] = ChunkState::UNLOADED;
+      continue;
+    }
+
+    chunkGeometries[chunk] = arena.allocate(loadedChunk.data.vertices, loadedChunk.data.indices);
+    chunkStates[chunk] = ChunkState::RESIDENT;
+    residentChunks.push_back(static_cast<std::uint32_t>(chunk));
+
+    stats.residentBytes += bytes;
+    stats.uploadedBytes += bytes;
+  }
+
+  // 업로드를 마친 chunk 의 CPU 측 배열은 곧바로 해제하여 상주 메모리를 GPU 버퍼로만 한정
+  loadedChunk.data = ChunkData();
+}
+
+void StreamingMesh::requestChunks()
+{
+  // 아직 읽기 시작하지 않은 요청은 우선순위가 바뀌었을 수 있으므로 모두 취소한 뒤 다시 요청
+  cancelledRequests.clear();
+  loader->cancelRequests(cancelledRequests);
+  for (size_t chunk : cancelledRequests)
+  {
+    chunkStates[chunk] = ChunkState::UNLOADED;
+    stats.loadingBytes -= file.getChunks()[chunk].getByteSize();
+    stats.loadingChunkCount--;
+  }
+
+  /*
+    stream radius 이내의 유지 대상 chunk 들을 가까운 순서로 요청
+
+    -> 상주 중인 chunk, 해제를 기다리는 영역, 읽기 중인 chunk 의 크기를 모두 합쳐도 메모리 예산을 넘지 않는 만큼만 요청함.
+  */
+  requests.clear();
+  for (const ChunkCandidate &candidate : candidates)
+  {
+    if (candidate.distance > streamRadius)
+    {
+      break;
+    }
+
+    if (keepFrames[candidate.chunk] != frame || chunkStates[candidate.chunk] != ChunkState::UNLOADED)
+    {
+      continue;
+    }
+
+    const size_t bytes = file.getChunks()[candidate.chunk].getByteSize();
+    if (stats.residentBytes + stats.loadingBytes + bytes > memoryBudget)
+    {
+      break;
+    }
+
+    requests.push_back(candidate.chunk);
+    chunkStates[candidate.chunk] = ChunkState::LOADING;
+    stats.loadingBytes += bytes;
+    stats.loadingChunkCount++;
+  }
+
+  loader->addRequests(requests);
+}
+
+size_t StreamingMesh::getInitialVertexCount(const ChunkedMeshFile &file, size_t memoryBudget)
+{
+  size_t vertexBytes = 0;
+  size_t totalBytes = 0;
+  for (const ChunkRecord &record : file.getChunks())
+  {
+    vertexBytes += record.vertexCount * sizeof(ChunkVertexData);
+    totalBytes += record.getByteSize();
+  }
+
+  const size_t budget = std::min(memoryBudget, totalBytes);
+  const double ratio = totalBytes > 0 ? static_cast<double>(vertexBytes) / static_cast<double>(totalBytes) : 0.0;
+  return std::max<size_t>(static_cast<size_t>(budget * ratio) / sizeof(ChunkVertexData), 1);
+}
+
+size_t StreamingMesh::getInitialIndexCount(const ChunkedMeshFile &file, size_t memoryBudget)
+{
+  size_t indexBytes = 0;
+  size_t totalBytes = 0;
+  for (const ChunkRecord &record : file.getChunks())
+  {
+    indexBytes += record.indexCount * sizeof(ChunkIndexType);
+    totalBytes += record.getByteSize();
+  }
+
+  const size_t budget = std::min(memoryBudget, totalBytes);
+  const double ratio = totalBytes > 0 ? static_cast<double>(indexBytes) / static_cast<double>(totalBytes) : 0.0;
+  return std::max<size_t>(static_cast<size_t>(budget * ratio) / sizeof(ChunkIndexType), 1);
+}
@@ -0,0 +1,46 @@
+#include "ui_containers/instancing_ui.hpp"
+#include "constants/instancing_constants.hpp"
+#include <vector>
+
+InstancingUi::InstancingUi()
+{
+  std::vector<const char *> gridSizeLabels;
+  for (const auto &gridSize : InstancingConstants::GRID_SIZES)
+  {
+    gridSizeLabels.push_back(gridSize.label);
+  }
+
+  gridSizeSelector.setLabel(InstancingConstants::GRID_SIZE_SELECTOR_UI_LABEL);
+  gridSizeSelector.setItems(gridSizeLabels);
+
+  enabled.setLabel(InstancingConstants::ENABLED_UI_LABEL);
+
+  useInstancing.setLabel(InstancingConstants::USE_INSTANCING_UI_LABEL);
+}
+
+InstancingUi::~InstancingUi()
+{
+}
+
+bool InstancingUi::onUiComponents()
+{
+  bool ret = false;
+  ret |= enabled.onUiComponent();
+  ret |= useInstancing.onUiComponent();
+  ret |= gridSizeSelector.onUiComponent();
+  return ret;
+}
+
+void InstancingUi::onChange(const InstancingParameter &param)
+{
+  enabled.setValue(param.enabled);
+  useInstancing.setValue(param.useInstancing);
+  gridSizeSelector.setCurrentIndex(param.gridSizeIndex);
+}
+
+void InstancingUi::getInstancingParam(InstancingParameter &param) const
+{
+  param.enabled = enabled.getValue();
+  param.useInstancing = useInstancing.getValue();
+  param.gridSizeIndex = gridSizeSelector.getCurrentIndex();
+}
@@ -1,5 +1,7 @@
 #include "ui_containers/model_ui.hpp"
 #include "constants/model_constants.hpp"
+#include "constants/animation_constants.hpp"
+#include "constants/scene_constants.hpp"
 #include <vector>
 
 ModelUi::ModelUi()
@@ -27,6 +29,15 @@ ModelUi::ModelUi()
   scale.setMin(ModelConstants::SCALE_MIN);
   scale.setMax(ModelConstants::SCALE_MAX);
   scale.setSpeed(ModelConstants::SCALE_UI_SPEED);
+
+  animate.setLabel(AnimationConstants::ANIMATE_UI_LABEL);
+
+  animationSpeed.setLabel(AnimationConstants::SPEED_UI_LABEL);
+  animationSpeed.setMin(AnimationConstants::SPEED_MIN);
+  animationSpeed.setMax(AnimationConstants::SPEED_MAX);
+  animationSpeed.setSpeed(AnimationConstants::SPEED_UI_SPEED);
+
+  sceneEnabled.setLabel(SceneConstants::ENABLED_UI_LABEL);
 }
 
 ModelUi::~ModelUi()
@@ -40,6 +51,9 @@ bool ModelUi::onUiComponents()
   ret |= rotation.onUiComponent();
   ret |= scale.onUiComponent();
   ret |= modelSelector.onUiComponent();
+  ret |= animate.onUiComponent();
+  ret |= animationSpeed.onUiComponent();
+  ret |= sceneEnabled.onUiComponent();
   return ret;
 }
 
@@ -49,6 +63,9 @@ void ModelUi::onChange(const ModelParameter &param)
   rotation.setValue(param.rotation);
   scale.setValue(param.scale);
   modelSelector.setCurrentIndex(param.modelIndex);
+  animate.setValue(param.animate);
+  animationSpeed.setValue(param.animationSpeed);
+  sceneEnabled.setValue(param.sceneEnabled);
 }
 
 void ModelUi::getModelParam(ModelParameter &param) const
@@ -57,4 +74,7 @@ void ModelUi::getModelParam(ModelParameter &param) const
   param.rotation = rotation.getValue();
   param.scale = scale.getValue();
   param.modelIndex = modelSelector.getCurrentIndex();
+  param.animate = animate.getValue();
+  param.animationSpeed = animationSpeed.getValue();
+  param.sceneEnabled = sceneEnabled.getValue();
 }
@@ -0,0 +1,118 @@
+#include "ui_containers/stats_ui.hpp"
+
+#include "imgui.h"
+
+StatsUi::StatsUi()
+{
+}
+
+StatsUi::~StatsUi()
+{
+}
+
+void StatsUi::onUiComponents(const RenderStats &stats)
+{
+  // 최근 프레임들의 평균 frame rate
+  const float framerate = ImGui::GetIO().Framerate;
+  ImGui::Text("%.1f FPS (%.3f ms)", framerate, framerate > 0.0f ? 1000.0f / framerate : 0.0f);
+
+  // frustum culling 결과
+  ImGui::Text("Meshes : %u submitted, %u culled", stats.submittedMeshCount, stats.culledMeshCount);
+  ImGui::Text("Meshlets : %u tested, %u culled (%u tris, %.3f ms)",
+              stats.meshletCount,
+              stats.culledMeshletCount,
+              stats.meshletCulledTriangleCount,
+              stats.meshletCullTimeMs);
+  ImGui::Text("Scene nodes : %u (%u updated)", stats.sceneNodeCount, stats.updatedSceneNodeCount);
+  ImGui::Text("Textures : %u cached (%.2f MB)", stats.cachedTextureCount, stats.cachedTextureBytes / (1024.0f * 1024.0f));
+  ImGui::Text("Draw calls : %u", stats.drawCallCount);
+  ImGui::Text("Heap allocations : %u / frame", stats.heapAllocationCount);
+  ImGui::Text("GL calls (%s) : %u / frame, %u startup", stats.directStateAccess ? "DSA" : "bind", stats.glCallCount, stats.startupGLCallCount);
+
+  // 시작 시간 및 쉐이더 프로그램을 캐시에서 읽었는지 (warm) 소스로부터 컴파일했는지 (cold)
+  ImGui::Text("Startup (%s) : %.1f ms", stats.startupProgramCompiledCount > 0 ? "cold" : "warm", stats.startupTimeMs);
+  ImGui::Text("  programs : %u cached (%.1f ms), %u compiled (%.1f ms)",
+              stats.startupProgramLoadedCount,
+              stats.startupProgramLoadTimeMs,
+              stats.startupProgramCompiledCount,
+              stats.startupProgramCompileTimeMs);
+  ImGui::Text("  link wait : %.1f ms, overlapped : %.1f ms",
+              stats.startupProgramLinkWaitTimeMs,
+              stats.startupProgramOverlapTimeMs);
+
+  // RenderQueue 로 그린 scene 의 명령 개수 및 정렬된 순서로 그리면서 발생한 상태 변경 횟수
+  if (stats.sceneObjectCount > 0)
+  {
+    ImGui::Text("Scene : %u objects, %u commands (sorted in %.3f ms)", stats.sceneObjectCount, stats.renderQueueCommandCount, stats.renderQueueSortTimeMs);
+    ImGui::Text("  binds : %u program, %u material, %u texture", stats.programBindCount, stats.materialBindCount, stats.textureBindCount);
+  }
+
+  // pbr 쉐이더 변형별 GPU 처리 시간 (해당 변형으로 그린 구간들의 합)
+  ImGui::Text("Shader variants : %zu", stats.shaderVariants.size());
+  for (const ShaderVariantStats &variant : stats.shaderVariants)
+  {
+    ImGui::Text("  %s : %.3f ms", variant.label, variant.gpuTimeMs);
+  }
+
+  // instancing 으로 그린 인스턴스 개수 및 GPU 처리 시간 기준 초당 인스턴스 처리량
+  if (stats.instanceCount > 0)
+  {
+    ImGui::Text("Instances : %u (%u draw calls)", stats.instanceCount, stats.instancingDrawCallCount);
+    ImGui::Text("  CPU %.3f ms, GPU %.3f ms (%.2f M instances/s)",
+                stats.instancingCpuTimeMs,
+                stats.instancingGpuTimeMs,
+                stats.instancingGpuTimeMs > 0.0f ? stats.instanceCount / (stats.instancingGpuTimeMs * 1e3f) : 0.0f);
+  }
+
+  // skinning 되는 Model 의 애니메이션 갱신 비용 (CPU 기준 초당 joint 처리량) 및 초당 skinning 된 정점 처리량
+  if (stats.skinnedVertexCount > 0)
+  {
+    ImGui::Text("Skinning : %u joints (%.3f ms, %.2f M joints/s)",
+                stats.animatedJointCount,
+                stats.animationTimeMs,
+                stats.animationTimeMs > 0.0f ? stats.animatedJointCount / (stats.animationTimeMs * 1e3f) : 0.0f);
+    ImGui::Text("  %u vertices (%.2f M vertices/s)", stats.skinnedVertexCount, stats.skinnedVertexCount * framerate * 1e-6f);
+  }
+
+  // 선택된 Model 의 BVH 크기, 생성 시간, 단일 스레드 기준 광선 처리량 (측정한 경우) 및 마지막 picking 결과
+  if (stats.bvhNodeCount > 0)
+  {
+    ImGui::Text("BVH : %u nodes (built in %.2f ms)", stats.bvhNodeCount, stats.bvhBuildTimeMs);
+    if (stats.bvhClosestHitMrays > 0.0f)
+    {
+      ImGui::Text("  %.2f Mrays/s closest-hit, %.2f Mrays/s any-hit", stats.bvhClosestHitMrays, stats.bvhAnyHitMrays);
+    }
+    if (stats.pickedMeshIndex >= 0)
+    {
+      ImGui::Text("  picked mesh %d (%.3f ms)", stats.pickedMeshIndex, stats.pickTimeMs);
+    }
+  }
+
+  // 스트리밍되는 mesh 의 chunk 상주 현황 및 메모리 예산 대비 사용량
+  if (stats.streamingConverting)
+  {
+    ImGui::Text("Streaming : converting chunk file...");
+  }
+  else if (stats.streamingChunkCount > 0)
+  {
+    ImGui::Text("Streaming : %u / %u chunks (%u loading, %u drawn)",
+                stats.streamingResidentChunkCount,
+                stats.streamingChunkCount,
+                stats.streamingLoadingChunkCount,
+                stats.streamingDrawnChunkCount);
+    ImGui::Text("  %.1f / %.1f MB, %.2f MB uploaded",
+                stats.streamingResidentBytes / (1024.0f * 1024.0f),
+                stats.streamingMemoryBudget / (1024.0f * 1024.0f),
+                stats.streamingUploadedBytes / (1024.0f * 1024.0f));
+  }
+
+  // LOD 별로 그려진 mesh 및 삼각형 개수와 초당 삼각형 처리량
+  for (int lod = 0; lod < ModelConstants::NUM_LODS; lod++)
+  {
+    ImGui::Text("LOD %d : %u meshes, %u tris (%.2f Mtris/s)",
+                lod,
+                stats.lodMeshCounts[lod],
+                stats.lodTriangleCounts[lod],
+                stats.lodTriangleCounts[lod] * framerate * 1e-6f);
+  }
+}
@@ -0,0 +1,49 @@
+#include "ui_containers/streaming_ui.hpp"
+#include "constants/streaming_constants.hpp"
+#include <vector>
+
+StreamingUi::StreamingUi()
+{
+  std::vector<const char *> memoryBudgetLabels;
+  for (const auto &memoryBudget : StreamingConstants::MEMORY_BUDGETS)
+  {
+    memoryBudgetLabels.push_back(memoryBudget.label);
+  }
+
+  memoryBudgetSelector.setLabel(StreamingConstants::MEMORY_BUDGET_SELECTOR_UI_LABEL);
+  memoryBudgetSelector.setItems(memoryBudgetLabels);
+
+  enabled.setLabel(StreamingConstants::ENABLED_UI_LABEL);
+
+  streamRadius.setLabel(StreamingConstants::STREAM_RADIUS_UI_LABEL);
+  streamRadius.setMin(StreamingConstants::STREAM_RADIUS_MIN);
+  streamRadius.setMax(StreamingConstants::STREAM_RADIUS_MAX);
+  streamRadius.setSpeed(StreamingConstants::STREAM_RADIUS_UI_SPEED);
+}
+
+StreamingUi::~StreamingUi()
+{
+}
+
+bool StreamingUi::onUiComponents()
+{
+  bool ret = false;
+  ret |= enabled.onUiComponent();
+  ret |= memoryBudgetSelector.onUiComponent();
+  ret |= streamRadius.onUiComponent();
+  return ret;
+}
+
+void StreamingUi::onChange(const StreamingParameter &param)
+{
+  enabled.setValue(param.enabled);
+  memoryBudgetSelector.setCurrentIndex(param.memoryBudgetIndex);
+  streamRadius.setValue(param.streamRadius);
+}
+
+void StreamingUi::getStreamingParam(StreamingParameter &param) const
+{
+  param.enabled = enabled.getValue();
+  param.memoryBudgetIndex = memoryBudgetSelector.getCurrentIndex();
+  param.streamRadius = streamRadius.getValue();
+}
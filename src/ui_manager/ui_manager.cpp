@@ -53,6 +53,8 @@ void UiManager::initializeUiComponents(App &app)
   appPtr->getLightController().addListener(lightUi);
   appPtr->getIBLController().addListener(iblUi);
   appPtr->getModelController().addListener(modelUi);
+  appPtr->getInstancingController().addListener(instancingUi);
+  appPtr->getStreamingController().addListener(streamingUi);
 
   /**
    * 각 Controller 객체에 초기화된 파라미터 값들을
@@ -73,6 +75,12 @@ void UiManager::initializeUiComponents(App &app)
 
   const ModelParameter modelParameter = appPtr->getModelController().getValue();
   appPtr->getModelController().setValue(modelParameter);
+
+  const InstancingParameter instancingParameter = appPtr->getInstancingController().getValue();
+  appPtr->getInstancingController().setValue(instancingParameter);
+
+  const StreamingParameter streamingParameter = appPtr->getStreamingController().getValue();
+  appPtr->getStreamingController().setValue(streamingParameter);
 }
 
 void UiManager::process()
@@ -108,6 +116,28 @@ void UiManager::process()
 
   ImGui::Separator();
 
+  ImGui::Dummy(ImVec2(0.0f, LayoutConstants::TITLE_PADDING));
+  ImGui::Text("Instancing");
+  ImGui::Dummy(ImVec2(0.0f, LayoutConstants::TITLE_PADDING));
+  if (instancingUi.onUiComponents())
+  {
+    onChangeInstancingUi();
+  }
+  ImGui::Dummy(ImVec2(0.0f, LayoutConstants::PANEL_PADDING));
+
+  ImGui::Separator();
+
+  ImGui::Dummy(ImVec2(0.0f, LayoutConstants::TITLE_PADDING));
+  ImGui::Text("Streaming");
+  ImGui::Dummy(ImVec2(0.0f, LayoutConstants::TITLE_PADDING));
+  if (streamingUi.onUiComponents())
+  {
+    onChangeStreamingUi();
+  }
+  ImGui::Dummy(ImVec2(0.0f, LayoutConstants::PANEL_PADDING));
+
+  ImGui::Separator();
+
   ImGui::Dummy(ImVec2(0.0f, LayoutConstants::TITLE_PADDING));
   ImGui::Text("Camera");
   ImGui::Dummy(ImVec2(0.0f, LayoutConstants::TITLE_PADDING));
@@ -144,8 +174,28 @@ void UiManager::process()
   }
   ImGui::Dummy(ImVec2(0.0f, LayoutConstants::PANEL_PADDING));
 
+  ImGui::Separator();
+
+  ImGui::Dummy(ImVec2(0.0f, LayoutConstants::TITLE_PADDING));
+  ImGui::Text("Statistics");
+  ImGui::Dummy(ImVec2(0.0f, LayoutConstants::TITLE_PADDING));
+  statsUi.onUiComponents(appPtr->getRenderStats());
+  ImGui::Dummy(ImVec2(0.0f, LayoutConstants::PANEL_PADDING));
+
   ImGui::End();
 
+  /*
+    ImGui 창 바깥을 좌클릭하면 커서 위치에서 Model picking
+
+    -> GLFW 입력 콜백은 ImGui 가 자동으로 처리하고 있으므로 ImGui 의 입력 상태로 클릭을 감지하며,
+    커서가 ImGui 창 위에 있어서 WantCaptureMouse 가 켜진 경우에는 ImGui 입력이 우선함.
+  */
+  ImGuiIO &io = ImGui::GetIO();
+  if (!io.WantCaptureMouse && ImGui::IsMouseClicked(ImGuiMouseButton_Left) && io.DisplaySize.x > 0.0f && io.DisplaySize.y > 0.0f)
+  {
+    appPtr->pickModel(io.MousePos.x / io.DisplaySize.x, io.MousePos.y / io.DisplaySize.y);
+  }
+
   // ImGui 가 렌더링할 drawData 를 모아 둠.
   ImGui::Render();
 
@@ -201,3 +251,19 @@ void UiManager::onChangeModelUi()
   modelUi.getModelParam(modelParameter);
   appPtr->getModelController().setValue(modelParameter, &modelUi);
 }
+
+void UiManager::onChangeInstancingUi()
+{
+  // InstancingUi 컨테이너로부터 현재 ImGui 입력값을 가져와서 InstancingParameter 에 복사 후 Controller 객체에 notify 전파
+  InstancingParameter instancingParameter;
+  instancingUi.getInstancingParam(instancingParameter);
+  appPtr->getInstancingController().setValue(instancingParameter, &instancingUi);
+}
+
+void UiManager::onChangeStreamingUi()
+{
+  // StreamingUi 컨테이너로부터 현재 ImGui 입력값을 가져와서 StreamingParameter 에 복사 후 Controller 객체에 notify 전파
+  StreamingParameter streamingParameter;
+  streamingUi.getStreamingParam(streamingParameter);
+  appPtr->getStreamingController().setValue(streamingParameter, &streamingUi);
+}